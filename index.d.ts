@@ -56,16 +56,23 @@ declare module 'talib' {
     TA_FUNC_UNST_NONE = -1
   }
 
+  /**
+   * Numeric input series. Float64Array and ArrayBuffer values are read
+   * in place without copying. When all the inputs of a function are
+   * Float32Array, they are read in place by its single precision variant.
+   */
+  export type InputArray = number[] | Float64Array | Float32Array | ArrayBuffer;
+
   /**
    * Market data input
    */
   export interface MarketData {
-    open?: number[];
-    high?: number[];
-    low?: number[];
-    close?: number[];
-    volume?: number[];
-    openInterest?: number[];
+    open?: InputArray;
+    high?: InputArray;
+    low?: InputArray;
+    close?: InputArray;
+    volume?: InputArray;
+    openInterest?: InputArray;
   }
 
   /**
@@ -103,6 +110,7 @@ declare module 'talib' {
    */
   export interface FunctionExplanation {
     name: string;
+    id: number;
     group: string;
     hint: string;
     inputs: InputParameterInfo[];
@@ -110,13 +118,34 @@ declare module 'talib' {
     outputs: OutputParameterInfo[];
   }
 
+  /**
+   * Candle setting override
+   */
+  export interface CandleSetting {
+    rangeType: 'RealBody' | 'HighLow' | 'Shadows';
+    avgPeriod: number;
+    factor: number;
+  }
+
+  /**
+   * Settings applied to a single call instead of the process wide settings
+   */
+  export interface ExecutionContext {
+    unstablePeriod?: { [functionName: string]: number }; // EMA or TA_FUNC_UNST_EMA, ALL for every function
+    compatibility?: 'default' | 'metastock' | 0 | 1;
+    candleSettings?: { [setting in 'BodyLong' | 'BodyVeryLong' | 'BodyShort' | 'BodyDoji' | 'ShadowLong' | 'ShadowVeryLong' | 'ShadowShort' | 'ShadowVeryShort' | 'Near' | 'Far' | 'Equal']?: CandleSetting };
+  }
+
   /**
    * Execute parameters
    */
   export interface ExecuteParameters extends MarketData {
-    name: string;
+    name: string | number;
     startIdx: number;
     endIdx: number;
+    output?: 'array' | 'typed';
+    outputs?: { [key: string]: Float64Array | Int32Array };
+    context?: ExecutionContext;
     [key: string]: any; // For optional parameters like optInTimePeriod
   }
 
@@ -131,6 +160,63 @@ declare module 'talib' {
     };
   }
 
+  /**
+   * Execute result when called with output: 'typed'
+   */
+  export interface TypedExecuteResult {
+    begIndex: number;
+    nbElement: number;
+    result: {
+      [key: string]: Float64Array | Int32Array;
+    };
+  }
+
+  /**
+   * Execute result when called with caller provided outputs
+   */
+  export interface OutputsExecuteResult {
+    begIndex: number;
+    nbElement: number;
+  }
+
+  /**
+   * Prepare parameters, the function name and its optional parameters
+   */
+  export interface PrepareParameters {
+    name: string | number;
+    context?: ExecutionContext;
+    [key: string]: any; // For optional parameters like optInTimePeriod
+  }
+
+  /**
+   * Prepared function execute parameters
+   */
+  export type PreparedExecuteParameters = Omit<ExecuteParameters, 'name'>;
+
+  /**
+   * Prepared function handle
+   */
+  export interface PreparedFunction {
+    readonly name: string;
+    readonly id: number;
+    readonly lookback: number;
+    execute(
+      params: PreparedExecuteParameters & { outputs: { [key: string]: Float64Array | Int32Array } },
+      callback: (err: ExecuteError | null, result?: OutputsExecuteResult) => void
+    ): void;
+    execute(
+      params: PreparedExecuteParameters & { output: 'typed' },
+      callback: (err: ExecuteError | null, result?: TypedExecuteResult) => void
+    ): void;
+    execute(
+      params: PreparedExecuteParameters,
+      callback: (err: ExecuteError | null, result?: ExecuteResult) => void
+    ): void;
+    execute(params: PreparedExecuteParameters & { outputs: { [key: string]: Float64Array | Int32Array } }): OutputsExecuteResult;
+    execute(params: PreparedExecuteParameters & { output: 'typed' }): TypedExecuteResult;
+    execute(params: PreparedExecuteParameters): ExecuteResult;
+  }
+
   /**
    * Execute error result
    */
@@ -139,9 +225,14 @@ declare module 'talib' {
   }
 
   /**
-   * Array of all available functions
+   * Array of all available functions, built once and frozen
    */
-  export const functions: FunctionExplanation[];
+  export const functions: ReadonlyArray<Readonly<FunctionExplanation>>;
+
+  /**
+   * Function explanations keyed by function name, sharing the objects of functions
+   */
+  export const functionsByName: Readonly<Record<string, Readonly<FunctionExplanation>>>;
 
   /**
    * Object containing function unstable period IDs
@@ -160,6 +251,14 @@ declare module 'talib' {
    * @param params - Execution parameters
    * @param callback - Callback function
    */
+  export function execute(
+    params: ExecuteParameters & { outputs: { [key: string]: Float64Array | Int32Array } },
+    callback: (err: ExecuteError | null, result?: OutputsExecuteResult) => void
+  ): void;
+  export function execute(
+    params: ExecuteParameters & { output: 'typed' },
+    callback: (err: ExecuteError | null, result?: TypedExecuteResult) => void
+  ): void;
   export function execute(
     params: ExecuteParameters,
     callback: (err: ExecuteError | null, result?: ExecuteResult) => void
@@ -170,8 +269,317 @@ declare module 'talib' {
    * @param params - Execution parameters
    * @returns Execution result
    */
+  export function execute(params: ExecuteParameters & { outputs: { [key: string]: Float64Array | Int32Array } }): OutputsExecuteResult;
+  export function execute(params: ExecuteParameters & { output: 'typed' }): TypedExecuteResult;
   export function execute(params: ExecuteParameters): ExecuteResult;
 
+  /**
+   * Batch function specification, its fields override the shared inputs
+   */
+  export type BatchSpec = Partial<ExecuteParameters> & { name: string | number };
+
+  /**
+   * Execute several TA-Lib functions over shared inputs (async with callback)
+   * @param inputs - Inputs and parameters shared by every function
+   * @param specs - Function specifications
+   * @param callback - Callback function receiving one result per specification
+   */
+  export function executeBatch(
+    inputs: Partial<ExecuteParameters>,
+    specs: BatchSpec[],
+    callback: (err: ExecuteError | null, results?: Array<ExecuteResult | TypedExecuteResult | OutputsExecuteResult>) => void
+  ): void;
+
+  /**
+   * Execute several TA-Lib functions over shared inputs (synchronous)
+   * @param inputs - Inputs and parameters shared by every function
+   * @param specs - Function specifications
+   * @returns One result per specification
+   */
+  export function executeBatch(
+    inputs: Partial<ExecuteParameters>,
+    specs: BatchSpec[]
+  ): Array<ExecuteResult | TypedExecuteResult | OutputsExecuteResult>;
+
+  /**
+   * Execute several TA-Lib functions over shared inputs, computing their shared intermediates once (async with callback)
+   * @param inputs - Inputs and parameters shared by every function
+   * @param specs - Function specifications
+   * @param callback - Callback function receiving one result per specification
+   */
+  export function executeGraph(
+    inputs: Partial<ExecuteParameters>,
+    specs: BatchSpec[],
+    callback: (err: ExecuteError | null, results?: Array<ExecuteResult | TypedExecuteResult | OutputsExecuteResult>) => void
+  ): void;
+
+  /**
+   * Execute several TA-Lib functions over shared inputs, computing their shared intermediates once (synchronous)
+   * @param inputs - Inputs and parameters shared by every function
+   * @param specs - Function specifications
+   * @returns One result per specification
+   */
+  export function executeGraph(
+    inputs: Partial<ExecuteParameters>,
+    specs: BatchSpec[]
+  ): Array<ExecuteResult | TypedExecuteResult | OutputsExecuteResult>;
+
+  /**
+   * Sweep parameters, the function parameters with one optional input given as an Array of values.
+   * outputs may hold a matrix per output to reuse across sweeps, result is then omitted.
+   */
+  export type SweepParameters = Omit<ExecuteParameters, 'output'>;
+
+  /**
+   * Sweep result, one column major matrix per output with a column per swept value.
+   * Row r of column j holds the result at begIndex + r for the j-th value, NaN (0 for
+   * integer outputs) outside of begIndexes[j] .. begIndexes[j] + nbElements[j] - 1.
+   * The swept values are returned under the optional input name.
+   */
+  export interface SweepResult {
+    begIndex: number;
+    nbElement: number;
+    columns: number;
+    begIndexes: number[];
+    nbElements: number[];
+    result?: {
+      [key: string]: Float64Array | Int32Array;
+    };
+    [key: string]: any;
+  }
+
+  /**
+   * Execute one function for every value of an optional input (async with callback)
+   * @param params - Sweep parameters
+   * @param callback - Callback function
+   */
+  export function sweep(
+    params: SweepParameters,
+    callback: (err: ExecuteError | null, result?: SweepResult) => void
+  ): void;
+
+  /**
+   * Execute one function for every value of an optional input (synchronous)
+   * @param params - Sweep parameters
+   * @returns Sweep result
+   */
+  export function sweep(params: SweepParameters): SweepResult;
+
+  /**
+   * Panel parameters, the function parameters plus either the series of every
+   * symbol or the number of symbols held by contiguous Float64Array columns
+   */
+  export type PanelParameters = Partial<Omit<ExecuteParameters, 'outputs'>> & { name: string | number } & (
+    | { series: Array<InputArray | Partial<MarketData> & { [key: string]: any }> }
+    | { symbols: number }
+  );
+
+  /**
+   * Execute one function for every symbol of a panel (async with callback)
+   * @param params - Panel parameters
+   * @param callback - Callback function receiving one result per symbol
+   */
+  export function executePanel(
+    params: PanelParameters,
+    callback: (err: ExecuteError | null, results?: Array<ExecuteResult | TypedExecuteResult>) => void
+  ): void;
+
+  /**
+   * Execute one function for every symbol of a panel (synchronous)
+   * @param params - Panel parameters
+   * @returns One result per symbol
+   */
+  export function executePanel(params: PanelParameters): Array<ExecuteResult | TypedExecuteResult>;
+
+  /**
+   * Set the number of native threads executing panels
+   * @param threads - Thread count, 0 restores the default of one per core less one
+   * @returns The thread count in use
+   */
+  export function setPanelThreads(threads: number): number;
+
+  /**
+   * SIMD instruction set used by the element-wise functions and price transforms
+   */
+  export type SimdLevel = 'scalar' | 'sse2' | 'avx2' | 'avx512';
+
+  /**
+   * Limit the SIMD instruction set used by ADD, SUB, MULT, DIV, SQRT, CEIL, FLOOR,
+   * AVGPRICE, MEDPRICE, TYPPRICE, WCLPRICE, TRANGE and BOP
+   * @param level - Highest level to use, 'scalar' disables the SIMD kernels
+   * @returns The level in use, at most the one supported by the CPU
+   */
+  export function setSimdLevel(level: SimdLevel): SimdLevel;
+
+  /**
+   * Get the SIMD instruction set used by the element-wise functions and price transforms
+   * @returns The level in use, detected from the CPU unless lowered
+   */
+  export function getSimdLevel(): SimdLevel;
+
+  /**
+   * Prepare a reusable handle for a TA-Lib function
+   * @param params - Function name and optional parameters
+   * @returns Prepared function handle
+   */
+  export function prepare(params: PrepareParameters): PreparedFunction;
+
+  /**
+   * Input values of the bars appended to a series
+   */
+  export type SeriesAppendParameters = MarketData & {
+    output?: 'array' | 'typed';
+    [key: string]: any; // For real inputs like inReal
+  };
+
+  /**
+   * Function series keeping its inputs and outputs as bars are appended
+   */
+  export interface Series {
+    readonly name: string;
+    readonly id: number;
+    readonly lookback: number;
+    readonly length: number;
+    /**
+     * False when every append recomputes the series from its first bar, for the functions
+     * carrying state from the start of the history
+     */
+    readonly incremental: boolean;
+    /**
+     * Append bars and compute the outputs of the new bars only
+     * @param params - Input values of the new bars and the output mode
+     * @returns The outputs of the new bars, begIndex being the index of the first one in the series
+     */
+    append(params: SeriesAppendParameters & { output: 'typed' }): TypedExecuteResult;
+    append(params: SeriesAppendParameters): ExecuteResult;
+    /**
+     * Get the outputs of every bar appended so far
+     * @param options - Output mode
+     */
+    result(options: { output: 'typed' }): TypedExecuteResult;
+    result(options?: { output?: 'array' }): ExecuteResult;
+  }
+
+  /**
+   * Create a series of a function, recomputing only the appended bars
+   * @param params - Function name, optional parameters and context
+   * @returns Series
+   */
+  export function series(params: PrepareParameters): Series;
+
+  /**
+   * Stream parameters, the function name, its optional parameters and its context
+   */
+  export type StreamParameters = PrepareParameters;
+
+  /**
+   * Incremental function state, advanced one bar at a time
+   */
+  export interface Stream {
+    readonly name: string;
+    readonly id: number;
+    readonly lookback: number;
+    /**
+     * Add a bar and get the function value for it, NaN within the lookback
+     * @param values - One value per input, price inputs take one value per price field
+     */
+    update(...values: number[]): number | { [key: string]: number };
+    /**
+     * Add a bar and write the function values for it in outputs
+     * @param args - The input values followed by a Float64Array holding one value per output
+     */
+    update(...args: [...number[], Float64Array]): Float64Array;
+    /**
+     * Save the state of the stream
+     * @returns Buffer to resume or restore the stream from
+     */
+    save(): Buffer;
+    /**
+     * Rewind the stream to a state saved from a stream of the same function
+     * @param state - Buffer returned by save
+     * @returns The stream
+     */
+    restore(state: Buffer): Stream;
+  }
+
+  /**
+   * Create an incremental stream of a function, its values are identical to execute
+   * over the whole history (EMA, DEMA, TEMA, T3, TRIX)
+   * @param name - Function name or identifier
+   * @param params - Optional parameters and context
+   * @returns Stream
+   */
+  export function stream(name: string | number, params?: Omit<StreamParameters, 'name'>): Stream;
+  export function stream(params: StreamParameters): Stream;
+  export function stream(state: Buffer): Stream;
+
+  /**
+   * Hilbert engine parameters, the MAMA limits and the context
+   */
+  export interface HilbertParameters {
+    optInFastLimit?: number;
+    optInSlowLimit?: number;
+    context?: ExecutionContext;
+  }
+
+  /**
+   * Values of the HT functions and MAMA for a bar
+   */
+  export interface HilbertValues {
+    dcPeriod: number;
+    dcPhase: number;
+    inPhase: number;
+    quadrature: number;
+    sine: number;
+    leadSine: number;
+    trendline: number;
+    trendMode: number;
+    mama: number;
+    fama: number;
+  }
+
+  /**
+   * Stream of the Hilbert transform pipeline shared by the HT functions and MAMA
+   */
+  export interface HilbertStream extends Omit<Stream, 'update' | 'id'> {
+    readonly lookbacks: { [name: string]: number };
+    update(value: number): HilbertValues;
+    update(value: number, outputs: Float64Array): Float64Array;
+  }
+
+  /**
+   * Create the Hilbert engine, its values are identical to execute of each function
+   * @param params - MAMA limits and context, or a saved engine
+   * @returns HilbertStream
+   */
+  export function hilbert(params?: HilbertParameters | Buffer): HilbertStream;
+
+  /**
+   * Candlestick engine parameters, the patterns, their penetration and the context
+   */
+  export interface CandlesParameters {
+    patterns?: string[];
+    optInPenetration?: number;
+    context?: ExecutionContext;
+  }
+
+  /**
+   * Stream of the candlestick patterns sharing the averages of the candle settings
+   */
+  export interface CandlesStream extends Omit<Stream, 'update' | 'id'> {
+    readonly patterns: string[];
+    readonly lookbacks: { [name: string]: number };
+    update(open: number, high: number, low: number, close: number): { [name: string]: number };
+    update(open: number, high: number, low: number, close: number, outputs: Float64Array): Float64Array;
+  }
+
+  /**
+   * Create the candlestick engine, its values are identical to execute of each pattern
+   * @param params - Patterns, penetration and context, or a saved engine
+   * @returns CandlesStream
+   */
+  export function candles(params?: CandlesParameters | Buffer): CandlesStream;
+
   /**
    * Set unstable period for a function
    * @param functionUnstId - Function unstable ID
@@ -16,10 +16,23 @@ const talib = require('./build/Release/talib.node');
 export const {
   version,
   functions,
+  functionsByName,
   functionUnstIds,
   explain,
   execute,
-  setUnstablePeriod
+  executeBatch,
+  executeGraph,
+  executePanel,
+  sweep,
+  prepare,
+  series,
+  stream,
+  hilbert,
+  candles,
+  setUnstablePeriod,
+  setPanelThreads,
+  setSimdLevel,
+  getSimdLevel
 } = talib;
 
 export default talib;
@@ -154,6 +154,22 @@ typedef unsigned int TA_FuncHandle;
 TA_RetCode TA_GetFuncHandle( const char *name,
                              const TA_FuncHandle **handle );
 
+/* Each function also has a numeric identifier, from 0 to the value
+ * returned by TA_GetFuncCount minus one, following the alphabetical
+ * order of TA_ForEachFunc. The identifier lets a caller keep and
+ * resolve a function without any string handling.
+ *
+ * These functions require TA_Initialize to have been called, which
+ * builds the index used to resolve names and identifiers.
+ */
+TA_RetCode TA_GetFuncCount( unsigned int *count );
+
+TA_RetCode TA_GetFuncId( const TA_FuncHandle *handle,
+                         unsigned int *funcId );
+
+TA_RetCode TA_GetFuncHandleById( unsigned int funcId,
+                                 const TA_FuncHandle **handle );
+
 /* Get some basic information about a function.
  *
  * A const pointer will be set on the corresponding TA_FuncInfo structure.
@@ -497,6 +513,25 @@ TA_RetCode TA_SetInputParamPricePtr( TA_ParamHolder *params,
                                      const TA_Real      *volume,
                                      const TA_Real      *openInterest );
 
+/* Same as TA_SetInputParamRealPtr/TA_SetInputParamPricePtr, but for
+ * single precision inputs. When the real and price inputs of a function
+ * are all set with these, TA_CallFunc calls the TA_S_XXX function
+ * directly on the float arrays. Mixing single and double precision
+ * inputs make TA_CallFunc return TA_BAD_PARAM.
+ */
+TA_RetCode TA_SetInputParamSingleRealPtr( TA_ParamHolder *params,
+                                          unsigned int paramIndex,
+                                          const float *value );
+
+TA_RetCode TA_SetInputParamSinglePricePtr( TA_ParamHolder *params,
+                                           unsigned int paramIndex,
+                                           const float        *open,
+                                           const float        *high,
+                                           const float        *low,
+                                           const float        *close,
+                                           const float        *volume,
+                                           const float        *openInterest );
+
 /* Setup the values of the optional input parameters.
  * If an optional input is not set, a default value will be used.
  *
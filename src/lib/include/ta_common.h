@@ -143,6 +143,28 @@ void TA_SetRetCodeInfo( TA_RetCode theRetCode, TA_RetCodeInfo *retCodeInfo );
 TA_RetCode TA_Initialize( void );
 TA_RetCode TA_Shutdown( void );
 
+/* The unstable periods, the compatibility and the candle settings are
+ * shared by the whole process by default. A TA_Context holds its own
+ * copy of these settings.
+ *
+ * While a context is active on a thread, the TA functions called from
+ * that thread use the settings of the context, and TA_SetUnstablePeriod,
+ * TA_SetCompatibility and TA_SetCandleSettings change the context
+ * instead of the process settings. Threads using different contexts can
+ * therefore call the TA functions concurrently with different settings.
+ *
+ * TA_ContextAlloc() copies the settings in effect on the calling thread.
+ * TA_SetThreadContext( NULL ) returns the thread to the process settings.
+ * A context must not be freed while it is active on a thread.
+ */
+typedef struct TA_Context TA_Context;
+
+TA_RetCode TA_ContextAlloc( TA_Context **context );
+TA_RetCode TA_ContextFree( TA_Context *context );
+
+TA_RetCode TA_SetThreadContext( TA_Context *context );
+TA_Context *TA_GetThreadContext( void );
+
 #ifdef __cplusplus
 }
 #endif
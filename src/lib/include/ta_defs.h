@@ -242,6 +242,13 @@ ENUM_BEGIN( Compatibility )
     ENUM_DEFINE( TA_COMPATIBILITY_METASTOCK, Metastock )
 ENUM_END( Compatibility )
 
+ENUM_BEGIN( SimdLevel )
+    ENUM_DEFINE( TA_SIMD_SCALAR, Scalar ),
+    ENUM_DEFINE( TA_SIMD_SSE2,   Sse2   ),
+    ENUM_DEFINE( TA_SIMD_AVX2,   Avx2   ),
+    ENUM_DEFINE( TA_SIMD_AVX512, Avx512 )
+ENUM_END( SimdLevel )
+
 ENUM_BEGIN( MAType )
    ENUM_DEFINE( TA_MAType_SMA,   Sma   ) =0,
    ENUM_DEFINE( TA_MAType_EMA,   Ema   ) =1,
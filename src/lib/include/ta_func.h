@@ -3145,6 +3145,46 @@ TA_RetCode TA_S_LINEARREG( int    startIdx,
 int TA_LINEARREG_Lookback( int           optInTimePeriod );  /* From 2 to 100000 */
 
 
+/*
+ * TA_LINEARREG_ALL - Linear Regression Slope, Intercept, Angle, Value and Time Series Forecast
+ * 
+ * Input  = double
+ * Output = double, double, double, double, double
+ * 
+ * Optional Parameters
+ * -------------------
+ * optInTimePeriod:(From 2 to 100000)
+ *    Number of period
+ * 
+ * 
+ */
+TA_RetCode TA_LINEARREG_ALL( int    startIdx,
+                             int    endIdx,
+                             const double inReal[],
+                             int           optInTimePeriod, /* From 2 to 100000 */
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double        outSlope[],
+                             double        outIntercept[],
+                             double        outAngle[],
+                             double        outLinearReg[],
+                             double        outTSF[] );
+
+TA_RetCode TA_S_LINEARREG_ALL( int    startIdx,
+                               int    endIdx,
+                               const float  inReal[],
+                               int           optInTimePeriod, /* From 2 to 100000 */
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double        outSlope[],
+                               double        outIntercept[],
+                               double        outAngle[],
+                               double        outLinearReg[],
+                               double        outTSF[] );
+
+int TA_LINEARREG_ALL_Lookback( int           optInTimePeriod );  /* From 2 to 100000 */
+
+
 /*
  * TA_LINEARREG_ANGLE - Linear Regression Angle
  * 
@@ -5334,6 +5374,25 @@ TA_RetCode TA_SetCandleSettings( TA_CandleSettingType settingType,
  */
 TA_RetCode TA_RestoreCandleDefaultSettings( TA_CandleSettingType settingType );
 
+/* Call TA_GetCandleSettings to retrieve the rangeType, avgPeriod 
+ * and factor currently used for the specified settingType
+ */
+TA_RetCode TA_GetCandleSettings( TA_CandleSettingType settingType, 
+                                 TA_RangeType *rangeType, 
+                                 int *avgPeriod, 
+                                 double *factor );
+
+/* ADD, SUB, MULT, DIV, SQRT, CEIL, FLOOR and the price transforms
+ * AVGPRICE, MEDPRICE, TYPPRICE, WCLPRICE, TRANGE and BOP use SIMD
+ * kernels chosen at runtime from the CPU features. TA_GetSimdLevel returns
+ * the instruction set in use, TA_SetSimdLevel lowers it (TA_SIMD_SCALAR
+ * disables the kernels). A level above what the CPU and OS support
+ * is reduced to the highest supported one. Results are the same
+ * for every level.
+ */
+TA_RetCode TA_SetSimdLevel( TA_SimdLevel value );
+TA_SimdLevel TA_GetSimdLevel( void );
+
 #ifdef __cplusplus
 }
 #endif
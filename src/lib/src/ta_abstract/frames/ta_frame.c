@@ -79,6 +79,25 @@
 /* Generated */ {
 /* Generated */    return TA_ACCBANDS_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_ACCBANDS_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_ACCBANDS(
+/* Generated */                    startIdx,
+/* Generated */                    endIdx,
+/* Generated */                    params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                    params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                    params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                    params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                    outBegIdx, 
+/* Generated */                    outNBElement, 
+/* Generated */                    params->out[0].data.outReal, /*  outRealUpperBand */
+/* Generated */                    params->out[1].data.outReal, /*  outRealMiddleBand */
+/* Generated */                    params->out[2].data.outReal /*  outRealLowerBand */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_ACOS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -98,6 +117,20 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_ACOS_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_ACOS_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_ACOS(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                params->in[0].data.inRealS, /* inReal */
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_AD_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -120,6 +153,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_AD_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_AD_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_AD(
+/* Generated */              startIdx,
+/* Generated */              endIdx,
+/* Generated */              params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */              params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */              params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */              params->in[0].data.inPriceS.volume, /* inVolume */
+/* Generated */              outBegIdx, 
+/* Generated */              outNBElement, 
+/* Generated */              params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_ADD_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -140,6 +190,21 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_ADD_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_ADD_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_ADD(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inRealS, /* inReal0 */
+/* Generated */               params->in[1].data.inRealS, /* inReal1 */
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_ADOSC_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -164,6 +229,25 @@
 /* Generated */    return TA_ADOSC_Lookback(params->optIn[0].data.optInInteger, /* optInFastPeriod*/
 /* Generated */                       params->optIn[1].data.optInInteger /* optInSlowPeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_ADOSC_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_ADOSC(
+/* Generated */                 startIdx,
+/* Generated */                 endIdx,
+/* Generated */                 params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                 params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                 params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                 params->in[0].data.inPriceS.volume, /* inVolume */
+/* Generated */                 params->optIn[0].data.optInInteger, /* optInFastPeriod*/
+/* Generated */                 params->optIn[1].data.optInInteger, /* optInSlowPeriod*/
+/* Generated */                 outBegIdx, 
+/* Generated */                 outNBElement, 
+/* Generated */                 params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_ADX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -185,6 +269,23 @@
 /* Generated */ {
 /* Generated */    return TA_ADX_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_ADX_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_ADX(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */               params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */               params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */               params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_ADXR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -206,6 +307,23 @@
 /* Generated */ {
 /* Generated */    return TA_ADXR_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_ADXR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_ADXR(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_APO_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -229,6 +347,23 @@
 /* Generated */                     params->optIn[1].data.optInInteger, /* optInSlowPeriod*/
 /* Generated */                     (TA_MAType)params->optIn[2].data.optInInteger /* optInMAType*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_APO_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_APO(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inRealS, /* inReal */
+/* Generated */               params->optIn[0].data.optInInteger, /* optInFastPeriod*/
+/* Generated */               params->optIn[1].data.optInInteger, /* optInSlowPeriod*/
+/* Generated */               (TA_MAType)params->optIn[2].data.optInInteger, /* optInMAType*/
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_AROON_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -250,6 +385,23 @@
 /* Generated */ {
 /* Generated */    return TA_AROON_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_AROON_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_AROON(
+/* Generated */                 startIdx,
+/* Generated */                 endIdx,
+/* Generated */                 params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                 params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                 params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                 outBegIdx, 
+/* Generated */                 outNBElement, 
+/* Generated */                 params->out[0].data.outReal, /*  outAroonDown */
+/* Generated */                 params->out[1].data.outReal /*  outAroonUp */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_AROONOSC_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -270,6 +422,22 @@
 /* Generated */ {
 /* Generated */    return TA_AROONOSC_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_AROONOSC_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_AROONOSC(
+/* Generated */                    startIdx,
+/* Generated */                    endIdx,
+/* Generated */                    params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                    params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                    params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                    outBegIdx, 
+/* Generated */                    outNBElement, 
+/* Generated */                    params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_ASIN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -289,6 +457,20 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_ASIN_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_ASIN_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_ASIN(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                params->in[0].data.inRealS, /* inReal */
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_ATAN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -308,6 +490,20 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_ATAN_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_ATAN_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_ATAN(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                params->in[0].data.inRealS, /* inReal */
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_ATR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -329,6 +525,23 @@
 /* Generated */ {
 /* Generated */    return TA_ATR_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_ATR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_ATR(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */               params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */               params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */               params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_AVGPRICE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -351,6 +564,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_AVGPRICE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_AVGPRICE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_AVGPRICE(
+/* Generated */                    startIdx,
+/* Generated */                    endIdx,
+/* Generated */                    params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                    params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                    params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                    params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                    outBegIdx, 
+/* Generated */                    outNBElement, 
+/* Generated */                    params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_AVGDEV_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -370,6 +600,21 @@
 /* Generated */ {
 /* Generated */    return TA_AVGDEV_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_AVGDEV_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_AVGDEV(
+/* Generated */                  startIdx,
+/* Generated */                  endIdx,
+/* Generated */                  params->in[0].data.inRealS, /* inReal */
+/* Generated */                  params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                  outBegIdx, 
+/* Generated */                  outNBElement, 
+/* Generated */                  params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_BBANDS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -397,6 +642,26 @@
 /* Generated */                        params->optIn[2].data.optInReal, /* optInNbDevDn*/
 /* Generated */                        (TA_MAType)params->optIn[3].data.optInInteger /* optInMAType*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_BBANDS_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_BBANDS(
+/* Generated */                  startIdx,
+/* Generated */                  endIdx,
+/* Generated */                  params->in[0].data.inRealS, /* inReal */
+/* Generated */                  params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                  params->optIn[1].data.optInReal, /* optInNbDevUp*/
+/* Generated */                  params->optIn[2].data.optInReal, /* optInNbDevDn*/
+/* Generated */                  (TA_MAType)params->optIn[3].data.optInInteger, /* optInMAType*/
+/* Generated */                  outBegIdx, 
+/* Generated */                  outNBElement, 
+/* Generated */                  params->out[0].data.outReal, /*  outRealUpperBand */
+/* Generated */                  params->out[1].data.outReal, /*  outRealMiddleBand */
+/* Generated */                  params->out[2].data.outReal /*  outRealLowerBand */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_BETA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -417,6 +682,22 @@
 /* Generated */ {
 /* Generated */    return TA_BETA_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_BETA_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_BETA(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                params->in[0].data.inRealS, /* inReal0 */
+/* Generated */                params->in[1].data.inRealS, /* inReal1 */
+/* Generated */                params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_BOP_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -439,6 +720,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_BOP_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_BOP_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_BOP(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */               params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */               params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */               params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CCI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -460,6 +758,23 @@
 /* Generated */ {
 /* Generated */    return TA_CCI_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CCI_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CCI(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */               params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */               params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */               params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDL2CROWS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -482,6 +797,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDL2CROWS_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDL2CROWS_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDL2CROWS(
+/* Generated */                     startIdx,
+/* Generated */                     endIdx,
+/* Generated */                     params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                     params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                     params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                     params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                     outBegIdx, 
+/* Generated */                     outNBElement, 
+/* Generated */                     params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDL3BLACKCROWS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -504,6 +836,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDL3BLACKCROWS_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDL3BLACKCROWS_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDL3BLACKCROWS(
+/* Generated */                          startIdx,
+/* Generated */                          endIdx,
+/* Generated */                          params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                          params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                          params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                          params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                          outBegIdx, 
+/* Generated */                          outNBElement, 
+/* Generated */                          params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDL3INSIDE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -526,6 +875,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDL3INSIDE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDL3INSIDE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDL3INSIDE(
+/* Generated */                      startIdx,
+/* Generated */                      endIdx,
+/* Generated */                      params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                      params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                      params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                      params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                      outBegIdx, 
+/* Generated */                      outNBElement, 
+/* Generated */                      params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDL3LINESTRIKE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -548,14 +914,31 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDL3LINESTRIKE_Lookback( );
 /* Generated */ }
-/* Generated */ TA_RetCode TA_CDL3OUTSIDE_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */ TA_RetCode TA_CDL3LINESTRIKE_FramePPS( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
 /* Generated */                           int           *outBegIdx,
 /* Generated */                           int           *outNBElement )
 /* Generated */ {
-/* Generated */    return TA_CDL3OUTSIDE(
-/* Generated */                     startIdx,
+/* Generated */    return TA_S_CDL3LINESTRIKE(
+/* Generated */                          startIdx,
+/* Generated */                          endIdx,
+/* Generated */                          params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                          params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                          params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                          params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                          outBegIdx, 
+/* Generated */                          outNBElement, 
+/* Generated */                          params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
+/* Generated */ TA_RetCode TA_CDL3OUTSIDE_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_CDL3OUTSIDE(
+/* Generated */                     startIdx,
 /* Generated */                     endIdx,
 /* Generated */                     params->in[0].data.inPrice.open, /* inOpen */
 /* Generated */                     params->in[0].data.inPrice.high, /* inHigh */
@@ -570,6 +953,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDL3OUTSIDE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDL3OUTSIDE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDL3OUTSIDE(
+/* Generated */                       startIdx,
+/* Generated */                       endIdx,
+/* Generated */                       params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                       params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                       params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                       params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                       outBegIdx, 
+/* Generated */                       outNBElement, 
+/* Generated */                       params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDL3STARSINSOUTH_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -592,6 +992,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDL3STARSINSOUTH_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDL3STARSINSOUTH_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDL3STARSINSOUTH(
+/* Generated */                            startIdx,
+/* Generated */                            endIdx,
+/* Generated */                            params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                            params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                            params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                            params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                            outBegIdx, 
+/* Generated */                            outNBElement, 
+/* Generated */                            params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDL3WHITESOLDIERS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -614,6 +1031,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDL3WHITESOLDIERS_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDL3WHITESOLDIERS_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDL3WHITESOLDIERS(
+/* Generated */                             startIdx,
+/* Generated */                             endIdx,
+/* Generated */                             params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                             params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                             params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                             params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                             outBegIdx, 
+/* Generated */                             outNBElement, 
+/* Generated */                             params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLABANDONEDBABY_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -636,6 +1070,24 @@
 /* Generated */ {
 /* Generated */    return TA_CDLABANDONEDBABY_Lookback(params->optIn[0].data.optInReal /* optInPenetration*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLABANDONEDBABY_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLABANDONEDBABY(
+/* Generated */                            startIdx,
+/* Generated */                            endIdx,
+/* Generated */                            params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                            params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                            params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                            params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                            params->optIn[0].data.optInReal, /* optInPenetration*/
+/* Generated */                            outBegIdx, 
+/* Generated */                            outNBElement, 
+/* Generated */                            params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLADVANCEBLOCK_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -658,6 +1110,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLADVANCEBLOCK_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLADVANCEBLOCK_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLADVANCEBLOCK(
+/* Generated */                           startIdx,
+/* Generated */                           endIdx,
+/* Generated */                           params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                           params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                           params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                           params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                           outBegIdx, 
+/* Generated */                           outNBElement, 
+/* Generated */                           params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLBELTHOLD_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -680,6 +1149,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLBELTHOLD_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLBELTHOLD_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLBELTHOLD(
+/* Generated */                       startIdx,
+/* Generated */                       endIdx,
+/* Generated */                       params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                       params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                       params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                       params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                       outBegIdx, 
+/* Generated */                       outNBElement, 
+/* Generated */                       params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLBREAKAWAY_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -702,6 +1188,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLBREAKAWAY_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLBREAKAWAY_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLBREAKAWAY(
+/* Generated */                        startIdx,
+/* Generated */                        endIdx,
+/* Generated */                        params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                        params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                        params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                        params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                        outBegIdx, 
+/* Generated */                        outNBElement, 
+/* Generated */                        params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLCLOSINGMARUBOZU_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -724,6 +1227,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLCLOSINGMARUBOZU_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLCLOSINGMARUBOZU_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLCLOSINGMARUBOZU(
+/* Generated */                              startIdx,
+/* Generated */                              endIdx,
+/* Generated */                              params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                              params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                              params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                              params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                              outBegIdx, 
+/* Generated */                              outNBElement, 
+/* Generated */                              params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLCONCEALBABYSWALL_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -746,6 +1266,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLCONCEALBABYSWALL_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLCONCEALBABYSWALL_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLCONCEALBABYSWALL(
+/* Generated */                               startIdx,
+/* Generated */                               endIdx,
+/* Generated */                               params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                               params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                               params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                               params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                               outBegIdx, 
+/* Generated */                               outNBElement, 
+/* Generated */                               params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLCOUNTERATTACK_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -768,6 +1305,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLCOUNTERATTACK_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLCOUNTERATTACK_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLCOUNTERATTACK(
+/* Generated */                            startIdx,
+/* Generated */                            endIdx,
+/* Generated */                            params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                            params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                            params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                            params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                            outBegIdx, 
+/* Generated */                            outNBElement, 
+/* Generated */                            params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLDARKCLOUDCOVER_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -790,6 +1344,24 @@
 /* Generated */ {
 /* Generated */    return TA_CDLDARKCLOUDCOVER_Lookback(params->optIn[0].data.optInReal /* optInPenetration*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLDARKCLOUDCOVER_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLDARKCLOUDCOVER(
+/* Generated */                             startIdx,
+/* Generated */                             endIdx,
+/* Generated */                             params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                             params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                             params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                             params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                             params->optIn[0].data.optInReal, /* optInPenetration*/
+/* Generated */                             outBegIdx, 
+/* Generated */                             outNBElement, 
+/* Generated */                             params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLDOJI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -812,6 +1384,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLDOJI_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLDOJI_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLDOJI(
+/* Generated */                   startIdx,
+/* Generated */                   endIdx,
+/* Generated */                   params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                   params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                   params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                   params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                   outBegIdx, 
+/* Generated */                   outNBElement, 
+/* Generated */                   params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLDOJISTAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -834,6 +1423,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLDOJISTAR_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLDOJISTAR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLDOJISTAR(
+/* Generated */                       startIdx,
+/* Generated */                       endIdx,
+/* Generated */                       params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                       params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                       params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                       params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                       outBegIdx, 
+/* Generated */                       outNBElement, 
+/* Generated */                       params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLDRAGONFLYDOJI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -856,6 +1462,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLDRAGONFLYDOJI_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLDRAGONFLYDOJI_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLDRAGONFLYDOJI(
+/* Generated */                            startIdx,
+/* Generated */                            endIdx,
+/* Generated */                            params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                            params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                            params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                            params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                            outBegIdx, 
+/* Generated */                            outNBElement, 
+/* Generated */                            params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLENGULFING_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -878,6 +1501,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLENGULFING_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLENGULFING_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLENGULFING(
+/* Generated */                        startIdx,
+/* Generated */                        endIdx,
+/* Generated */                        params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                        params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                        params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                        params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                        outBegIdx, 
+/* Generated */                        outNBElement, 
+/* Generated */                        params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLEVENINGDOJISTAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -900,6 +1540,24 @@
 /* Generated */ {
 /* Generated */    return TA_CDLEVENINGDOJISTAR_Lookback(params->optIn[0].data.optInReal /* optInPenetration*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLEVENINGDOJISTAR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLEVENINGDOJISTAR(
+/* Generated */                              startIdx,
+/* Generated */                              endIdx,
+/* Generated */                              params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                              params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                              params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                              params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                              params->optIn[0].data.optInReal, /* optInPenetration*/
+/* Generated */                              outBegIdx, 
+/* Generated */                              outNBElement, 
+/* Generated */                              params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLEVENINGSTAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -922,6 +1580,24 @@
 /* Generated */ {
 /* Generated */    return TA_CDLEVENINGSTAR_Lookback(params->optIn[0].data.optInReal /* optInPenetration*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLEVENINGSTAR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLEVENINGSTAR(
+/* Generated */                          startIdx,
+/* Generated */                          endIdx,
+/* Generated */                          params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                          params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                          params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                          params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                          params->optIn[0].data.optInReal, /* optInPenetration*/
+/* Generated */                          outBegIdx, 
+/* Generated */                          outNBElement, 
+/* Generated */                          params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLGAPSIDESIDEWHITE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -944,6 +1620,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLGAPSIDESIDEWHITE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLGAPSIDESIDEWHITE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLGAPSIDESIDEWHITE(
+/* Generated */                               startIdx,
+/* Generated */                               endIdx,
+/* Generated */                               params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                               params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                               params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                               params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                               outBegIdx, 
+/* Generated */                               outNBElement, 
+/* Generated */                               params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLGRAVESTONEDOJI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -966,6 +1659,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLGRAVESTONEDOJI_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLGRAVESTONEDOJI_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLGRAVESTONEDOJI(
+/* Generated */                             startIdx,
+/* Generated */                             endIdx,
+/* Generated */                             params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                             params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                             params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                             params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                             outBegIdx, 
+/* Generated */                             outNBElement, 
+/* Generated */                             params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLHAMMER_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -988,6 +1698,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLHAMMER_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLHAMMER_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLHAMMER(
+/* Generated */                     startIdx,
+/* Generated */                     endIdx,
+/* Generated */                     params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                     params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                     params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                     params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                     outBegIdx, 
+/* Generated */                     outNBElement, 
+/* Generated */                     params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLHANGINGMAN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1010,6 +1737,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLHANGINGMAN_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLHANGINGMAN_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLHANGINGMAN(
+/* Generated */                         startIdx,
+/* Generated */                         endIdx,
+/* Generated */                         params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                         params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                         params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                         params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                         outBegIdx, 
+/* Generated */                         outNBElement, 
+/* Generated */                         params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLHARAMI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1032,6 +1776,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLHARAMI_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLHARAMI_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLHARAMI(
+/* Generated */                     startIdx,
+/* Generated */                     endIdx,
+/* Generated */                     params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                     params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                     params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                     params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                     outBegIdx, 
+/* Generated */                     outNBElement, 
+/* Generated */                     params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLHARAMICROSS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1054,6 +1815,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLHARAMICROSS_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLHARAMICROSS_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLHARAMICROSS(
+/* Generated */                          startIdx,
+/* Generated */                          endIdx,
+/* Generated */                          params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                          params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                          params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                          params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                          outBegIdx, 
+/* Generated */                          outNBElement, 
+/* Generated */                          params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLHIGHWAVE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1076,18 +1854,35 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLHIGHWAVE_Lookback( );
 /* Generated */ }
-/* Generated */ TA_RetCode TA_CDLHIKKAKE_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */ TA_RetCode TA_CDLHIGHWAVE_FramePPS( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
 /* Generated */                           int           *outBegIdx,
 /* Generated */                           int           *outNBElement )
 /* Generated */ {
-/* Generated */    return TA_CDLHIKKAKE(
-/* Generated */                    startIdx,
-/* Generated */                    endIdx,
-/* Generated */                    params->in[0].data.inPrice.open, /* inOpen */
-/* Generated */                    params->in[0].data.inPrice.high, /* inHigh */
-/* Generated */                    params->in[0].data.inPrice.low, /* inLow */
+/* Generated */    return TA_S_CDLHIGHWAVE(
+/* Generated */                       startIdx,
+/* Generated */                       endIdx,
+/* Generated */                       params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                       params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                       params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                       params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                       outBegIdx, 
+/* Generated */                       outNBElement, 
+/* Generated */                       params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
+/* Generated */ TA_RetCode TA_CDLHIKKAKE_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_CDLHIKKAKE(
+/* Generated */                    startIdx,
+/* Generated */                    endIdx,
+/* Generated */                    params->in[0].data.inPrice.open, /* inOpen */
+/* Generated */                    params->in[0].data.inPrice.high, /* inHigh */
+/* Generated */                    params->in[0].data.inPrice.low, /* inLow */
 /* Generated */                    params->in[0].data.inPrice.close, /* inClose */
 /* Generated */                    outBegIdx, 
 /* Generated */                    outNBElement, 
@@ -1098,6 +1893,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLHIKKAKE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLHIKKAKE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLHIKKAKE(
+/* Generated */                      startIdx,
+/* Generated */                      endIdx,
+/* Generated */                      params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                      params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                      params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                      params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                      outBegIdx, 
+/* Generated */                      outNBElement, 
+/* Generated */                      params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLHIKKAKEMOD_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1120,6 +1932,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLHIKKAKEMOD_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLHIKKAKEMOD_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLHIKKAKEMOD(
+/* Generated */                         startIdx,
+/* Generated */                         endIdx,
+/* Generated */                         params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                         params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                         params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                         params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                         outBegIdx, 
+/* Generated */                         outNBElement, 
+/* Generated */                         params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLHOMINGPIGEON_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1142,6 +1971,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLHOMINGPIGEON_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLHOMINGPIGEON_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLHOMINGPIGEON(
+/* Generated */                           startIdx,
+/* Generated */                           endIdx,
+/* Generated */                           params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                           params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                           params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                           params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                           outBegIdx, 
+/* Generated */                           outNBElement, 
+/* Generated */                           params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLIDENTICAL3CROWS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1164,6 +2010,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLIDENTICAL3CROWS_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLIDENTICAL3CROWS_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLIDENTICAL3CROWS(
+/* Generated */                              startIdx,
+/* Generated */                              endIdx,
+/* Generated */                              params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                              params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                              params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                              params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                              outBegIdx, 
+/* Generated */                              outNBElement, 
+/* Generated */                              params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLINNECK_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1186,6 +2049,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLINNECK_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLINNECK_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLINNECK(
+/* Generated */                     startIdx,
+/* Generated */                     endIdx,
+/* Generated */                     params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                     params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                     params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                     params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                     outBegIdx, 
+/* Generated */                     outNBElement, 
+/* Generated */                     params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLINVERTEDHAMMER_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1208,6 +2088,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLINVERTEDHAMMER_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLINVERTEDHAMMER_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLINVERTEDHAMMER(
+/* Generated */                             startIdx,
+/* Generated */                             endIdx,
+/* Generated */                             params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                             params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                             params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                             params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                             outBegIdx, 
+/* Generated */                             outNBElement, 
+/* Generated */                             params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLKICKING_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1230,6 +2127,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLKICKING_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLKICKING_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLKICKING(
+/* Generated */                      startIdx,
+/* Generated */                      endIdx,
+/* Generated */                      params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                      params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                      params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                      params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                      outBegIdx, 
+/* Generated */                      outNBElement, 
+/* Generated */                      params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLKICKINGBYLENGTH_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1252,6 +2166,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLKICKINGBYLENGTH_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLKICKINGBYLENGTH_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLKICKINGBYLENGTH(
+/* Generated */                              startIdx,
+/* Generated */                              endIdx,
+/* Generated */                              params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                              params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                              params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                              params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                              outBegIdx, 
+/* Generated */                              outNBElement, 
+/* Generated */                              params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLLADDERBOTTOM_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1274,6 +2205,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLLADDERBOTTOM_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLLADDERBOTTOM_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLLADDERBOTTOM(
+/* Generated */                           startIdx,
+/* Generated */                           endIdx,
+/* Generated */                           params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                           params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                           params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                           params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                           outBegIdx, 
+/* Generated */                           outNBElement, 
+/* Generated */                           params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLLONGLEGGEDDOJI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1296,6 +2244,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLLONGLEGGEDDOJI_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLLONGLEGGEDDOJI_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLLONGLEGGEDDOJI(
+/* Generated */                             startIdx,
+/* Generated */                             endIdx,
+/* Generated */                             params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                             params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                             params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                             params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                             outBegIdx, 
+/* Generated */                             outNBElement, 
+/* Generated */                             params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLLONGLINE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1318,6 +2283,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLLONGLINE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLLONGLINE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLLONGLINE(
+/* Generated */                       startIdx,
+/* Generated */                       endIdx,
+/* Generated */                       params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                       params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                       params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                       params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                       outBegIdx, 
+/* Generated */                       outNBElement, 
+/* Generated */                       params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLMARUBOZU_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1340,6 +2322,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLMARUBOZU_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLMARUBOZU_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLMARUBOZU(
+/* Generated */                       startIdx,
+/* Generated */                       endIdx,
+/* Generated */                       params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                       params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                       params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                       params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                       outBegIdx, 
+/* Generated */                       outNBElement, 
+/* Generated */                       params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLMATCHINGLOW_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1362,6 +2361,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLMATCHINGLOW_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLMATCHINGLOW_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLMATCHINGLOW(
+/* Generated */                          startIdx,
+/* Generated */                          endIdx,
+/* Generated */                          params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                          params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                          params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                          params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                          outBegIdx, 
+/* Generated */                          outNBElement, 
+/* Generated */                          params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLMATHOLD_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1384,6 +2400,24 @@
 /* Generated */ {
 /* Generated */    return TA_CDLMATHOLD_Lookback(params->optIn[0].data.optInReal /* optInPenetration*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLMATHOLD_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLMATHOLD(
+/* Generated */                      startIdx,
+/* Generated */                      endIdx,
+/* Generated */                      params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                      params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                      params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                      params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                      params->optIn[0].data.optInReal, /* optInPenetration*/
+/* Generated */                      outBegIdx, 
+/* Generated */                      outNBElement, 
+/* Generated */                      params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLMORNINGDOJISTAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1406,6 +2440,24 @@
 /* Generated */ {
 /* Generated */    return TA_CDLMORNINGDOJISTAR_Lookback(params->optIn[0].data.optInReal /* optInPenetration*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLMORNINGDOJISTAR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLMORNINGDOJISTAR(
+/* Generated */                              startIdx,
+/* Generated */                              endIdx,
+/* Generated */                              params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                              params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                              params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                              params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                              params->optIn[0].data.optInReal, /* optInPenetration*/
+/* Generated */                              outBegIdx, 
+/* Generated */                              outNBElement, 
+/* Generated */                              params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLMORNINGSTAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1428,6 +2480,24 @@
 /* Generated */ {
 /* Generated */    return TA_CDLMORNINGSTAR_Lookback(params->optIn[0].data.optInReal /* optInPenetration*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLMORNINGSTAR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLMORNINGSTAR(
+/* Generated */                          startIdx,
+/* Generated */                          endIdx,
+/* Generated */                          params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                          params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                          params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                          params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                          params->optIn[0].data.optInReal, /* optInPenetration*/
+/* Generated */                          outBegIdx, 
+/* Generated */                          outNBElement, 
+/* Generated */                          params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLONNECK_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1450,6 +2520,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLONNECK_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLONNECK_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLONNECK(
+/* Generated */                     startIdx,
+/* Generated */                     endIdx,
+/* Generated */                     params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                     params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                     params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                     params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                     outBegIdx, 
+/* Generated */                     outNBElement, 
+/* Generated */                     params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLPIERCING_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1472,6 +2559,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLPIERCING_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLPIERCING_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLPIERCING(
+/* Generated */                       startIdx,
+/* Generated */                       endIdx,
+/* Generated */                       params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                       params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                       params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                       params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                       outBegIdx, 
+/* Generated */                       outNBElement, 
+/* Generated */                       params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLRICKSHAWMAN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1494,6 +2598,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLRICKSHAWMAN_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLRICKSHAWMAN_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLRICKSHAWMAN(
+/* Generated */                          startIdx,
+/* Generated */                          endIdx,
+/* Generated */                          params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                          params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                          params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                          params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                          outBegIdx, 
+/* Generated */                          outNBElement, 
+/* Generated */                          params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLRISEFALL3METHODS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1516,6 +2637,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLRISEFALL3METHODS_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLRISEFALL3METHODS_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLRISEFALL3METHODS(
+/* Generated */                               startIdx,
+/* Generated */                               endIdx,
+/* Generated */                               params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                               params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                               params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                               params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                               outBegIdx, 
+/* Generated */                               outNBElement, 
+/* Generated */                               params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLSEPARATINGLINES_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1538,6 +2676,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLSEPARATINGLINES_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLSEPARATINGLINES_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLSEPARATINGLINES(
+/* Generated */                              startIdx,
+/* Generated */                              endIdx,
+/* Generated */                              params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                              params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                              params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                              params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                              outBegIdx, 
+/* Generated */                              outNBElement, 
+/* Generated */                              params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLSHOOTINGSTAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1560,6 +2715,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLSHOOTINGSTAR_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLSHOOTINGSTAR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLSHOOTINGSTAR(
+/* Generated */                           startIdx,
+/* Generated */                           endIdx,
+/* Generated */                           params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                           params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                           params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                           params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                           outBegIdx, 
+/* Generated */                           outNBElement, 
+/* Generated */                           params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLSHORTLINE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1582,6 +2754,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLSHORTLINE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLSHORTLINE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLSHORTLINE(
+/* Generated */                        startIdx,
+/* Generated */                        endIdx,
+/* Generated */                        params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                        params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                        params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                        params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                        outBegIdx, 
+/* Generated */                        outNBElement, 
+/* Generated */                        params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLSPINNINGTOP_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1604,20 +2793,37 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLSPINNINGTOP_Lookback( );
 /* Generated */ }
-/* Generated */ TA_RetCode TA_CDLSTALLEDPATTERN_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */ TA_RetCode TA_CDLSPINNINGTOP_FramePPS( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
 /* Generated */                           int           *outBegIdx,
 /* Generated */                           int           *outNBElement )
 /* Generated */ {
-/* Generated */    return TA_CDLSTALLEDPATTERN(
-/* Generated */                           startIdx,
-/* Generated */                           endIdx,
-/* Generated */                           params->in[0].data.inPrice.open, /* inOpen */
-/* Generated */                           params->in[0].data.inPrice.high, /* inHigh */
-/* Generated */                           params->in[0].data.inPrice.low, /* inLow */
-/* Generated */                           params->in[0].data.inPrice.close, /* inClose */
-/* Generated */                           outBegIdx, 
+/* Generated */    return TA_S_CDLSPINNINGTOP(
+/* Generated */                          startIdx,
+/* Generated */                          endIdx,
+/* Generated */                          params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                          params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                          params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                          params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                          outBegIdx, 
+/* Generated */                          outNBElement, 
+/* Generated */                          params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
+/* Generated */ TA_RetCode TA_CDLSTALLEDPATTERN_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_CDLSTALLEDPATTERN(
+/* Generated */                           startIdx,
+/* Generated */                           endIdx,
+/* Generated */                           params->in[0].data.inPrice.open, /* inOpen */
+/* Generated */                           params->in[0].data.inPrice.high, /* inHigh */
+/* Generated */                           params->in[0].data.inPrice.low, /* inLow */
+/* Generated */                           params->in[0].data.inPrice.close, /* inClose */
+/* Generated */                           outBegIdx, 
 /* Generated */                           outNBElement, 
 /* Generated */                           params->out[0].data.outInteger /*  outInteger */ );
 /* Generated */ }
@@ -1626,6 +2832,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLSTALLEDPATTERN_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLSTALLEDPATTERN_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLSTALLEDPATTERN(
+/* Generated */                             startIdx,
+/* Generated */                             endIdx,
+/* Generated */                             params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                             params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                             params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                             params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                             outBegIdx, 
+/* Generated */                             outNBElement, 
+/* Generated */                             params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLSTICKSANDWICH_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1648,6 +2871,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLSTICKSANDWICH_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLSTICKSANDWICH_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLSTICKSANDWICH(
+/* Generated */                            startIdx,
+/* Generated */                            endIdx,
+/* Generated */                            params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                            params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                            params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                            params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                            outBegIdx, 
+/* Generated */                            outNBElement, 
+/* Generated */                            params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLTAKURI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1670,6 +2910,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLTAKURI_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLTAKURI_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLTAKURI(
+/* Generated */                     startIdx,
+/* Generated */                     endIdx,
+/* Generated */                     params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                     params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                     params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                     params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                     outBegIdx, 
+/* Generated */                     outNBElement, 
+/* Generated */                     params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLTASUKIGAP_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1692,6 +2949,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLTASUKIGAP_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLTASUKIGAP_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLTASUKIGAP(
+/* Generated */                        startIdx,
+/* Generated */                        endIdx,
+/* Generated */                        params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                        params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                        params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                        params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                        outBegIdx, 
+/* Generated */                        outNBElement, 
+/* Generated */                        params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLTHRUSTING_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1714,6 +2988,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLTHRUSTING_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLTHRUSTING_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLTHRUSTING(
+/* Generated */                        startIdx,
+/* Generated */                        endIdx,
+/* Generated */                        params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                        params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                        params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                        params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                        outBegIdx, 
+/* Generated */                        outNBElement, 
+/* Generated */                        params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLTRISTAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1736,6 +3027,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLTRISTAR_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLTRISTAR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLTRISTAR(
+/* Generated */                      startIdx,
+/* Generated */                      endIdx,
+/* Generated */                      params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                      params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                      params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                      params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                      outBegIdx, 
+/* Generated */                      outNBElement, 
+/* Generated */                      params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLUNIQUE3RIVER_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1758,6 +3066,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLUNIQUE3RIVER_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLUNIQUE3RIVER_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLUNIQUE3RIVER(
+/* Generated */                           startIdx,
+/* Generated */                           endIdx,
+/* Generated */                           params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                           params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                           params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                           params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                           outBegIdx, 
+/* Generated */                           outNBElement, 
+/* Generated */                           params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLUPSIDEGAP2CROWS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1780,6 +3105,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLUPSIDEGAP2CROWS_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLUPSIDEGAP2CROWS_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLUPSIDEGAP2CROWS(
+/* Generated */                              startIdx,
+/* Generated */                              endIdx,
+/* Generated */                              params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                              params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                              params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                              params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                              outBegIdx, 
+/* Generated */                              outNBElement, 
+/* Generated */                              params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CDLXSIDEGAP3METHODS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1802,6 +3144,23 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CDLXSIDEGAP3METHODS_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CDLXSIDEGAP3METHODS_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CDLXSIDEGAP3METHODS(
+/* Generated */                               startIdx,
+/* Generated */                               endIdx,
+/* Generated */                               params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */                               params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                               params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                               params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                               outBegIdx, 
+/* Generated */                               outNBElement, 
+/* Generated */                               params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CEIL_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1821,6 +3180,20 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_CEIL_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CEIL_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CEIL(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                params->in[0].data.inRealS, /* inReal */
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CMO_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1840,6 +3213,21 @@
 /* Generated */ {
 /* Generated */    return TA_CMO_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CMO_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CMO(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inRealS, /* inReal */
+/* Generated */               params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_CORREL_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1860,6 +3248,22 @@
 /* Generated */ {
 /* Generated */    return TA_CORREL_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_CORREL_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_CORREL(
+/* Generated */                  startIdx,
+/* Generated */                  endIdx,
+/* Generated */                  params->in[0].data.inRealS, /* inReal0 */
+/* Generated */                  params->in[1].data.inRealS, /* inReal1 */
+/* Generated */                  params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                  outBegIdx, 
+/* Generated */                  outNBElement, 
+/* Generated */                  params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_COS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1879,6 +3283,20 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_COS_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_COS_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_COS(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inRealS, /* inReal */
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_COSH_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1898,6 +3316,20 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_COSH_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_COSH_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_COSH(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                params->in[0].data.inRealS, /* inReal */
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_DEMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1917,6 +3349,21 @@
 /* Generated */ {
 /* Generated */    return TA_DEMA_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_DEMA_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_DEMA(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                params->in[0].data.inRealS, /* inReal */
+/* Generated */                params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_DIV_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1937,6 +3384,21 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_DIV_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_DIV_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_DIV(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inRealS, /* inReal0 */
+/* Generated */               params->in[1].data.inRealS, /* inReal1 */
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_DX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1958,6 +3420,23 @@
 /* Generated */ {
 /* Generated */    return TA_DX_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_DX_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_DX(
+/* Generated */              startIdx,
+/* Generated */              endIdx,
+/* Generated */              params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */              params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */              params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */              params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */              outBegIdx, 
+/* Generated */              outNBElement, 
+/* Generated */              params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_EMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1977,6 +3456,21 @@
 /* Generated */ {
 /* Generated */    return TA_EMA_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_EMA_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_EMA(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inRealS, /* inReal */
+/* Generated */               params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_EXP_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -1996,6 +3490,20 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_EXP_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_EXP_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_EXP(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inRealS, /* inReal */
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_FLOOR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2015,6 +3523,20 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_FLOOR_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_FLOOR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_FLOOR(
+/* Generated */                 startIdx,
+/* Generated */                 endIdx,
+/* Generated */                 params->in[0].data.inRealS, /* inReal */
+/* Generated */                 outBegIdx, 
+/* Generated */                 outNBElement, 
+/* Generated */                 params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_HT_DCPERIOD_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2034,6 +3556,20 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_HT_DCPERIOD_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_HT_DCPERIOD_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_HT_DCPERIOD(
+/* Generated */                       startIdx,
+/* Generated */                       endIdx,
+/* Generated */                       params->in[0].data.inRealS, /* inReal */
+/* Generated */                       outBegIdx, 
+/* Generated */                       outNBElement, 
+/* Generated */                       params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_HT_DCPHASE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2053,6 +3589,20 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_HT_DCPHASE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_HT_DCPHASE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_HT_DCPHASE(
+/* Generated */                      startIdx,
+/* Generated */                      endIdx,
+/* Generated */                      params->in[0].data.inRealS, /* inReal */
+/* Generated */                      outBegIdx, 
+/* Generated */                      outNBElement, 
+/* Generated */                      params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_HT_PHASOR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2073,6 +3623,21 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_HT_PHASOR_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_HT_PHASOR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_HT_PHASOR(
+/* Generated */                     startIdx,
+/* Generated */                     endIdx,
+/* Generated */                     params->in[0].data.inRealS, /* inReal */
+/* Generated */                     outBegIdx, 
+/* Generated */                     outNBElement, 
+/* Generated */                     params->out[0].data.outReal, /*  outInPhase */
+/* Generated */                     params->out[1].data.outReal /*  outQuadrature */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_HT_SINE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2093,6 +3658,21 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_HT_SINE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_HT_SINE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_HT_SINE(
+/* Generated */                   startIdx,
+/* Generated */                   endIdx,
+/* Generated */                   params->in[0].data.inRealS, /* inReal */
+/* Generated */                   outBegIdx, 
+/* Generated */                   outNBElement, 
+/* Generated */                   params->out[0].data.outReal, /*  outSine */
+/* Generated */                   params->out[1].data.outReal /*  outLeadSine */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_HT_TRENDLINE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2112,6 +3692,20 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_HT_TRENDLINE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_HT_TRENDLINE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_HT_TRENDLINE(
+/* Generated */                        startIdx,
+/* Generated */                        endIdx,
+/* Generated */                        params->in[0].data.inRealS, /* inReal */
+/* Generated */                        outBegIdx, 
+/* Generated */                        outNBElement, 
+/* Generated */                        params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_HT_TRENDMODE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2131,6 +3725,20 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_HT_TRENDMODE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_HT_TRENDMODE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_HT_TRENDMODE(
+/* Generated */                        startIdx,
+/* Generated */                        endIdx,
+/* Generated */                        params->in[0].data.inRealS, /* inReal */
+/* Generated */                        outBegIdx, 
+/* Generated */                        outNBElement, 
+/* Generated */                        params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_IMI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2151,6 +3759,22 @@
 /* Generated */ {
 /* Generated */    return TA_IMI_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_IMI_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_IMI(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inPriceS.open, /* inOpen */
+/* Generated */               params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */               params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_KAMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2170,6 +3794,21 @@
 /* Generated */ {
 /* Generated */    return TA_KAMA_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_KAMA_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_KAMA(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                params->in[0].data.inRealS, /* inReal */
+/* Generated */                params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_LINEARREG_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2189,6 +3828,63 @@
 /* Generated */ {
 /* Generated */    return TA_LINEARREG_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_LINEARREG_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_LINEARREG(
+/* Generated */                     startIdx,
+/* Generated */                     endIdx,
+/* Generated */                     params->in[0].data.inRealS, /* inReal */
+/* Generated */                     params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                     outBegIdx, 
+/* Generated */                     outNBElement, 
+/* Generated */                     params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
+/* Generated */ TA_RetCode TA_LINEARREG_ALL_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_LINEARREG_ALL(
+/* Generated */                            startIdx,
+/* Generated */                            endIdx,
+/* Generated */                            params->in[0].data.inReal, /* inReal */
+/* Generated */                            params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                            outBegIdx, 
+/* Generated */                            outNBElement, 
+/* Generated */                            params->out[0].data.outReal, /*  outSlope */
+/* Generated */                            params->out[1].data.outReal, /*  outIntercept */
+/* Generated */                            params->out[2].data.outReal, /*  outAngle */
+/* Generated */                            params->out[3].data.outReal, /*  outLinearReg */
+/* Generated */                            params->out[4].data.outReal /*  outTSF */ );
+/* Generated */ }
+/* Generated */ unsigned int TA_LINEARREG_ALL_FramePPLB( const TA_ParamHolderPriv *params )
+/* Generated */ {
+/* Generated */    return TA_LINEARREG_ALL_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
+/* Generated */ }
+/* Generated */ TA_RetCode TA_LINEARREG_ALL_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_LINEARREG_ALL(
+/* Generated */                              startIdx,
+/* Generated */                              endIdx,
+/* Generated */                              params->in[0].data.inRealS, /* inReal */
+/* Generated */                              params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                              outBegIdx, 
+/* Generated */                              outNBElement, 
+/* Generated */                              params->out[0].data.outReal, /*  outSlope */
+/* Generated */                              params->out[1].data.outReal, /*  outIntercept */
+/* Generated */                              params->out[2].data.outReal, /*  outAngle */
+/* Generated */                              params->out[3].data.outReal, /*  outLinearReg */
+/* Generated */                              params->out[4].data.outReal /*  outTSF */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_LINEARREG_ANGLE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2208,6 +3904,21 @@
 /* Generated */ {
 /* Generated */    return TA_LINEARREG_ANGLE_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_LINEARREG_ANGLE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_LINEARREG_ANGLE(
+/* Generated */                           startIdx,
+/* Generated */                           endIdx,
+/* Generated */                           params->in[0].data.inRealS, /* inReal */
+/* Generated */                           params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                           outBegIdx, 
+/* Generated */                           outNBElement, 
+/* Generated */                           params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_LINEARREG_INTERCEPT_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2227,6 +3938,21 @@
 /* Generated */ {
 /* Generated */    return TA_LINEARREG_INTERCEPT_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_LINEARREG_INTERCEPT_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_LINEARREG_INTERCEPT(
+/* Generated */                               startIdx,
+/* Generated */                               endIdx,
+/* Generated */                               params->in[0].data.inRealS, /* inReal */
+/* Generated */                               params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                               outBegIdx, 
+/* Generated */                               outNBElement, 
+/* Generated */                               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_LINEARREG_SLOPE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2246,6 +3972,21 @@
 /* Generated */ {
 /* Generated */    return TA_LINEARREG_SLOPE_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_LINEARREG_SLOPE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_LINEARREG_SLOPE(
+/* Generated */                           startIdx,
+/* Generated */                           endIdx,
+/* Generated */                           params->in[0].data.inRealS, /* inReal */
+/* Generated */                           params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                           outBegIdx, 
+/* Generated */                           outNBElement, 
+/* Generated */                           params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_LN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2265,6 +4006,20 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_LN_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_LN_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_LN(
+/* Generated */              startIdx,
+/* Generated */              endIdx,
+/* Generated */              params->in[0].data.inRealS, /* inReal */
+/* Generated */              outBegIdx, 
+/* Generated */              outNBElement, 
+/* Generated */              params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_LOG10_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2284,6 +4039,20 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_LOG10_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_LOG10_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_LOG10(
+/* Generated */                 startIdx,
+/* Generated */                 endIdx,
+/* Generated */                 params->in[0].data.inRealS, /* inReal */
+/* Generated */                 outBegIdx, 
+/* Generated */                 outNBElement, 
+/* Generated */                 params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2305,6 +4074,22 @@
 /* Generated */    return TA_MA_Lookback(params->optIn[0].data.optInInteger, /* optInTimePeriod*/
 /* Generated */                    (TA_MAType)params->optIn[1].data.optInInteger /* optInMAType*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MA_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_MA(
+/* Generated */              startIdx,
+/* Generated */              endIdx,
+/* Generated */              params->in[0].data.inRealS, /* inReal */
+/* Generated */              params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */              (TA_MAType)params->optIn[1].data.optInInteger, /* optInMAType*/
+/* Generated */              outBegIdx, 
+/* Generated */              outNBElement, 
+/* Generated */              params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MACD_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2330,6 +4115,25 @@
 /* Generated */                      params->optIn[1].data.optInInteger, /* optInSlowPeriod*/
 /* Generated */                      params->optIn[2].data.optInInteger /* optInSignalPeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MACD_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_MACD(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                params->in[0].data.inRealS, /* inReal */
+/* Generated */                params->optIn[0].data.optInInteger, /* optInFastPeriod*/
+/* Generated */                params->optIn[1].data.optInInteger, /* optInSlowPeriod*/
+/* Generated */                params->optIn[2].data.optInInteger, /* optInSignalPeriod*/
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                params->out[0].data.outReal, /*  outMACD */
+/* Generated */                params->out[1].data.outReal, /*  outMACDSignal */
+/* Generated */                params->out[2].data.outReal /*  outMACDHist */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MACDEXT_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2361,6 +4165,28 @@
 /* Generated */                         params->optIn[4].data.optInInteger, /* optInSignalPeriod*/
 /* Generated */                         (TA_MAType)params->optIn[5].data.optInInteger /* optInSignalMAType*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MACDEXT_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_MACDEXT(
+/* Generated */                   startIdx,
+/* Generated */                   endIdx,
+/* Generated */                   params->in[0].data.inRealS, /* inReal */
+/* Generated */                   params->optIn[0].data.optInInteger, /* optInFastPeriod*/
+/* Generated */                   (TA_MAType)params->optIn[1].data.optInInteger, /* optInFastMAType*/
+/* Generated */                   params->optIn[2].data.optInInteger, /* optInSlowPeriod*/
+/* Generated */                   (TA_MAType)params->optIn[3].data.optInInteger, /* optInSlowMAType*/
+/* Generated */                   params->optIn[4].data.optInInteger, /* optInSignalPeriod*/
+/* Generated */                   (TA_MAType)params->optIn[5].data.optInInteger, /* optInSignalMAType*/
+/* Generated */                   outBegIdx, 
+/* Generated */                   outNBElement, 
+/* Generated */                   params->out[0].data.outReal, /*  outMACD */
+/* Generated */                   params->out[1].data.outReal, /*  outMACDSignal */
+/* Generated */                   params->out[2].data.outReal /*  outMACDHist */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MACDFIX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2382,6 +4208,23 @@
 /* Generated */ {
 /* Generated */    return TA_MACDFIX_Lookback(params->optIn[0].data.optInInteger /* optInSignalPeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MACDFIX_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_MACDFIX(
+/* Generated */                   startIdx,
+/* Generated */                   endIdx,
+/* Generated */                   params->in[0].data.inRealS, /* inReal */
+/* Generated */                   params->optIn[0].data.optInInteger, /* optInSignalPeriod*/
+/* Generated */                   outBegIdx, 
+/* Generated */                   outNBElement, 
+/* Generated */                   params->out[0].data.outReal, /*  outMACD */
+/* Generated */                   params->out[1].data.outReal, /*  outMACDSignal */
+/* Generated */                   params->out[2].data.outReal /*  outMACDHist */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MAMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2404,6 +4247,23 @@
 /* Generated */    return TA_MAMA_Lookback(params->optIn[0].data.optInReal, /* optInFastLimit*/
 /* Generated */                      params->optIn[1].data.optInReal /* optInSlowLimit*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MAMA_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_MAMA(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                params->in[0].data.inRealS, /* inReal */
+/* Generated */                params->optIn[0].data.optInReal, /* optInFastLimit*/
+/* Generated */                params->optIn[1].data.optInReal, /* optInSlowLimit*/
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                params->out[0].data.outReal, /*  outMAMA */
+/* Generated */                params->out[1].data.outReal /*  outFAMA */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MAVP_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2428,6 +4288,24 @@
 /* Generated */                      params->optIn[1].data.optInInteger, /* optInMaxPeriod*/
 /* Generated */                      (TA_MAType)params->optIn[2].data.optInInteger /* optInMAType*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MAVP_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_MAVP(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                params->in[0].data.inRealS, /* inReal */
+/* Generated */                params->in[1].data.inRealS, /* inPeriods */
+/* Generated */                params->optIn[0].data.optInInteger, /* optInMinPeriod*/
+/* Generated */                params->optIn[1].data.optInInteger, /* optInMaxPeriod*/
+/* Generated */                (TA_MAType)params->optIn[2].data.optInInteger, /* optInMAType*/
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MAX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2447,6 +4325,21 @@
 /* Generated */ {
 /* Generated */    return TA_MAX_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MAX_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_MAX(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inRealS, /* inReal */
+/* Generated */               params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MAXINDEX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2466,6 +4359,21 @@
 /* Generated */ {
 /* Generated */    return TA_MAXINDEX_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MAXINDEX_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_MAXINDEX(
+/* Generated */                    startIdx,
+/* Generated */                    endIdx,
+/* Generated */                    params->in[0].data.inRealS, /* inReal */
+/* Generated */                    params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                    outBegIdx, 
+/* Generated */                    outNBElement, 
+/* Generated */                    params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MEDPRICE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2486,6 +4394,21 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_MEDPRICE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MEDPRICE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_MEDPRICE(
+/* Generated */                    startIdx,
+/* Generated */                    endIdx,
+/* Generated */                    params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                    params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                    outBegIdx, 
+/* Generated */                    outNBElement, 
+/* Generated */                    params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MFI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2508,6 +4431,24 @@
 /* Generated */ {
 /* Generated */    return TA_MFI_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MFI_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_MFI(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */               params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */               params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */               params->in[0].data.inPriceS.volume, /* inVolume */
+/* Generated */               params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MIDPOINT_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2527,15 +4468,30 @@
 /* Generated */ {
 /* Generated */    return TA_MIDPOINT_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
-/* Generated */ TA_RetCode TA_MIDPRICE_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */ TA_RetCode TA_MIDPOINT_FramePPS( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
 /* Generated */                           int           *outBegIdx,
 /* Generated */                           int           *outNBElement )
 /* Generated */ {
-/* Generated */    return TA_MIDPRICE(
-/* Generated */                  startIdx,
-/* Generated */                  endIdx,
+/* Generated */    return TA_S_MIDPOINT(
+/* Generated */                    startIdx,
+/* Generated */                    endIdx,
+/* Generated */                    params->in[0].data.inRealS, /* inReal */
+/* Generated */                    params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                    outBegIdx, 
+/* Generated */                    outNBElement, 
+/* Generated */                    params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
+/* Generated */ TA_RetCode TA_MIDPRICE_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_MIDPRICE(
+/* Generated */                  startIdx,
+/* Generated */                  endIdx,
 /* Generated */                  params->in[0].data.inPrice.high, /* inHigh */
 /* Generated */                  params->in[0].data.inPrice.low, /* inLow */
 /* Generated */                  params->optIn[0].data.optInInteger, /* optInTimePeriod*/
@@ -2547,6 +4503,22 @@
 /* Generated */ {
 /* Generated */    return TA_MIDPRICE_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MIDPRICE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_MIDPRICE(
+/* Generated */                    startIdx,
+/* Generated */                    endIdx,
+/* Generated */                    params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                    params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                    params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                    outBegIdx, 
+/* Generated */                    outNBElement, 
+/* Generated */                    params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MIN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2566,6 +4538,21 @@
 /* Generated */ {
 /* Generated */    return TA_MIN_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MIN_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_MIN(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inRealS, /* inReal */
+/* Generated */               params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MININDEX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2585,6 +4572,21 @@
 /* Generated */ {
 /* Generated */    return TA_MININDEX_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MININDEX_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_MININDEX(
+/* Generated */                    startIdx,
+/* Generated */                    endIdx,
+/* Generated */                    params->in[0].data.inRealS, /* inReal */
+/* Generated */                    params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                    outBegIdx, 
+/* Generated */                    outNBElement, 
+/* Generated */                    params->out[0].data.outInteger /*  outInteger */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MINMAX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2605,6 +4607,22 @@
 /* Generated */ {
 /* Generated */    return TA_MINMAX_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MINMAX_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_MINMAX(
+/* Generated */                  startIdx,
+/* Generated */                  endIdx,
+/* Generated */                  params->in[0].data.inRealS, /* inReal */
+/* Generated */                  params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                  outBegIdx, 
+/* Generated */                  outNBElement, 
+/* Generated */                  params->out[0].data.outReal, /*  outMin */
+/* Generated */                  params->out[1].data.outReal /*  outMax */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MINMAXINDEX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2625,6 +4643,22 @@
 /* Generated */ {
 /* Generated */    return TA_MINMAXINDEX_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MINMAXINDEX_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_MINMAXINDEX(
+/* Generated */                       startIdx,
+/* Generated */                       endIdx,
+/* Generated */                       params->in[0].data.inRealS, /* inReal */
+/* Generated */                       params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                       outBegIdx, 
+/* Generated */                       outNBElement, 
+/* Generated */                       params->out[0].data.outInteger, /*  outMinIdx */
+/* Generated */                       params->out[1].data.outInteger /*  outMaxIdx */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MINUS_DI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2646,6 +4680,23 @@
 /* Generated */ {
 /* Generated */    return TA_MINUS_DI_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MINUS_DI_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_MINUS_DI(
+/* Generated */                    startIdx,
+/* Generated */                    endIdx,
+/* Generated */                    params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                    params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                    params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                    params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                    outBegIdx, 
+/* Generated */                    outNBElement, 
+/* Generated */                    params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MINUS_DM_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2666,6 +4717,22 @@
 /* Generated */ {
 /* Generated */    return TA_MINUS_DM_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MINUS_DM_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_MINUS_DM(
+/* Generated */                    startIdx,
+/* Generated */                    endIdx,
+/* Generated */                    params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                    params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                    params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                    outBegIdx, 
+/* Generated */                    outNBElement, 
+/* Generated */                    params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MOM_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2685,6 +4752,21 @@
 /* Generated */ {
 /* Generated */    return TA_MOM_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MOM_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_MOM(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inRealS, /* inReal */
+/* Generated */               params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_MULT_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2705,6 +4787,21 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_MULT_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_MULT_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_MULT(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                params->in[0].data.inRealS, /* inReal0 */
+/* Generated */                params->in[1].data.inRealS, /* inReal1 */
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_NATR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2726,6 +4823,23 @@
 /* Generated */ {
 /* Generated */    return TA_NATR_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_NATR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_NATR(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_OBV_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2746,6 +4860,21 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_OBV_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_OBV_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_OBV(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inRealS, /* inReal */
+/* Generated */               params->in[1].data.inPriceS.volume, /* inVolume */
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_PLUS_DI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2767,6 +4896,23 @@
 /* Generated */ {
 /* Generated */    return TA_PLUS_DI_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_PLUS_DI_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_PLUS_DI(
+/* Generated */                   startIdx,
+/* Generated */                   endIdx,
+/* Generated */                   params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                   params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                   params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                   params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                   outBegIdx, 
+/* Generated */                   outNBElement, 
+/* Generated */                   params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_PLUS_DM_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2787,6 +4933,22 @@
 /* Generated */ {
 /* Generated */    return TA_PLUS_DM_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_PLUS_DM_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_PLUS_DM(
+/* Generated */                   startIdx,
+/* Generated */                   endIdx,
+/* Generated */                   params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                   params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                   params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                   outBegIdx, 
+/* Generated */                   outNBElement, 
+/* Generated */                   params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_PPO_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2810,6 +4972,23 @@
 /* Generated */                     params->optIn[1].data.optInInteger, /* optInSlowPeriod*/
 /* Generated */                     (TA_MAType)params->optIn[2].data.optInInteger /* optInMAType*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_PPO_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_PPO(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inRealS, /* inReal */
+/* Generated */               params->optIn[0].data.optInInteger, /* optInFastPeriod*/
+/* Generated */               params->optIn[1].data.optInInteger, /* optInSlowPeriod*/
+/* Generated */               (TA_MAType)params->optIn[2].data.optInInteger, /* optInMAType*/
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_ROC_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2829,6 +5008,21 @@
 /* Generated */ {
 /* Generated */    return TA_ROC_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_ROC_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_ROC(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inRealS, /* inReal */
+/* Generated */               params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_ROCP_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2848,6 +5042,21 @@
 /* Generated */ {
 /* Generated */    return TA_ROCP_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_ROCP_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_ROCP(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                params->in[0].data.inRealS, /* inReal */
+/* Generated */                params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_ROCR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2867,6 +5076,21 @@
 /* Generated */ {
 /* Generated */    return TA_ROCR_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_ROCR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_ROCR(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                params->in[0].data.inRealS, /* inReal */
+/* Generated */                params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_ROCR100_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2886,6 +5110,21 @@
 /* Generated */ {
 /* Generated */    return TA_ROCR100_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_ROCR100_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_ROCR100(
+/* Generated */                   startIdx,
+/* Generated */                   endIdx,
+/* Generated */                   params->in[0].data.inRealS, /* inReal */
+/* Generated */                   params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                   outBegIdx, 
+/* Generated */                   outNBElement, 
+/* Generated */                   params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_RSI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2905,6 +5144,21 @@
 /* Generated */ {
 /* Generated */    return TA_RSI_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_RSI_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_RSI(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inRealS, /* inReal */
+/* Generated */               params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_SAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2927,6 +5181,23 @@
 /* Generated */    return TA_SAR_Lookback(params->optIn[0].data.optInReal, /* optInAcceleration*/
 /* Generated */                     params->optIn[1].data.optInReal /* optInMaximum*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_SAR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_SAR(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */               params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */               params->optIn[0].data.optInReal, /* optInAcceleration*/
+/* Generated */               params->optIn[1].data.optInReal, /* optInMaximum*/
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_SAREXT_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2961,6 +5232,29 @@
 /* Generated */                        params->optIn[6].data.optInReal, /* optInAccelerationShort*/
 /* Generated */                        params->optIn[7].data.optInReal /* optInAccelerationMaxShort*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_SAREXT_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_SAREXT(
+/* Generated */                  startIdx,
+/* Generated */                  endIdx,
+/* Generated */                  params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                  params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                  params->optIn[0].data.optInReal, /* optInStartValue*/
+/* Generated */                  params->optIn[1].data.optInReal, /* optInOffsetOnReverse*/
+/* Generated */                  params->optIn[2].data.optInReal, /* optInAccelerationInitLong*/
+/* Generated */                  params->optIn[3].data.optInReal, /* optInAccelerationLong*/
+/* Generated */                  params->optIn[4].data.optInReal, /* optInAccelerationMaxLong*/
+/* Generated */                  params->optIn[5].data.optInReal, /* optInAccelerationInitShort*/
+/* Generated */                  params->optIn[6].data.optInReal, /* optInAccelerationShort*/
+/* Generated */                  params->optIn[7].data.optInReal, /* optInAccelerationMaxShort*/
+/* Generated */                  outBegIdx, 
+/* Generated */                  outNBElement, 
+/* Generated */                  params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_SIN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2980,6 +5274,20 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_SIN_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_SIN_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_SIN(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inRealS, /* inReal */
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_SINH_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -2999,6 +5307,20 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_SINH_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_SINH_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_SINH(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                params->in[0].data.inRealS, /* inReal */
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_SMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3018,6 +5340,21 @@
 /* Generated */ {
 /* Generated */    return TA_SMA_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_SMA_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_SMA(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inRealS, /* inReal */
+/* Generated */               params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_SQRT_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3037,6 +5374,20 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_SQRT_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_SQRT_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_SQRT(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                params->in[0].data.inRealS, /* inReal */
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_STDDEV_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3058,6 +5409,22 @@
 /* Generated */    return TA_STDDEV_Lookback(params->optIn[0].data.optInInteger, /* optInTimePeriod*/
 /* Generated */                        params->optIn[1].data.optInReal /* optInNbDev*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_STDDEV_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_STDDEV(
+/* Generated */                  startIdx,
+/* Generated */                  endIdx,
+/* Generated */                  params->in[0].data.inRealS, /* inReal */
+/* Generated */                  params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                  params->optIn[1].data.optInReal, /* optInNbDev*/
+/* Generated */                  outBegIdx, 
+/* Generated */                  outNBElement, 
+/* Generated */                  params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_STOCH_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3088,6 +5455,28 @@
 /* Generated */                       params->optIn[3].data.optInInteger, /* optInSlowD_Period*/
 /* Generated */                       (TA_MAType)params->optIn[4].data.optInInteger /* optInSlowD_MAType*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_STOCH_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_STOCH(
+/* Generated */                 startIdx,
+/* Generated */                 endIdx,
+/* Generated */                 params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                 params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                 params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                 params->optIn[0].data.optInInteger, /* optInFastK_Period*/
+/* Generated */                 params->optIn[1].data.optInInteger, /* optInSlowK_Period*/
+/* Generated */                 (TA_MAType)params->optIn[2].data.optInInteger, /* optInSlowK_MAType*/
+/* Generated */                 params->optIn[3].data.optInInteger, /* optInSlowD_Period*/
+/* Generated */                 (TA_MAType)params->optIn[4].data.optInInteger, /* optInSlowD_MAType*/
+/* Generated */                 outBegIdx, 
+/* Generated */                 outNBElement, 
+/* Generated */                 params->out[0].data.outReal, /*  outSlowK */
+/* Generated */                 params->out[1].data.outReal /*  outSlowD */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_STOCHF_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3114,6 +5503,26 @@
 /* Generated */                        params->optIn[1].data.optInInteger, /* optInFastD_Period*/
 /* Generated */                        (TA_MAType)params->optIn[2].data.optInInteger /* optInFastD_MAType*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_STOCHF_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_STOCHF(
+/* Generated */                  startIdx,
+/* Generated */                  endIdx,
+/* Generated */                  params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                  params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                  params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                  params->optIn[0].data.optInInteger, /* optInFastK_Period*/
+/* Generated */                  params->optIn[1].data.optInInteger, /* optInFastD_Period*/
+/* Generated */                  (TA_MAType)params->optIn[2].data.optInInteger, /* optInFastD_MAType*/
+/* Generated */                  outBegIdx, 
+/* Generated */                  outNBElement, 
+/* Generated */                  params->out[0].data.outReal, /*  outFastK */
+/* Generated */                  params->out[1].data.outReal /*  outFastD */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_STOCHRSI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3140,6 +5549,25 @@
 /* Generated */                          params->optIn[2].data.optInInteger, /* optInFastD_Period*/
 /* Generated */                          (TA_MAType)params->optIn[3].data.optInInteger /* optInFastD_MAType*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_STOCHRSI_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_STOCHRSI(
+/* Generated */                    startIdx,
+/* Generated */                    endIdx,
+/* Generated */                    params->in[0].data.inRealS, /* inReal */
+/* Generated */                    params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                    params->optIn[1].data.optInInteger, /* optInFastK_Period*/
+/* Generated */                    params->optIn[2].data.optInInteger, /* optInFastD_Period*/
+/* Generated */                    (TA_MAType)params->optIn[3].data.optInInteger, /* optInFastD_MAType*/
+/* Generated */                    outBegIdx, 
+/* Generated */                    outNBElement, 
+/* Generated */                    params->out[0].data.outReal, /*  outFastK */
+/* Generated */                    params->out[1].data.outReal /*  outFastD */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_SUB_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3160,6 +5588,21 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_SUB_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_SUB_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_SUB(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inRealS, /* inReal0 */
+/* Generated */               params->in[1].data.inRealS, /* inReal1 */
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_SUM_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3179,6 +5622,21 @@
 /* Generated */ {
 /* Generated */    return TA_SUM_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_SUM_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_SUM(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inRealS, /* inReal */
+/* Generated */               params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_T3_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3200,6 +5658,22 @@
 /* Generated */    return TA_T3_Lookback(params->optIn[0].data.optInInteger, /* optInTimePeriod*/
 /* Generated */                    params->optIn[1].data.optInReal /* optInVFactor*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_T3_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_T3(
+/* Generated */              startIdx,
+/* Generated */              endIdx,
+/* Generated */              params->in[0].data.inRealS, /* inReal */
+/* Generated */              params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */              params->optIn[1].data.optInReal, /* optInVFactor*/
+/* Generated */              outBegIdx, 
+/* Generated */              outNBElement, 
+/* Generated */              params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_TAN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3219,6 +5693,20 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_TAN_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_TAN_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_TAN(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inRealS, /* inReal */
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_TANH_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3238,6 +5726,20 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_TANH_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_TANH_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_TANH(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                params->in[0].data.inRealS, /* inReal */
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_TEMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3257,6 +5759,21 @@
 /* Generated */ {
 /* Generated */    return TA_TEMA_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_TEMA_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_TEMA(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                params->in[0].data.inRealS, /* inReal */
+/* Generated */                params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_TRANGE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3278,6 +5795,22 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_TRANGE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_TRANGE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_TRANGE(
+/* Generated */                  startIdx,
+/* Generated */                  endIdx,
+/* Generated */                  params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                  params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                  params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                  outBegIdx, 
+/* Generated */                  outNBElement, 
+/* Generated */                  params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_TRIMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3297,6 +5830,21 @@
 /* Generated */ {
 /* Generated */    return TA_TRIMA_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_TRIMA_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_TRIMA(
+/* Generated */                 startIdx,
+/* Generated */                 endIdx,
+/* Generated */                 params->in[0].data.inRealS, /* inReal */
+/* Generated */                 params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                 outBegIdx, 
+/* Generated */                 outNBElement, 
+/* Generated */                 params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_TRIX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3316,6 +5864,21 @@
 /* Generated */ {
 /* Generated */    return TA_TRIX_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_TRIX_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_TRIX(
+/* Generated */                startIdx,
+/* Generated */                endIdx,
+/* Generated */                params->in[0].data.inRealS, /* inReal */
+/* Generated */                params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                outBegIdx, 
+/* Generated */                outNBElement, 
+/* Generated */                params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_TSF_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3335,6 +5898,21 @@
 /* Generated */ {
 /* Generated */    return TA_TSF_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_TSF_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_TSF(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inRealS, /* inReal */
+/* Generated */               params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_TYPPRICE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3356,6 +5934,22 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_TYPPRICE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_TYPPRICE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_TYPPRICE(
+/* Generated */                    startIdx,
+/* Generated */                    endIdx,
+/* Generated */                    params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                    params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                    params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                    outBegIdx, 
+/* Generated */                    outNBElement, 
+/* Generated */                    params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_ULTOSC_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3381,6 +5975,25 @@
 /* Generated */                        params->optIn[1].data.optInInteger, /* optInTimePeriod2*/
 /* Generated */                        params->optIn[2].data.optInInteger /* optInTimePeriod3*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_ULTOSC_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_ULTOSC(
+/* Generated */                  startIdx,
+/* Generated */                  endIdx,
+/* Generated */                  params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                  params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                  params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                  params->optIn[0].data.optInInteger, /* optInTimePeriod1*/
+/* Generated */                  params->optIn[1].data.optInInteger, /* optInTimePeriod2*/
+/* Generated */                  params->optIn[2].data.optInInteger, /* optInTimePeriod3*/
+/* Generated */                  outBegIdx, 
+/* Generated */                  outNBElement, 
+/* Generated */                  params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_VAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3402,6 +6015,22 @@
 /* Generated */    return TA_VAR_Lookback(params->optIn[0].data.optInInteger, /* optInTimePeriod*/
 /* Generated */                     params->optIn[1].data.optInReal /* optInNbDev*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_VAR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_VAR(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inRealS, /* inReal */
+/* Generated */               params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */               params->optIn[1].data.optInReal, /* optInNbDev*/
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_WCLPRICE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3423,6 +6052,22 @@
 /* Generated */    (void)params;
 /* Generated */    return TA_WCLPRICE_Lookback( );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_WCLPRICE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_WCLPRICE(
+/* Generated */                    startIdx,
+/* Generated */                    endIdx,
+/* Generated */                    params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                    params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                    params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                    outBegIdx, 
+/* Generated */                    outNBElement, 
+/* Generated */                    params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_WILLR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3444,6 +6089,23 @@
 /* Generated */ {
 /* Generated */    return TA_WILLR_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_WILLR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_WILLR(
+/* Generated */                 startIdx,
+/* Generated */                 endIdx,
+/* Generated */                 params->in[0].data.inPriceS.high, /* inHigh */
+/* Generated */                 params->in[0].data.inPriceS.low, /* inLow */
+/* Generated */                 params->in[0].data.inPriceS.close, /* inClose */
+/* Generated */                 params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */                 outBegIdx, 
+/* Generated */                 outNBElement, 
+/* Generated */                 params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 /* Generated */ TA_RetCode TA_WMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
@@ -3463,6 +6125,21 @@
 /* Generated */ {
 /* Generated */    return TA_WMA_Lookback(params->optIn[0].data.optInInteger /* optInTimePeriod*/ );
 /* Generated */ }
+/* Generated */ TA_RetCode TA_WMA_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+/* Generated */ {
+/* Generated */    return TA_S_WMA(
+/* Generated */               startIdx,
+/* Generated */               endIdx,
+/* Generated */               params->in[0].data.inRealS, /* inReal */
+/* Generated */               params->optIn[0].data.optInInteger, /* optInTimePeriod*/
+/* Generated */               outBegIdx, 
+/* Generated */               outNBElement, 
+/* Generated */               params->out[0].data.outReal /*  outReal */ );
+/* Generated */ }
 
 /***************/
 /* End of File */
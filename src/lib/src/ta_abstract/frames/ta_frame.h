@@ -59,6 +59,12 @@
 ;
 /* Generated */ unsigned int TA_ACCBANDS_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_ACCBANDS_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_ACOS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -68,6 +74,12 @@
 ;
 /* Generated */ unsigned int TA_ACOS_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_ACOS_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_AD_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -77,6 +89,12 @@
 ;
 /* Generated */ unsigned int TA_AD_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_AD_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_ADD_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -86,6 +104,12 @@
 ;
 /* Generated */ unsigned int TA_ADD_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_ADD_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_ADOSC_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -95,6 +119,12 @@
 ;
 /* Generated */ unsigned int TA_ADOSC_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_ADOSC_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_ADX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -104,6 +134,12 @@
 ;
 /* Generated */ unsigned int TA_ADX_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_ADX_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_ADXR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -113,6 +149,12 @@
 ;
 /* Generated */ unsigned int TA_ADXR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_ADXR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_APO_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -122,6 +164,12 @@
 ;
 /* Generated */ unsigned int TA_APO_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_APO_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_AROON_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -131,6 +179,12 @@
 ;
 /* Generated */ unsigned int TA_AROON_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_AROON_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_AROONOSC_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -140,6 +194,12 @@
 ;
 /* Generated */ unsigned int TA_AROONOSC_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_AROONOSC_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_ASIN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -149,6 +209,12 @@
 ;
 /* Generated */ unsigned int TA_ASIN_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_ASIN_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_ATAN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -158,6 +224,12 @@
 ;
 /* Generated */ unsigned int TA_ATAN_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_ATAN_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_ATR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -167,6 +239,12 @@
 ;
 /* Generated */ unsigned int TA_ATR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_ATR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_AVGPRICE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -176,6 +254,12 @@
 ;
 /* Generated */ unsigned int TA_AVGPRICE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_AVGPRICE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_AVGDEV_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -185,6 +269,12 @@
 ;
 /* Generated */ unsigned int TA_AVGDEV_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_AVGDEV_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_BBANDS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -194,6 +284,12 @@
 ;
 /* Generated */ unsigned int TA_BBANDS_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_BBANDS_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_BETA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -203,6 +299,12 @@
 ;
 /* Generated */ unsigned int TA_BETA_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_BETA_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_BOP_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -212,6 +314,12 @@
 ;
 /* Generated */ unsigned int TA_BOP_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_BOP_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CCI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -221,6 +329,12 @@
 ;
 /* Generated */ unsigned int TA_CCI_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CCI_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDL2CROWS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -230,6 +344,12 @@
 ;
 /* Generated */ unsigned int TA_CDL2CROWS_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDL2CROWS_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDL3BLACKCROWS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -239,6 +359,12 @@
 ;
 /* Generated */ unsigned int TA_CDL3BLACKCROWS_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDL3BLACKCROWS_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDL3INSIDE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -248,6 +374,12 @@
 ;
 /* Generated */ unsigned int TA_CDL3INSIDE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDL3INSIDE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDL3LINESTRIKE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -257,6 +389,12 @@
 ;
 /* Generated */ unsigned int TA_CDL3LINESTRIKE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDL3LINESTRIKE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDL3OUTSIDE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -266,6 +404,12 @@
 ;
 /* Generated */ unsigned int TA_CDL3OUTSIDE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDL3OUTSIDE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDL3STARSINSOUTH_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -275,6 +419,12 @@
 ;
 /* Generated */ unsigned int TA_CDL3STARSINSOUTH_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDL3STARSINSOUTH_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDL3WHITESOLDIERS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -284,6 +434,12 @@
 ;
 /* Generated */ unsigned int TA_CDL3WHITESOLDIERS_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDL3WHITESOLDIERS_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLABANDONEDBABY_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -293,6 +449,12 @@
 ;
 /* Generated */ unsigned int TA_CDLABANDONEDBABY_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLABANDONEDBABY_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLADVANCEBLOCK_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -302,6 +464,12 @@
 ;
 /* Generated */ unsigned int TA_CDLADVANCEBLOCK_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLADVANCEBLOCK_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLBELTHOLD_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -311,6 +479,12 @@
 ;
 /* Generated */ unsigned int TA_CDLBELTHOLD_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLBELTHOLD_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLBREAKAWAY_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -320,6 +494,12 @@
 ;
 /* Generated */ unsigned int TA_CDLBREAKAWAY_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLBREAKAWAY_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLCLOSINGMARUBOZU_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -329,6 +509,12 @@
 ;
 /* Generated */ unsigned int TA_CDLCLOSINGMARUBOZU_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLCLOSINGMARUBOZU_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLCONCEALBABYSWALL_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -338,6 +524,12 @@
 ;
 /* Generated */ unsigned int TA_CDLCONCEALBABYSWALL_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLCONCEALBABYSWALL_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLCOUNTERATTACK_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -347,6 +539,12 @@
 ;
 /* Generated */ unsigned int TA_CDLCOUNTERATTACK_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLCOUNTERATTACK_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLDARKCLOUDCOVER_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -356,6 +554,12 @@
 ;
 /* Generated */ unsigned int TA_CDLDARKCLOUDCOVER_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLDARKCLOUDCOVER_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLDOJI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -365,6 +569,12 @@
 ;
 /* Generated */ unsigned int TA_CDLDOJI_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLDOJI_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLDOJISTAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -374,6 +584,12 @@
 ;
 /* Generated */ unsigned int TA_CDLDOJISTAR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLDOJISTAR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLDRAGONFLYDOJI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -383,6 +599,12 @@
 ;
 /* Generated */ unsigned int TA_CDLDRAGONFLYDOJI_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLDRAGONFLYDOJI_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLENGULFING_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -392,6 +614,12 @@
 ;
 /* Generated */ unsigned int TA_CDLENGULFING_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLENGULFING_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLEVENINGDOJISTAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -401,6 +629,12 @@
 ;
 /* Generated */ unsigned int TA_CDLEVENINGDOJISTAR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLEVENINGDOJISTAR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLEVENINGSTAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -410,6 +644,12 @@
 ;
 /* Generated */ unsigned int TA_CDLEVENINGSTAR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLEVENINGSTAR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLGAPSIDESIDEWHITE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -419,6 +659,12 @@
 ;
 /* Generated */ unsigned int TA_CDLGAPSIDESIDEWHITE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLGAPSIDESIDEWHITE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLGRAVESTONEDOJI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -428,6 +674,12 @@
 ;
 /* Generated */ unsigned int TA_CDLGRAVESTONEDOJI_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLGRAVESTONEDOJI_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLHAMMER_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -437,6 +689,12 @@
 ;
 /* Generated */ unsigned int TA_CDLHAMMER_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLHAMMER_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLHANGINGMAN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -446,6 +704,12 @@
 ;
 /* Generated */ unsigned int TA_CDLHANGINGMAN_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLHANGINGMAN_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLHARAMI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -455,6 +719,12 @@
 ;
 /* Generated */ unsigned int TA_CDLHARAMI_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLHARAMI_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLHARAMICROSS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -464,6 +734,12 @@
 ;
 /* Generated */ unsigned int TA_CDLHARAMICROSS_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLHARAMICROSS_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLHIGHWAVE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -473,6 +749,12 @@
 ;
 /* Generated */ unsigned int TA_CDLHIGHWAVE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLHIGHWAVE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLHIKKAKE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -482,6 +764,12 @@
 ;
 /* Generated */ unsigned int TA_CDLHIKKAKE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLHIKKAKE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLHIKKAKEMOD_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -491,6 +779,12 @@
 ;
 /* Generated */ unsigned int TA_CDLHIKKAKEMOD_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLHIKKAKEMOD_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLHOMINGPIGEON_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -500,6 +794,12 @@
 ;
 /* Generated */ unsigned int TA_CDLHOMINGPIGEON_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLHOMINGPIGEON_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLIDENTICAL3CROWS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -509,17 +809,29 @@
 ;
 /* Generated */ unsigned int TA_CDLIDENTICAL3CROWS_FramePPLB( const TA_ParamHolderPriv *params )
 ;
-
-/* Generated */ TA_RetCode TA_CDLINNECK_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */ TA_RetCode TA_CDLIDENTICAL3CROWS_FramePPS( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
 /* Generated */                           int           *outBegIdx,
 /* Generated */                           int           *outNBElement )
 ;
-/* Generated */ unsigned int TA_CDLINNECK_FramePPLB( const TA_ParamHolderPriv *params )
-;
 
-/* Generated */ TA_RetCode TA_CDLINVERTEDHAMMER_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */ TA_RetCode TA_CDLINNECK_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
+/* Generated */ unsigned int TA_CDLINNECK_FramePPLB( const TA_ParamHolderPriv *params )
+;
+/* Generated */ TA_RetCode TA_CDLINNECK_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
+
+/* Generated */ TA_RetCode TA_CDLINVERTEDHAMMER_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
 /* Generated */                           int           *outBegIdx,
@@ -527,6 +839,12 @@
 ;
 /* Generated */ unsigned int TA_CDLINVERTEDHAMMER_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLINVERTEDHAMMER_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLKICKING_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -536,6 +854,12 @@
 ;
 /* Generated */ unsigned int TA_CDLKICKING_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLKICKING_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLKICKINGBYLENGTH_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -545,6 +869,12 @@
 ;
 /* Generated */ unsigned int TA_CDLKICKINGBYLENGTH_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLKICKINGBYLENGTH_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLLADDERBOTTOM_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -554,6 +884,12 @@
 ;
 /* Generated */ unsigned int TA_CDLLADDERBOTTOM_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLLADDERBOTTOM_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLLONGLEGGEDDOJI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -563,6 +899,12 @@
 ;
 /* Generated */ unsigned int TA_CDLLONGLEGGEDDOJI_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLLONGLEGGEDDOJI_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLLONGLINE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -572,6 +914,12 @@
 ;
 /* Generated */ unsigned int TA_CDLLONGLINE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLLONGLINE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLMARUBOZU_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -581,6 +929,12 @@
 ;
 /* Generated */ unsigned int TA_CDLMARUBOZU_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLMARUBOZU_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLMATCHINGLOW_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -590,6 +944,12 @@
 ;
 /* Generated */ unsigned int TA_CDLMATCHINGLOW_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLMATCHINGLOW_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLMATHOLD_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -599,6 +959,12 @@
 ;
 /* Generated */ unsigned int TA_CDLMATHOLD_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLMATHOLD_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLMORNINGDOJISTAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -608,6 +974,12 @@
 ;
 /* Generated */ unsigned int TA_CDLMORNINGDOJISTAR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLMORNINGDOJISTAR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLMORNINGSTAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -617,6 +989,12 @@
 ;
 /* Generated */ unsigned int TA_CDLMORNINGSTAR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLMORNINGSTAR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLONNECK_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -626,6 +1004,12 @@
 ;
 /* Generated */ unsigned int TA_CDLONNECK_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLONNECK_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLPIERCING_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -635,6 +1019,12 @@
 ;
 /* Generated */ unsigned int TA_CDLPIERCING_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLPIERCING_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLRICKSHAWMAN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -644,6 +1034,12 @@
 ;
 /* Generated */ unsigned int TA_CDLRICKSHAWMAN_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLRICKSHAWMAN_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLRISEFALL3METHODS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -653,6 +1049,12 @@
 ;
 /* Generated */ unsigned int TA_CDLRISEFALL3METHODS_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLRISEFALL3METHODS_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLSEPARATINGLINES_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -662,6 +1064,12 @@
 ;
 /* Generated */ unsigned int TA_CDLSEPARATINGLINES_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLSEPARATINGLINES_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLSHOOTINGSTAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -671,6 +1079,12 @@
 ;
 /* Generated */ unsigned int TA_CDLSHOOTINGSTAR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLSHOOTINGSTAR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLSHORTLINE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -680,6 +1094,12 @@
 ;
 /* Generated */ unsigned int TA_CDLSHORTLINE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLSHORTLINE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLSPINNINGTOP_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -689,6 +1109,12 @@
 ;
 /* Generated */ unsigned int TA_CDLSPINNINGTOP_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLSPINNINGTOP_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLSTALLEDPATTERN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -698,6 +1124,12 @@
 ;
 /* Generated */ unsigned int TA_CDLSTALLEDPATTERN_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLSTALLEDPATTERN_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLSTICKSANDWICH_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -707,6 +1139,12 @@
 ;
 /* Generated */ unsigned int TA_CDLSTICKSANDWICH_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLSTICKSANDWICH_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLTAKURI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -716,6 +1154,12 @@
 ;
 /* Generated */ unsigned int TA_CDLTAKURI_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLTAKURI_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLTASUKIGAP_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -725,6 +1169,12 @@
 ;
 /* Generated */ unsigned int TA_CDLTASUKIGAP_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLTASUKIGAP_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLTHRUSTING_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -734,6 +1184,12 @@
 ;
 /* Generated */ unsigned int TA_CDLTHRUSTING_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLTHRUSTING_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLTRISTAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -743,6 +1199,12 @@
 ;
 /* Generated */ unsigned int TA_CDLTRISTAR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLTRISTAR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLUNIQUE3RIVER_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -752,6 +1214,12 @@
 ;
 /* Generated */ unsigned int TA_CDLUNIQUE3RIVER_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLUNIQUE3RIVER_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLUPSIDEGAP2CROWS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -761,6 +1229,12 @@
 ;
 /* Generated */ unsigned int TA_CDLUPSIDEGAP2CROWS_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLUPSIDEGAP2CROWS_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CDLXSIDEGAP3METHODS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -770,6 +1244,12 @@
 ;
 /* Generated */ unsigned int TA_CDLXSIDEGAP3METHODS_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CDLXSIDEGAP3METHODS_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CEIL_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -779,6 +1259,12 @@
 ;
 /* Generated */ unsigned int TA_CEIL_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CEIL_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CMO_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -788,6 +1274,12 @@
 ;
 /* Generated */ unsigned int TA_CMO_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CMO_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_CORREL_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -797,6 +1289,12 @@
 ;
 /* Generated */ unsigned int TA_CORREL_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_CORREL_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_COS_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -806,6 +1304,12 @@
 ;
 /* Generated */ unsigned int TA_COS_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_COS_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_COSH_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -815,6 +1319,12 @@
 ;
 /* Generated */ unsigned int TA_COSH_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_COSH_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_DEMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -824,6 +1334,12 @@
 ;
 /* Generated */ unsigned int TA_DEMA_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_DEMA_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_DIV_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -833,6 +1349,12 @@
 ;
 /* Generated */ unsigned int TA_DIV_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_DIV_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_DX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -842,6 +1364,12 @@
 ;
 /* Generated */ unsigned int TA_DX_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_DX_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_EMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -851,6 +1379,12 @@
 ;
 /* Generated */ unsigned int TA_EMA_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_EMA_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_EXP_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -860,6 +1394,12 @@
 ;
 /* Generated */ unsigned int TA_EXP_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_EXP_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_FLOOR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -869,6 +1409,12 @@
 ;
 /* Generated */ unsigned int TA_FLOOR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_FLOOR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_HT_DCPERIOD_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -878,6 +1424,12 @@
 ;
 /* Generated */ unsigned int TA_HT_DCPERIOD_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_HT_DCPERIOD_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_HT_DCPHASE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -887,6 +1439,12 @@
 ;
 /* Generated */ unsigned int TA_HT_DCPHASE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_HT_DCPHASE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_HT_PHASOR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -896,6 +1454,12 @@
 ;
 /* Generated */ unsigned int TA_HT_PHASOR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_HT_PHASOR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_HT_SINE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -905,6 +1469,12 @@
 ;
 /* Generated */ unsigned int TA_HT_SINE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_HT_SINE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_HT_TRENDLINE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -914,6 +1484,12 @@
 ;
 /* Generated */ unsigned int TA_HT_TRENDLINE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_HT_TRENDLINE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_HT_TRENDMODE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -923,6 +1499,12 @@
 ;
 /* Generated */ unsigned int TA_HT_TRENDMODE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_HT_TRENDMODE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_IMI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -932,6 +1514,12 @@
 ;
 /* Generated */ unsigned int TA_IMI_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_IMI_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_KAMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -941,6 +1529,12 @@
 ;
 /* Generated */ unsigned int TA_KAMA_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_KAMA_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_LINEARREG_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -950,6 +1544,27 @@
 ;
 /* Generated */ unsigned int TA_LINEARREG_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_LINEARREG_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
+
+/* Generated */ TA_RetCode TA_LINEARREG_ALL_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
+/* Generated */ unsigned int TA_LINEARREG_ALL_FramePPLB( const TA_ParamHolderPriv *params )
+;
+/* Generated */ TA_RetCode TA_LINEARREG_ALL_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_LINEARREG_ANGLE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -959,6 +1574,12 @@
 ;
 /* Generated */ unsigned int TA_LINEARREG_ANGLE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_LINEARREG_ANGLE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_LINEARREG_INTERCEPT_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -968,6 +1589,12 @@
 ;
 /* Generated */ unsigned int TA_LINEARREG_INTERCEPT_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_LINEARREG_INTERCEPT_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_LINEARREG_SLOPE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -977,6 +1604,12 @@
 ;
 /* Generated */ unsigned int TA_LINEARREG_SLOPE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_LINEARREG_SLOPE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_LN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -986,6 +1619,12 @@
 ;
 /* Generated */ unsigned int TA_LN_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_LN_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_LOG10_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -995,6 +1634,12 @@
 ;
 /* Generated */ unsigned int TA_LOG10_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_LOG10_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1004,6 +1649,12 @@
 ;
 /* Generated */ unsigned int TA_MA_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MA_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MACD_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1013,6 +1664,12 @@
 ;
 /* Generated */ unsigned int TA_MACD_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MACD_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MACDEXT_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1022,6 +1679,12 @@
 ;
 /* Generated */ unsigned int TA_MACDEXT_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MACDEXT_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MACDFIX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1031,6 +1694,12 @@
 ;
 /* Generated */ unsigned int TA_MACDFIX_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MACDFIX_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MAMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1038,17 +1707,29 @@
 /* Generated */                           int           *outBegIdx,
 /* Generated */                           int           *outNBElement )
 ;
-/* Generated */ unsigned int TA_MAMA_FramePPLB( const TA_ParamHolderPriv *params )
+/* Generated */ unsigned int TA_MAMA_FramePPLB( const TA_ParamHolderPriv *params )
+;
+/* Generated */ TA_RetCode TA_MAMA_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
+
+/* Generated */ TA_RetCode TA_MAVP_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
+/* Generated */ unsigned int TA_MAVP_FramePPLB( const TA_ParamHolderPriv *params )
 ;
-
-/* Generated */ TA_RetCode TA_MAVP_FramePP( const TA_ParamHolderPriv *params,
+/* Generated */ TA_RetCode TA_MAVP_FramePPS( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
 /* Generated */                           int            endIdx,
 /* Generated */                           int           *outBegIdx,
 /* Generated */                           int           *outNBElement )
 ;
-/* Generated */ unsigned int TA_MAVP_FramePPLB( const TA_ParamHolderPriv *params )
-;
 
 /* Generated */ TA_RetCode TA_MAX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1058,6 +1739,12 @@
 ;
 /* Generated */ unsigned int TA_MAX_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MAX_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MAXINDEX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1067,6 +1754,12 @@
 ;
 /* Generated */ unsigned int TA_MAXINDEX_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MAXINDEX_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MEDPRICE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1076,6 +1769,12 @@
 ;
 /* Generated */ unsigned int TA_MEDPRICE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MEDPRICE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MFI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1085,6 +1784,12 @@
 ;
 /* Generated */ unsigned int TA_MFI_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MFI_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MIDPOINT_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1094,6 +1799,12 @@
 ;
 /* Generated */ unsigned int TA_MIDPOINT_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MIDPOINT_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MIDPRICE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1103,6 +1814,12 @@
 ;
 /* Generated */ unsigned int TA_MIDPRICE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MIDPRICE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MIN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1112,6 +1829,12 @@
 ;
 /* Generated */ unsigned int TA_MIN_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MIN_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MININDEX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1121,6 +1844,12 @@
 ;
 /* Generated */ unsigned int TA_MININDEX_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MININDEX_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MINMAX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1130,6 +1859,12 @@
 ;
 /* Generated */ unsigned int TA_MINMAX_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MINMAX_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MINMAXINDEX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1139,6 +1874,12 @@
 ;
 /* Generated */ unsigned int TA_MINMAXINDEX_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MINMAXINDEX_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MINUS_DI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1148,6 +1889,12 @@
 ;
 /* Generated */ unsigned int TA_MINUS_DI_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MINUS_DI_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MINUS_DM_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1157,6 +1904,12 @@
 ;
 /* Generated */ unsigned int TA_MINUS_DM_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MINUS_DM_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MOM_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1166,6 +1919,12 @@
 ;
 /* Generated */ unsigned int TA_MOM_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MOM_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_MULT_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1175,6 +1934,12 @@
 ;
 /* Generated */ unsigned int TA_MULT_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_MULT_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_NATR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1184,6 +1949,12 @@
 ;
 /* Generated */ unsigned int TA_NATR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_NATR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_OBV_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1193,6 +1964,12 @@
 ;
 /* Generated */ unsigned int TA_OBV_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_OBV_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_PLUS_DI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1202,6 +1979,12 @@
 ;
 /* Generated */ unsigned int TA_PLUS_DI_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_PLUS_DI_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_PLUS_DM_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1211,6 +1994,12 @@
 ;
 /* Generated */ unsigned int TA_PLUS_DM_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_PLUS_DM_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_PPO_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1220,6 +2009,12 @@
 ;
 /* Generated */ unsigned int TA_PPO_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_PPO_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_ROC_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1229,6 +2024,12 @@
 ;
 /* Generated */ unsigned int TA_ROC_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_ROC_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_ROCP_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1238,6 +2039,12 @@
 ;
 /* Generated */ unsigned int TA_ROCP_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_ROCP_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_ROCR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1247,6 +2054,12 @@
 ;
 /* Generated */ unsigned int TA_ROCR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_ROCR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_ROCR100_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1256,6 +2069,12 @@
 ;
 /* Generated */ unsigned int TA_ROCR100_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_ROCR100_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_RSI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1265,6 +2084,12 @@
 ;
 /* Generated */ unsigned int TA_RSI_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_RSI_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_SAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1274,6 +2099,12 @@
 ;
 /* Generated */ unsigned int TA_SAR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_SAR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_SAREXT_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1283,6 +2114,12 @@
 ;
 /* Generated */ unsigned int TA_SAREXT_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_SAREXT_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_SIN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1292,6 +2129,12 @@
 ;
 /* Generated */ unsigned int TA_SIN_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_SIN_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_SINH_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1301,6 +2144,12 @@
 ;
 /* Generated */ unsigned int TA_SINH_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_SINH_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_SMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1310,6 +2159,12 @@
 ;
 /* Generated */ unsigned int TA_SMA_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_SMA_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_SQRT_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1319,6 +2174,12 @@
 ;
 /* Generated */ unsigned int TA_SQRT_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_SQRT_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_STDDEV_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1328,6 +2189,12 @@
 ;
 /* Generated */ unsigned int TA_STDDEV_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_STDDEV_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_STOCH_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1337,6 +2204,12 @@
 ;
 /* Generated */ unsigned int TA_STOCH_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_STOCH_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_STOCHF_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1346,6 +2219,12 @@
 ;
 /* Generated */ unsigned int TA_STOCHF_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_STOCHF_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_STOCHRSI_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1355,6 +2234,12 @@
 ;
 /* Generated */ unsigned int TA_STOCHRSI_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_STOCHRSI_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_SUB_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1364,6 +2249,12 @@
 ;
 /* Generated */ unsigned int TA_SUB_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_SUB_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_SUM_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1373,6 +2264,12 @@
 ;
 /* Generated */ unsigned int TA_SUM_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_SUM_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_T3_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1382,6 +2279,12 @@
 ;
 /* Generated */ unsigned int TA_T3_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_T3_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_TAN_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1391,6 +2294,12 @@
 ;
 /* Generated */ unsigned int TA_TAN_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_TAN_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_TANH_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1400,6 +2309,12 @@
 ;
 /* Generated */ unsigned int TA_TANH_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_TANH_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_TEMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1409,6 +2324,12 @@
 ;
 /* Generated */ unsigned int TA_TEMA_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_TEMA_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_TRANGE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1418,6 +2339,12 @@
 ;
 /* Generated */ unsigned int TA_TRANGE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_TRANGE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_TRIMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1427,6 +2354,12 @@
 ;
 /* Generated */ unsigned int TA_TRIMA_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_TRIMA_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_TRIX_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1436,6 +2369,12 @@
 ;
 /* Generated */ unsigned int TA_TRIX_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_TRIX_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_TSF_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1445,6 +2384,12 @@
 ;
 /* Generated */ unsigned int TA_TSF_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_TSF_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_TYPPRICE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1454,6 +2399,12 @@
 ;
 /* Generated */ unsigned int TA_TYPPRICE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_TYPPRICE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_ULTOSC_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1463,6 +2414,12 @@
 ;
 /* Generated */ unsigned int TA_ULTOSC_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_ULTOSC_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_VAR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1472,6 +2429,12 @@
 ;
 /* Generated */ unsigned int TA_VAR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_VAR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_WCLPRICE_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1481,6 +2444,12 @@
 ;
 /* Generated */ unsigned int TA_WCLPRICE_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_WCLPRICE_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_WILLR_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1490,6 +2459,12 @@
 ;
 /* Generated */ unsigned int TA_WILLR_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_WILLR_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 /* Generated */ TA_RetCode TA_WMA_FramePP( const TA_ParamHolderPriv *params,
 /* Generated */                           int            startIdx,
@@ -1499,6 +2474,12 @@
 ;
 /* Generated */ unsigned int TA_WMA_FramePPLB( const TA_ParamHolderPriv *params )
 ;
+/* Generated */ TA_RetCode TA_WMA_FramePPS( const TA_ParamHolderPriv *params,
+/* Generated */                           int            startIdx,
+/* Generated */                           int            endIdx,
+/* Generated */                           int           *outBegIdx,
+/* Generated */                           int           *outNBElement )
+;
 
 
 #endif
@@ -58,6 +58,7 @@
 
 /**** Headers ****/
 #include <stddef.h>
+#include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
 #include "ta_common.h"
@@ -65,6 +66,7 @@
 #include "ta_abstract.h"
 #include "ta_def_ui.h"
 #include "ta_frame_priv.h"
+#include "ta_global.h"
 
 #include <limits.h>
 
@@ -124,8 +126,19 @@ typedef struct
    unsigned int magicNumber;
 } TA_StringTablePriv;
 
+/* Upper bound on the number of functions held by the index. */
+#define TA_FUNC_INDEX_MAX 512
+
+typedef struct
+{
+   const TA_FuncDef *funcDef;
+   unsigned int funcId;
+} TA_FuncIndexEntry;
+
 
 /**** Local functions declarations.    ****/
+static int compareFuncIndexEntry( const void *a, const void *b );
+static const TA_FuncIndexEntry *findFuncIndexEntry( const char *name );
 
 
 #ifdef TA_GEN_CODE
@@ -167,7 +180,129 @@ static const unsigned int *TA_DEF_TablesSize[26] =
    &TA_DEF_TableYSize, &TA_DEF_TableZSize
 };
 
+/* Function index built by TA_AbstractInitialize. The functions are
+ * numbered in the order of the first-letter tables and also sorted
+ * by name, so a name is resolved with a binary search.
+ */
+static const TA_FuncDef *TA_FuncById[TA_FUNC_INDEX_MAX];
+static TA_FuncIndexEntry TA_FuncByName[TA_FUNC_INDEX_MAX];
+static unsigned int TA_FuncIndexSize = 0;
+
 /**** Global functions definitions.   ****/
+TA_RetCode TA_AbstractInitialize( void )
+{
+   const TA_FuncDef **funcDefTable;
+   const TA_FuncDef *funcDef;
+   unsigned int i, j, funcDefTableSize, nbFunc;
+
+   TA_FuncIndexSize = 0;
+
+   /* Number the functions in alphabetical table order. */
+   nbFunc = 0;
+   for( i=0; i < 26; i++ )
+   {
+      funcDefTable = TA_DEF_Tables[i];
+      funcDefTableSize = *TA_DEF_TablesSize[i];
+      for( j=0; j < funcDefTableSize; j++ )
+      {
+         funcDef = funcDefTable[j];
+         if( !funcDef || !funcDef->funcInfo )
+            return TA_INTERNAL_ERROR(3);
+
+         if( nbFunc >= TA_FUNC_INDEX_MAX )
+            return TA_INTERNAL_ERROR(5);
+
+         TA_FuncById[nbFunc] = funcDef;
+         TA_FuncByName[nbFunc].funcDef = funcDef;
+         TA_FuncByName[nbFunc].funcId = nbFunc;
+         nbFunc++;
+      }
+   }
+
+   /* Sort by name for the binary search. */
+   qsort( TA_FuncByName, nbFunc, sizeof(TA_FuncIndexEntry), compareFuncIndexEntry );
+
+   TA_FuncIndexSize = nbFunc;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_GetFuncCount( unsigned int *count )
+{
+   if( count == NULL )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   if( TA_FuncIndexSize == 0 )
+   {
+      return TA_LIB_NOT_INITIALIZE;
+   }
+
+   *count = TA_FuncIndexSize;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_GetFuncId( const TA_FuncHandle *handle,
+                         unsigned int *funcId )
+{
+   const TA_FuncDef *funcDef;
+   const TA_FuncIndexEntry *entry;
+
+   if( (handle == NULL) || (funcId == NULL) )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   /* Validate that this is a valid funcHandle. */
+   funcDef = (const TA_FuncDef *)handle;
+   if( funcDef->magicNumber != TA_FUNC_DEF_MAGIC_NB )
+   {
+      return TA_INVALID_HANDLE;
+   }
+
+   if( TA_FuncIndexSize == 0 )
+   {
+      return TA_LIB_NOT_INITIALIZE;
+   }
+
+   entry = findFuncIndexEntry( funcDef->funcInfo->name );
+   if( !entry || (entry->funcDef != funcDef) )
+   {
+      return TA_INVALID_HANDLE;
+   }
+
+   *funcId = entry->funcId;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_GetFuncHandleById( unsigned int funcId,
+                                 const TA_FuncHandle **handle )
+{
+   if( handle == NULL )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   *handle = NULL;
+
+   if( TA_FuncIndexSize == 0 )
+   {
+      return TA_LIB_NOT_INITIALIZE;
+   }
+
+   if( funcId >= TA_FuncIndexSize )
+   {
+      return TA_FUNC_NOT_FOUND;
+   }
+
+   *handle = (TA_FuncHandle *)TA_FuncById[funcId];
+
+   return TA_SUCCESS;
+}
+
 TA_RetCode TA_GroupTableAlloc( TA_StringTable **table )
 {
    TA_StringTable *stringTable;
@@ -375,10 +510,11 @@ TA_RetCode TA_GetFuncHandle( const char *name, const TA_FuncHandle **handle )
    const TA_FuncDef **funcDefTable;
    const TA_FuncDef *funcDef;
    const TA_FuncInfo *funcInfo;
+   const TA_FuncIndexEntry *entry;
    unsigned int i, funcDefTableSize;
 
    /* A TA_FuncHandle is internally a TA_FuncDef. Let's find it
-    * by using the alphabetical tables.
+    * by using the function index or else the alphabetical tables.
     */
    if( (name == NULL) || (handle == NULL) )
    {
@@ -394,6 +530,17 @@ TA_RetCode TA_GetFuncHandle( const char *name, const TA_FuncHandle **handle )
       return TA_BAD_PARAM;
    }
 
+   /* Use the index when TA_Initialize did build it. */
+   if( TA_FuncIndexSize != 0 )
+   {
+      entry = findFuncIndexEntry( name );
+      if( !entry )
+         return TA_FUNC_NOT_FOUND;
+
+      *handle = (TA_FuncHandle *)entry->funcDef;
+      return TA_SUCCESS;
+   }
+
    tmp = (char)tolower( firstChar );
 
    if( (tmp < 'a') || (tmp > 'z') )
@@ -858,6 +1005,7 @@ TA_RetCode TA_SetInputParamRealPtr( TA_ParamHolder *param,
 
    /* This parameter is now initialized, clear the corresponding bit. */
    paramHolderPriv->inBitmap &= ~(1<<paramIndex);
+   paramHolderPriv->inSingleBitmap &= ~(1<<paramIndex);
 
    return TA_SUCCESS;
 }
@@ -927,6 +1075,127 @@ TA_RetCode TA_SetInputParamPricePtr( TA_ParamHolder     *param,
 
    /* This parameter is now initialized, clear the corresponding bit. */
    paramHolderPriv->inBitmap &= ~(1<<paramIndex);
+   paramHolderPriv->inSingleBitmap &= ~(1<<paramIndex);
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_SetInputParamSingleRealPtr( TA_ParamHolder *param,
+                                          unsigned int paramIndex,
+                                          const float *value )
+{   
+   TA_ParamHolderPriv *paramHolderPriv;
+   const TA_InputParameterInfo *paramInfo;
+   const TA_FuncInfo *funcInfo;
+
+   if( (param == NULL) || (value == NULL) )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   paramHolderPriv = (TA_ParamHolderPriv *)(param->hiddenData);
+   if( paramHolderPriv->magicNumber != TA_PARAM_HOLDER_PRIV_MAGIC_NB )
+   {
+      return TA_INVALID_PARAM_HOLDER;
+   }
+
+   /* Make sure this index really exist. */
+   funcInfo = paramHolderPriv->funcInfo;
+   if( !funcInfo ) return TA_INVALID_HANDLE;
+
+   if( paramIndex >= funcInfo->nbInput )
+   {
+      return TA_BAD_PARAM;
+   }   
+
+   /* Verify the type of the parameter. */
+   paramInfo = paramHolderPriv->in[paramIndex].inputInfo;
+   if( !paramInfo ) return TA_INTERNAL_ERROR(2);
+   if( paramInfo->type != TA_Input_Real )
+   {
+      return TA_INVALID_PARAM_HOLDER_TYPE;
+   }
+
+   /* keep a copy of the provided parameter. */
+   paramHolderPriv->in[paramIndex].data.inRealS = value; 
+
+   /* This parameter is now initialized, clear the corresponding bit
+    * and remember it is single precision.
+    */
+   paramHolderPriv->inBitmap &= ~(1<<paramIndex);
+   paramHolderPriv->inSingleBitmap |= (1<<paramIndex);
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_SetInputParamSinglePricePtr( TA_ParamHolder     *param,
+                                           unsigned int        paramIndex,
+                                           const float        *open,
+                                           const float        *high,
+                                           const float        *low,
+                                           const float        *close,
+                                           const float        *volume,
+                                           const float        *openInterest )
+{
+   
+   TA_ParamHolderPriv *paramHolderPriv;
+   const TA_InputParameterInfo *paramInfo;
+   const TA_FuncInfo *funcInfo;
+
+   if( param == NULL )
+   {
+      return TA_BAD_PARAM;
+   }
+
+   paramHolderPriv = (TA_ParamHolderPriv *)(param->hiddenData);
+   if( paramHolderPriv->magicNumber != TA_PARAM_HOLDER_PRIV_MAGIC_NB )
+   {
+      return TA_INVALID_PARAM_HOLDER;
+   }
+
+   /* Make sure this index really exist. */
+   funcInfo = paramHolderPriv->funcInfo;
+   if( !funcInfo ) return TA_INVALID_HANDLE;
+   if( paramIndex >= funcInfo->nbInput )
+   {
+      return TA_BAD_PARAM;
+   }   
+
+   /* Verify the type of the parameter. */
+   paramInfo = paramHolderPriv->in[paramIndex].inputInfo;
+   if( !paramInfo ) return TA_INTERNAL_ERROR(2);
+   if( paramInfo->type != TA_Input_Price )
+   {
+      return TA_INVALID_PARAM_HOLDER_TYPE;
+   }
+
+   /* keep a copy of the provided parameter. */
+   #define SET_PARAM_INFO(lowerParam,upperParam) \
+   { \
+      if( paramInfo->flags & TA_IN_PRICE_##upperParam ) \
+      { \
+         if( lowerParam == NULL ) \
+         { \
+            return TA_BAD_PARAM; \
+         } \
+         paramHolderPriv->in[paramIndex].data.inPriceS.lowerParam = lowerParam; \
+      } \
+   }
+
+   SET_PARAM_INFO(open, OPEN );
+   SET_PARAM_INFO(high, HIGH );
+   SET_PARAM_INFO(low, LOW );
+   SET_PARAM_INFO(close, CLOSE );
+   SET_PARAM_INFO(volume, VOLUME );
+   SET_PARAM_INFO(openInterest, OPENINTEREST );
+
+   #undef SET_PARAM_INFO
+
+   /* This parameter is now initialized, clear the corresponding bit
+    * and remember it is single precision.
+    */
+   paramHolderPriv->inBitmap &= ~(1<<paramIndex);
+   paramHolderPriv->inSingleBitmap |= (1<<paramIndex);
 
    return TA_SUCCESS;
 }
@@ -1156,6 +1425,7 @@ TA_RetCode TA_CallFunc( const TA_ParamHolder *param,
    const TA_FuncDef *funcDef;
    const TA_FuncInfo *funcInfo;
    TA_FrameFunction function;
+   unsigned int i, floatBitmap;
 
    if( (param == NULL) ||
        (outBegIdx == NULL) ||
@@ -1187,6 +1457,23 @@ TA_RetCode TA_CallFunc( const TA_ParamHolder *param,
    funcDef = (const TA_FuncDef *)funcInfo->handle;
    if( !funcDef ) return TA_INTERNAL_ERROR(2);
    function = funcDef->function;
+
+   /* When some inputs are single precision, all the real and price
+    * inputs must be, and the TA_S_XXX function is called instead.
+    * Integer inputs are the same for both.
+    */
+   if( paramHolderPriv->inSingleBitmap != 0 )
+   {
+      floatBitmap = 0;
+      for( i=0; i < funcInfo->nbInput; i++ )
+      {
+         if( paramHolderPriv->in[i].inputInfo->type != TA_Input_Integer )
+            floatBitmap |= (1<<i);
+      }
+      if( paramHolderPriv->inSingleBitmap != floatBitmap )
+         return TA_BAD_PARAM;
+      function = funcDef->functionS;
+   }
    if( !function ) return TA_INTERNAL_ERROR(2);
 
    /* Perform the function call. */
@@ -1311,3 +1598,32 @@ static TA_RetCode getGroupSize( TA_GroupId groupId, unsigned int *groupSize )
       return TA_SUCCESS;
    #endif
 }
+
+static int compareFuncIndexEntry( const void *a, const void *b )
+{
+   return strcmp( ((const TA_FuncIndexEntry *)a)->funcDef->funcInfo->name,
+                  ((const TA_FuncIndexEntry *)b)->funcDef->funcInfo->name );
+}
+
+static const TA_FuncIndexEntry *findFuncIndexEntry( const char *name )
+{
+   unsigned int low, high, mid;
+   int cmp;
+
+   /* Binary search of the entries sorted by name. */
+   low = 0;
+   high = TA_FuncIndexSize;
+   while( low < high )
+   {
+      mid = low + (high-low)/2;
+      cmp = strcmp( TA_FuncByName[mid].funcDef->funcInfo->name, name );
+      if( cmp == 0 )
+         return &TA_FuncByName[mid];
+      if( cmp < 0 )
+         low = mid+1;
+      else
+         high = mid;
+   }
+
+   return NULL;
+}
@@ -169,6 +169,9 @@ typedef struct
    /* Entry point of the TA function and its lookback function. */
    const TA_FrameFunction function;
    const TA_FrameLookback lookback;
+
+   /* Entry point of the single precision (TA_S_XXX) TA function. */
+   const TA_FrameFunction functionS;
 } TA_FuncDef;
 
 /* The following MACROs are helpers being used in
@@ -193,7 +196,8 @@ typedef struct
       (const TA_OptInputParameterInfo * const)&TA_##name##_OptInputs[0], \
       (const TA_OutputParameterInfo   * const)&TA_##name##_Outputs[0],   \
       TA_##name##_FramePP, \
-      TA_##name##_FramePPLB \
+      TA_##name##_FramePPLB, \
+      TA_##name##_FramePPS \
    }; \
    TA_FuncInfo TA_INFO_##name = \
    { \
@@ -229,6 +233,7 @@ typedef struct
       (const TA_OptInputParameterInfo * const)&TA_##name##_OptInputs[0], \
       (const TA_OutputParameterInfo   * const)&TA_##name##_Outputs[0],   \
       NULL, \
+      NULL, \
       NULL \
    }; \
    TA_FuncInfo TA_INFO_##name = \
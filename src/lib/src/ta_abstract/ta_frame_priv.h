@@ -61,6 +61,16 @@ typedef struct
    const TA_Real      *openInterest;
 } TA_PricePtrs;
 
+typedef struct
+{
+   const float        *open;
+   const float        *high;
+   const float        *low;
+   const float        *close;
+   const float        *volume;
+   const float        *openInterest;
+} TA_PricePtrsS;
+
 typedef struct
 {
    union TA_ParamHolderInputData
@@ -68,6 +78,8 @@ typedef struct
       const TA_Real      *inReal;
       const TA_Integer   *inInteger;
       TA_PricePtrs        inPrice;
+      const float        *inRealS;
+      TA_PricePtrsS       inPriceS;
    } data;
 
    const TA_InputParameterInfo *inputInfo;
@@ -114,6 +126,11 @@ typedef struct
    unsigned int inBitmap;
    unsigned int outBitmap;
 
+   /* Indicate which input have been set with single precision
+    * (float) arrays. Same bit order than inBitmap.
+    */
+   unsigned int inSingleBitmap;
+
    const TA_FuncInfo *funcInfo;
 } TA_ParamHolderPriv;
 
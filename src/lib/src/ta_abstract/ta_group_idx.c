@@ -148,6 +148,7 @@ extern const TA_FuncDef TA_DEF_HT_TRENDMODE;
 extern const TA_FuncDef TA_DEF_IMI;
 extern const TA_FuncDef TA_DEF_KAMA;
 extern const TA_FuncDef TA_DEF_LINEARREG;
+extern const TA_FuncDef TA_DEF_LINEARREG_ALL;
 extern const TA_FuncDef TA_DEF_LINEARREG_ANGLE;
 extern const TA_FuncDef TA_DEF_LINEARREG_INTERCEPT;
 extern const TA_FuncDef TA_DEF_LINEARREG_SLOPE;
@@ -393,6 +394,7 @@ const TA_FuncDef *TA_PerGroupFunc_8[] = {
 &TA_DEF_BETA,
 &TA_DEF_CORREL,
 &TA_DEF_LINEARREG,
+&TA_DEF_LINEARREG_ALL,
 &TA_DEF_LINEARREG_ANGLE,
 &TA_DEF_LINEARREG_INTERCEPT,
 &TA_DEF_LINEARREG_SLOPE,
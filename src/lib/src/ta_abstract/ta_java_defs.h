@@ -238,6 +238,8 @@
 #define TA_KAMA kama
 #define TA_LINEARREG_Lookback linearRegLookback
 #define TA_LINEARREG linearReg
+#define TA_LINEARREG_ALL_Lookback linearRegAllLookback
+#define TA_LINEARREG_ALL linearRegAll
 #define TA_LINEARREG_ANGLE_Lookback linearRegAngleLookback
 #define TA_LINEARREG_ANGLE linearRegAngle
 #define TA_LINEARREG_INTERCEPT_Lookback linearRegInterceptLookback
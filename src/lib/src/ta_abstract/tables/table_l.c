@@ -74,6 +74,51 @@ DEF_FUNCTION( LINEARREG,           /* name */
              );
 /* LINEARREG END */
 
+/* LINEARREG_ALL BEGIN */
+const TA_OutputParameterInfo TA_DEF_UI_Output_Real_Slope =
+                               { TA_Output_Real, "outSlope", TA_OUT_LINE };
+
+const TA_OutputParameterInfo TA_DEF_UI_Output_Real_Intercept =
+                               { TA_Output_Real, "outIntercept", TA_OUT_LINE };
+
+const TA_OutputParameterInfo TA_DEF_UI_Output_Real_Angle =
+                               { TA_Output_Real, "outAngle", TA_OUT_LINE };
+
+const TA_OutputParameterInfo TA_DEF_UI_Output_Real_LinearReg =
+                               { TA_Output_Real, "outLinearReg", TA_OUT_LINE };
+
+const TA_OutputParameterInfo TA_DEF_UI_Output_Real_TSF =
+                               { TA_Output_Real, "outTSF", TA_OUT_LINE };
+
+static const TA_InputParameterInfo    *TA_LINEARREG_ALL_Inputs[]    =
+{
+  &TA_DEF_UI_Input_Real,
+  NULL
+};
+
+static const TA_OutputParameterInfo *TA_LINEARREG_ALL_Outputs[]   =
+{
+  &TA_DEF_UI_Output_Real_Slope,
+  &TA_DEF_UI_Output_Real_Intercept,
+  &TA_DEF_UI_Output_Real_Angle,
+  &TA_DEF_UI_Output_Real_LinearReg,
+  &TA_DEF_UI_Output_Real_TSF,
+  NULL
+};
+
+static const TA_OptInputParameterInfo *TA_LINEARREG_ALL_OptInputs[] =
+{ &TA_DEF_UI_TimePeriod_14_MINIMUM2,
+  NULL
+};
+
+DEF_FUNCTION( LINEARREG_ALL,       /* name */
+              TA_GroupId_Statistic,/* groupId */
+              "Linear Regression Slope, Intercept, Angle, Value and Time Series Forecast", /* hint */
+              "LinearRegAll",      /* CamelCase name */
+              0                    /* flags */
+             );
+/* LINEARREG_ALL END */
+
 /* LINEARREG_SLOPE BEGIN */
 static const TA_InputParameterInfo    *TA_LINEARREG_SLOPE_Inputs[]    =
 {
@@ -167,6 +212,7 @@ DEF_MATH_UNARY_OPERATOR( LOG10, "Vector Log10", "Log10" )
 const TA_FuncDef *TA_DEF_TableL[] =
 {
    ADD_TO_TABLE(LINEARREG),
+   ADD_TO_TABLE(LINEARREG_ALL),
    ADD_TO_TABLE(LINEARREG_ANGLE),
    ADD_TO_TABLE(LINEARREG_INTERCEPT),
    ADD_TO_TABLE(LINEARREG_SLOPE),
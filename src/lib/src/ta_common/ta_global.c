@@ -79,7 +79,8 @@
 /* The entry point for all globals */
 TA_LibcPriv ta_theGlobals = {0,{{0,0,0}},0,0,0,0,(TA_Compatibility)0,{0},{{(TA_CandleSettingType)0,(TA_RangeType)0,0,0}}};
 
-TA_LibcPriv *TA_Globals = &ta_theGlobals;
+/* The globals in effect on the current thread. */
+TA_THREAD_LOCAL TA_LibcPriv *ta_theThreadGlobals = &ta_theGlobals;
 
 /**** Local declarations.              ****/
 /* None */
@@ -93,11 +94,13 @@ TA_LibcPriv *TA_Globals = &ta_theGlobals;
 /**** Global functions definitions.   ****/
 TA_RetCode TA_Initialize( void )
 {
+   TA_LibcPriv *previousThreadGlobals;
+
    /* Initialize the "global variable" used to manage the global
     * variables of all other modules...
     */
-   memset( TA_Globals, 0, sizeof( TA_LibcPriv ) );
-   TA_Globals->magicNb = TA_LIBC_PRIV_MAGIC_NB;	  
+   memset( &ta_theGlobals, 0, sizeof( TA_LibcPriv ) );
+   ta_theGlobals.magicNb = TA_LIBC_PRIV_MAGIC_NB;	  
 
 #ifdef TA_LIB_PRO
       /* Section for code distributed with TA-Lib Pro only. */
@@ -105,23 +108,77 @@ TA_RetCode TA_Initialize( void )
 
    /*** At this point, TA_Shutdown can be called to clean-up. ***/
 
-   /* Set the default value to global variables */
+   /* Set the default value to global variables, even when a
+    * context is active on the calling thread.
+    */
+   previousThreadGlobals = ta_theThreadGlobals;
+   ta_theThreadGlobals = &ta_theGlobals;
    TA_RestoreCandleDefaultSettings( TA_AllCandleSettings );
+   ta_theThreadGlobals = previousThreadGlobals;
 
-   return TA_SUCCESS;
+   /* Build the index used to find the functions by name or identifier. */
+   return TA_AbstractInitialize();
 }
 
 TA_RetCode TA_Shutdown( void )
 {
-   if( TA_Globals->magicNb != TA_LIBC_PRIV_MAGIC_NB )
+   if( ta_theGlobals.magicNb != TA_LIBC_PRIV_MAGIC_NB )
       return TA_LIB_NOT_INITIALIZE;
 
    /* Initialize to all zero to make sure we invalidate that object. */
-   memset( TA_Globals, 0, sizeof( TA_LibcPriv ) );
+   memset( &ta_theGlobals, 0, sizeof( TA_LibcPriv ) );
 
    return TA_SUCCESS;
 }
 
+TA_RetCode TA_ContextAlloc( TA_Context **context )
+{
+   TA_Context *newContext;
+
+   if( context == NULL )
+      return TA_BAD_PARAM;
+
+   *context = NULL;
+
+   newContext = (TA_Context *)malloc( sizeof( TA_Context ) );
+   if( newContext == NULL )
+      return TA_ALLOC_ERR;
+
+   /* Start from the settings in effect on the calling thread. */
+   memcpy( &newContext->globals, TA_Globals, sizeof( TA_LibcPriv ) );
+
+   *context = newContext;
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_ContextFree( TA_Context *context )
+{
+   if( context )
+   {
+      if( ta_theThreadGlobals == &context->globals )
+         return TA_BAD_PARAM;
+
+      free( context );
+   }
+
+   return TA_SUCCESS;
+}
+
+TA_RetCode TA_SetThreadContext( TA_Context *context )
+{
+   ta_theThreadGlobals = context ? &context->globals : &ta_theGlobals;
+   return TA_SUCCESS;
+}
+
+TA_Context *TA_GetThreadContext( void )
+{
+   if( ta_theThreadGlobals == &ta_theGlobals )
+      return NULL;
+
+   return (TA_Context *)ta_theThreadGlobals;
+}
+
 TA_RetCode TA_SetCandleSettings( TA_CandleSettingType settingType, 
                                  TA_RangeType rangeType, 
                                  int avgPeriod, 
@@ -180,6 +237,22 @@ TA_RetCode TA_RestoreCandleDefaultSettings( TA_CandleSettingType settingType )
     return TA_SUCCESS;
 }
 
+TA_RetCode TA_GetCandleSettings( TA_CandleSettingType settingType, 
+                                 TA_RangeType *rangeType, 
+                                 int *avgPeriod, 
+                                 double *factor )
+{
+    if( settingType >= TA_AllCandleSettings )
+        return TA_BAD_PARAM;
+    if( rangeType )
+        *rangeType = TA_Globals->candleSettings[settingType].rangeType;
+    if( avgPeriod )
+        *avgPeriod = TA_Globals->candleSettings[settingType].avgPeriod;
+    if( factor )
+        *factor = TA_Globals->candleSettings[settingType].factor;
+    return TA_SUCCESS;
+}
+
 /**** Local functions definitions.     ****/
 /* None */
 
@@ -111,9 +111,36 @@ typedef struct
 
 } TA_LibcPriv;
 
+/* Builds the function index of the abstract interface. Called
+ * by TA_Initialize.
+ */
+TA_RetCode TA_AbstractInitialize( void );
+
+/* Storage class of the variables with one instance per thread. The
+ * default TLS model is kept, TA-Lib may be linked into a shared object
+ * loaded with dlopen, where the initial-exec model can fail to load.
+ */
+#if defined( _MSC_VER )
+   #define TA_THREAD_LOCAL __declspec(thread)
+#else
+   #define TA_THREAD_LOCAL __thread
+#endif
+
+/* A TA_Context is a private copy of the globals. */
+struct TA_Context
+{
+   TA_LibcPriv globals;
+};
+
+/* The process globals, and the globals in effect on the current
+ * thread: the globals of the active context, else the process globals.
+ */
+extern TA_LibcPriv ta_theGlobals;
+extern TA_THREAD_LOCAL TA_LibcPriv *ta_theThreadGlobals;
+
 /* The following global is used all over the place 
  * and is the entry point for all other globals.
  */
-extern TA_LibcPriv *TA_Globals;
+#define TA_Globals ta_theThreadGlobals
 
 #endif
@@ -357,6 +357,96 @@
          Id##_Idx = 0; \
    }
 
+/* EXTREME : Sliding Window Extreme Macros.
+ *
+ * Find the first extreme (highest or lowest) of a sliding window in
+ * amortized O(1), so the window does not have to be rescanned when
+ * its extreme leaves it (rescans are O(n*period) on trending data).
+ *
+ * The window [trailingIdx..today] is split at the index where the
+ * window was last rebuilt: the first extreme of every suffix of the
+ * older part is stored (one backward scan of the window, done at most
+ * once per period), and the first extreme of the newer part is
+ * updated by scanning only the values added since the last call.
+ * NaN values are never an extreme.
+ *
+ * The extreme is only computed when asked, so functions needing it
+ * only when their current extreme leaves the window pay nothing for
+ * the other price bars.
+ *
+ * EXTREME_PROLOG(Id,Size);
+ *          Will declare all the needed variables, Size integers might
+ *          be "allocated" on the stack.
+ *
+ * EXTREME_INIT(Id,Size);
+ *          Must be called prior to use the remaining macros. Must be
+ *          followed by EXTREME_DESTROY when leaving the function. Size is
+ *          the number of price bars in the window.
+ *
+ * EXTREME_DESTROY(Id);
+ *          Must be call prior to leave the function.
+ *
+ * EXTREME_FIND(Id,in,trailingIdx,today,CMP,resultIdx);
+ *          Set resultIdx to the first index of the window where "in[]"
+ *          is the extreme, '>' finds the highest and '<' the lowest.
+ *          in[trailingIdx] must not be NaN. The window can only move
+ *          forward between calls, and its size cannot exceed Size.
+ */
+#define EXTREME_PROLOG(Id,Size) CIRCBUF_PROLOG(Id,int,Size); \
+                                int Id##_Base; \
+                                int Id##_End; \
+                                int Id##_Tail; \
+                                int Id##_Scan; \
+                                int Id##_j
+
+#define EXTREME_INIT(Id,Size) \
+   { \
+      CIRCBUF_INIT(Id,int,Size); \
+      /* The window is indexed from its base, not circularly. */ \
+      UNUSED_VARIABLE(Id##_Idx); \
+      UNUSED_VARIABLE(maxIdx_##Id); \
+      Id##_Base = 0; \
+      Id##_End  = -1; \
+      Id##_Tail = -1; \
+      Id##_Scan = -1; \
+   }
+
+#define EXTREME_DESTROY(Id) CIRCBUF_DESTROY(Id)
+
+#define EXTREME_FIND(Id,in,trailingIdx,today,CMP,resultIdx) \
+   { \
+      if( (trailingIdx) > Id##_End ) \
+      { \
+         /* Rebuild the first extreme of every suffix of the window. */ \
+         Id##_Base = (trailingIdx); \
+         Id##_End  = (today); \
+         resultIdx = -1; \
+         for( Id##_j=(today); Id##_j >= (trailingIdx); Id##_j-- ) \
+         { \
+            if( (in[Id##_j] == in[Id##_j]) && \
+                ((resultIdx < 0) || !(in[resultIdx] CMP in[Id##_j])) ) \
+               resultIdx = Id##_j; \
+            Id[Id##_j-Id##_Base] = resultIdx; \
+         } \
+         Id##_Tail = -1; \
+         Id##_Scan = (today); \
+      } \
+      else \
+      { \
+         /* Scan the values added since the last call. */ \
+         for( Id##_j=Id##_Scan+1; Id##_j <= (today); Id##_j++ ) \
+         { \
+            if( (in[Id##_j] == in[Id##_j]) && \
+                ((Id##_Tail < 0) || (in[Id##_j] CMP in[Id##_Tail])) ) \
+               Id##_Tail = Id##_j; \
+         } \
+         Id##_Scan = (today); \
+      } \
+      resultIdx = Id[(trailingIdx)-Id##_Base]; \
+      if( (Id##_Tail >= 0) && (in[Id##_Tail] CMP in[resultIdx]) ) \
+         resultIdx = Id##_Tail; \
+   }
+
 
 #endif
 
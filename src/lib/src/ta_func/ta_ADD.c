@@ -180,6 +180,11 @@
 
 #ifdef TA_LIB_PRO
       /* Section for code distributed with TA-Lib Pro only. */
+#elif !defined( _MANAGED ) && !defined( _JAVA ) && !defined( USE_SINGLE_PRECISION_INPUT )
+      /* Vectorized kernel chosen from the CPU features, see ta_simd.c */
+      i      = startIdx;
+      outIdx = endIdx-startIdx+1;
+      TA_INT_SimdAdd( &inReal0[i], &inReal1[i], outReal, outIdx );
 #else
       for( i=startIdx, outIdx=0; i <= endIdx; i++, outIdx++ )
       {
@@ -259,6 +264,10 @@
 /* Generated */     #endif 
 /* Generated */  #endif 
 /* Generated */ #ifdef TA_LIB_PRO
+/* Generated */ #elif !defined( _MANAGED ) && !defined( _JAVA ) && !defined( USE_SINGLE_PRECISION_INPUT )
+/* Generated */       i      = startIdx;
+/* Generated */       outIdx = endIdx-startIdx+1;
+/* Generated */       TA_INT_SimdAdd( &inReal0[i], &inReal1[i], outReal, outIdx );
 /* Generated */ #else
 /* Generated */       for( i=startIdx, outIdx=0; i <= endIdx; i++, outIdx++ )
 /* Generated */       {
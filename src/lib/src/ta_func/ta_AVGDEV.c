@@ -157,6 +157,9 @@
 {
    /* insert local variable here */
 	int today, outIdx, lookback;
+	ARRAY_REF(tempBuffer);
+	int nbValues, i;
+	ENUM_DECLARATION(RetCode) retCode;
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -200,6 +203,36 @@
 		return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 	}
 
+#if !defined( _MANAGED ) && !defined( _JAVA )
+	/* Long periods use TA_INT_MeanDev instead of the two
+	 * summations over the period.
+	 * The input is copied, so inReal and outReal can still
+	 * be the same buffer.
+	 */
+	if (optInTimePeriod >= TA_MEANDEV_MIN_PERIOD) {
+		nbValues = endIdx-startIdx+1+lookback;
+		ARRAY_ALLOC(tempBuffer, nbValues);
+		if (!tempBuffer) {
+			VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+			VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+			return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+		}
+		for (i = 0; i < nbValues; i++) {
+			tempBuffer[i] = inReal[startIdx-lookback+i];
+		}
+		retCode = TA_INT_MeanDev(tempBuffer, nbValues, optInTimePeriod, NULL, outReal);
+		ARRAY_FREE(tempBuffer);
+		if (retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success)) {
+			VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+			VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+			return retCode;
+		}
+		VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+		VALUE_HANDLE_DEREF(outNBElement) = endIdx-startIdx+1;
+		return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+	}
+#endif
+
 	/* Process the initial DM and TR */
 	VALUE_HANDLE_DEREF(outBegIdx) = today;
 
@@ -274,6 +307,9 @@
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */ 	int today, outIdx, lookback;
+/* Generated */ 	ARRAY_REF(tempBuffer);
+/* Generated */ 	int nbValues, i;
+/* Generated */ 	ENUM_DECLARATION(RetCode) retCode;
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -301,6 +337,30 @@
 /* Generated */ 		VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
 /* Generated */ 		return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ 	}
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */ 	if (optInTimePeriod >= TA_MEANDEV_MIN_PERIOD) {
+/* Generated */ 		nbValues = endIdx-startIdx+1+lookback;
+/* Generated */ 		ARRAY_ALLOC(tempBuffer, nbValues);
+/* Generated */ 		if (!tempBuffer) {
+/* Generated */ 			VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */ 			VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */ 			return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+/* Generated */ 		}
+/* Generated */ 		for (i = 0; i < nbValues; i++) {
+/* Generated */ 			tempBuffer[i] = inReal[startIdx-lookback+i];
+/* Generated */ 		}
+/* Generated */ 		retCode = TA_INT_MeanDev(tempBuffer, nbValues, optInTimePeriod, NULL, outReal);
+/* Generated */ 		ARRAY_FREE(tempBuffer);
+/* Generated */ 		if (retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success)) {
+/* Generated */ 			VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */ 			VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */ 			return retCode;
+/* Generated */ 		}
+/* Generated */ 		VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+/* Generated */ 		VALUE_HANDLE_DEREF(outNBElement) = endIdx-startIdx+1;
+/* Generated */ 		return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */ 	}
+/* Generated */ #endif
 /* Generated */ 	VALUE_HANDLE_DEREF(outBegIdx) = today;
 /* Generated */ 	outIdx = 0;
 /* Generated */ 	while (today <= endIdx) {
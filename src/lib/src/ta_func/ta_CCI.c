@@ -171,6 +171,9 @@
 	/* insert local variable here */
    double tempReal, tempReal2, theAverage, lastValue;
    int i, j, outIdx, lookbackTotal;
+   ARRAY_REF(typPrice);
+   int nbValues;
+   ENUM_DECLARATION(RetCode) retCode;
 
    /* This ptr will points on a circular buffer of
     * at least "optInTimePeriod" element.
@@ -229,6 +232,56 @@
       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
    }
 
+#if !defined( _MANAGED ) && !defined( _JAVA )
+   /* Long periods get the average and the mean deviation
+    * from TA_INT_MeanDev instead of the two summations over
+    * the whole period.
+    */
+   if( optInTimePeriod >= TA_MEANDEV_MIN_PERIOD )
+   {
+      /* The typical prices are followed by room for the
+       * averages. Being a copy, the inputs and outReal can
+       * still be the same buffer.
+       */
+      nbValues = endIdx-startIdx+1+lookbackTotal;
+      ARRAY_ALLOC( typPrice, nbValues*2 );
+      if( !typPrice )
+      {
+         VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+         VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+         return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+      }
+
+      for( i=0, j=startIdx-lookbackTotal; i < nbValues; i++, j++ )
+         typPrice[i] = (inHigh[j]+inLow[j]+inClose[j])/3;
+
+      retCode = TA_INT_MeanDev( typPrice, nbValues, optInTimePeriod,
+                                &typPrice[nbValues], outReal );
+      if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
+      {
+         ARRAY_FREE( typPrice );
+         VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+         VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+         return retCode;
+      }
+
+      for( outIdx=0; outIdx < nbValues-lookbackTotal; outIdx++ )
+      {
+         tempReal  = typPrice[outIdx+lookbackTotal]-typPrice[nbValues+outIdx];
+         tempReal2 = outReal[outIdx];
+         if( (tempReal != 0.0) && (tempReal2 != 0.0) )
+            outReal[outIdx] = tempReal/(0.015*tempReal2);
+         else
+            outReal[outIdx] = 0.0;
+      }
+
+      ARRAY_FREE( typPrice );
+      VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+      VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+#endif
+
    /* Allocate a circular buffer equal to the requested
     * period.
     */
@@ -353,6 +406,9 @@
 /* Generated */ {
 /* Generated */    double tempReal, tempReal2, theAverage, lastValue;
 /* Generated */    int i, j, outIdx, lookbackTotal;
+/* Generated */    ARRAY_REF(typPrice);
+/* Generated */    int nbValues;
+/* Generated */    ENUM_DECLARATION(RetCode) retCode;
 /* Generated */    CIRCBUF_PROLOG(circBuffer,double,30);
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
@@ -381,6 +437,43 @@
 /* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
 /* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */    }
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */    if( optInTimePeriod >= TA_MEANDEV_MIN_PERIOD )
+/* Generated */    {
+/* Generated */       nbValues = endIdx-startIdx+1+lookbackTotal;
+/* Generated */       ARRAY_ALLOC( typPrice, nbValues*2 );
+/* Generated */       if( !typPrice )
+/* Generated */       {
+/* Generated */          VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */          VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */          return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+/* Generated */       }
+/* Generated */       for( i=0, j=startIdx-lookbackTotal; i < nbValues; i++, j++ )
+/* Generated */          typPrice[i] = (inHigh[j]+inLow[j]+inClose[j])/3;
+/* Generated */       retCode = TA_INT_MeanDev( typPrice, nbValues, optInTimePeriod,
+/* Generated */                                 &typPrice[nbValues], outReal );
+/* Generated */       if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
+/* Generated */       {
+/* Generated */          ARRAY_FREE( typPrice );
+/* Generated */          VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */          VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */          return retCode;
+/* Generated */       }
+/* Generated */       for( outIdx=0; outIdx < nbValues-lookbackTotal; outIdx++ )
+/* Generated */       {
+/* Generated */          tempReal  = typPrice[outIdx+lookbackTotal]-typPrice[nbValues+outIdx];
+/* Generated */          tempReal2 = outReal[outIdx];
+/* Generated */          if( (tempReal != 0.0) && (tempReal2 != 0.0) )
+/* Generated */             outReal[outIdx] = tempReal/(0.015*tempReal2);
+/* Generated */          else
+/* Generated */             outReal[outIdx] = 0.0;
+/* Generated */       }
+/* Generated */       ARRAY_FREE( typPrice );
+/* Generated */       VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+/* Generated */       VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
+/* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */    }
+/* Generated */ #endif
 /* Generated */    CIRCBUF_INIT( circBuffer, double, optInTimePeriod );
 /* Generated */    i=startIdx-lookbackTotal;
 /* Generated */    if( optInTimePeriod > 1 )
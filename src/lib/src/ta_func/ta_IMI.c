@@ -283,6 +283,7 @@
 /* Generated */                      double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
+/* Generated */    int lookback, outIdx = 0;
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -301,8 +302,32 @@
 /* Generated */        return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
 /* Generated */     #endif 
 /* Generated */  #endif 
-/* Generated */    VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-/* Generated */    VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */    lookback = LOOKBACK_CALL(IMI)( optInTimePeriod );
+/* Generated */    if(startIdx < lookback)
+/* Generated */       startIdx = lookback;
+/* Generated */    if( startIdx > endIdx ) {
+/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */    }
+/* Generated */    VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+/* Generated */    while (startIdx <= endIdx) {
+/* Generated */       double upsum = .0, downsum = .0;
+/* Generated */       int i;
+/* Generated */       for (i = startIdx - lookback; i <= startIdx; i++) {
+/* Generated */          double close = inClose[i];
+/* Generated */          double open = inOpen[i];
+/* Generated */          if (close > open) {
+/* Generated */             upsum += (close - open);
+/* Generated */          } else {
+/* Generated */             downsum += (open - close);
+/* Generated */          }
+/* Generated */          outReal[outIdx] = 100.0*(upsum/(upsum + downsum));
+/* Generated */       }
+/* Generated */       startIdx++;
+/* Generated */       outIdx++;
+/* Generated */    }
+/* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
 /* Generated */ }
 /* Generated */ 
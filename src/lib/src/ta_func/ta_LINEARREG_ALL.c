@@ -0,0 +1,595 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**** START GENCODE SECTION 1 - DO NOT DELETE THIS LINE ****/
+/* All code within this section is automatically
+ * generated by gen_code. Any modification will be lost
+ * next time gen_code is run.
+ */
+/* Generated */ 
+/* Generated */ #if defined( _MANAGED )
+/* Generated */    #include "TA-Lib-Core.h"
+/* Generated */    #define TA_INTERNAL_ERROR(Id) (RetCode::InternalError)
+/* Generated */    namespace TicTacTec { namespace TA { namespace Library {
+/* Generated */ #elif defined( _JAVA )
+/* Generated */    #include "ta_defs.h"
+/* Generated */    #include "ta_java_defs.h"
+/* Generated */    #define TA_INTERNAL_ERROR(Id) (RetCode.InternalError)
+/* Generated */ #else
+/* Generated */    #include <string.h>
+/* Generated */    #include <math.h>
+/* Generated */    #include "ta_func.h"
+/* Generated */ #endif
+/* Generated */ 
+/* Generated */ #ifndef TA_UTILITY_H
+/* Generated */    #include "ta_utility.h"
+/* Generated */ #endif
+/* Generated */ 
+/* Generated */ #ifndef TA_MEMORY_H
+/* Generated */    #include "ta_memory.h"
+/* Generated */ #endif
+/* Generated */ 
+/* Generated */ #define TA_PREFIX(x) TA_##x
+/* Generated */ #define INPUT_TYPE   double
+/* Generated */ 
+/* Generated */ #if defined( _MANAGED )
+/* Generated */ int Core::LinearRegAllLookback( int           optInTimePeriod )  /* From 2 to 100000 */
+/* Generated */ 
+/* Generated */ #elif defined( _JAVA )
+/* Generated */ public int linearRegAllLookback( int           optInTimePeriod )  /* From 2 to 100000 */
+/* Generated */ 
+/* Generated */ #else
+/* Generated */ int TA_LINEARREG_ALL_Lookback( int           optInTimePeriod )  /* From 2 to 100000 */
+/* Generated */ 
+/* Generated */ #endif
+/**** END GENCODE SECTION 1 - DO NOT DELETE THIS LINE ****/
+{
+   /* insert local variable here */
+
+/**** START GENCODE SECTION 2 - DO NOT DELETE THIS LINE ****/
+/* Generated */ #ifndef TA_FUNC_NO_RANGE_CHECK
+/* Generated */    /* min/max are checked for optInTimePeriod. */
+/* Generated */    if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+/* Generated */       optInTimePeriod = 14;
+/* Generated */    else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+/* Generated */       return -1;
+/* Generated */ 
+/* Generated */ #endif /* TA_FUNC_NO_RANGE_CHECK */
+/**** END GENCODE SECTION 2 - DO NOT DELETE THIS LINE ****/
+
+   /* insert lookback code here. */
+   return optInTimePeriod-1;
+}
+
+/**** START GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
+/*
+ * TA_LINEARREG_ALL - Linear Regression Slope, Intercept, Angle, Value and Time Series Forecast
+ * 
+ * Input  = double
+ * Output = double, double, double, double, double
+ * 
+ * Optional Parameters
+ * -------------------
+ * optInTimePeriod:(From 2 to 100000)
+ *    Number of period
+ * 
+ * 
+ */
+/* Generated */ 
+/* Generated */ #if defined( _MANAGED ) && defined( USE_SUBARRAY )
+/* Generated */ enum class Core::RetCode Core::LinearRegAll( int    startIdx,
+/* Generated */                                              int    endIdx,
+/* Generated */                                              SubArray<double>^ inReal,
+/* Generated */                                              int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                              [Out]int%    outBegIdx,
+/* Generated */                                              [Out]int%    outNBElement,
+/* Generated */                                              SubArray<double>^  outSlope,
+/* Generated */                                              SubArray<double>^  outIntercept,
+/* Generated */                                              SubArray<double>^  outAngle,
+/* Generated */                                              SubArray<double>^  outLinearReg,
+/* Generated */                                              SubArray<double>^  outTSF )
+/* Generated */ #elif defined( _MANAGED )
+/* Generated */ enum class Core::RetCode Core::LinearRegAll( int    startIdx,
+/* Generated */                                              int    endIdx,
+/* Generated */                                              cli::array<double>^ inReal,
+/* Generated */                                              int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                              [Out]int%    outBegIdx,
+/* Generated */                                              [Out]int%    outNBElement,
+/* Generated */                                              cli::array<double>^  outSlope,
+/* Generated */                                              cli::array<double>^  outIntercept,
+/* Generated */                                              cli::array<double>^  outAngle,
+/* Generated */                                              cli::array<double>^  outLinearReg,
+/* Generated */                                              cli::array<double>^  outTSF )
+/* Generated */ #elif defined( _JAVA )
+/* Generated */ public RetCode linearRegAll( int    startIdx,
+/* Generated */                              int    endIdx,
+/* Generated */                              double       inReal[],
+/* Generated */                              int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                              MInteger     outBegIdx,
+/* Generated */                              MInteger     outNBElement,
+/* Generated */                              double        outSlope[],
+/* Generated */                              double        outIntercept[],
+/* Generated */                              double        outAngle[],
+/* Generated */                              double        outLinearReg[],
+/* Generated */                              double        outTSF[] )
+/* Generated */ #else
+/* Generated */ TA_RetCode TA_LINEARREG_ALL( int    startIdx,
+/* Generated */                              int    endIdx,
+/* Generated */                              const double inReal[],
+/* Generated */                              int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                              int          *outBegIdx,
+/* Generated */                              int          *outNBElement,
+/* Generated */                              double        outSlope[],
+/* Generated */                              double        outIntercept[],
+/* Generated */                              double        outAngle[],
+/* Generated */                              double        outLinearReg[],
+/* Generated */                              double        outTSF[] )
+/* Generated */ #endif
+/**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
+{
+   /* insert local variable here */
+
+/**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
+/* Generated */ 
+/* Generated */ #ifndef TA_FUNC_NO_RANGE_CHECK
+/* Generated */ 
+/* Generated */    /* Validate the requested output range. */
+/* Generated */    if( startIdx < 0 )
+/* Generated */       return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
+/* Generated */    if( (endIdx < 0) || (endIdx < startIdx))
+/* Generated */       return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_END_INDEX,OutOfRangeEndIndex);
+/* Generated */ 
+/* Generated */    #if !defined(_JAVA)
+/* Generated */    if( !inReal ) return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */    #endif /* !defined(_JAVA)*/
+/* Generated */    /* min/max are checked for optInTimePeriod. */
+/* Generated */    if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+/* Generated */       optInTimePeriod = 14;
+/* Generated */    else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+/* Generated */       return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */ 
+/* Generated */    #if !defined(_JAVA)
+/* Generated */    if( !outSlope )
+/* Generated */       return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */ 
+/* Generated */    if( !outIntercept )
+/* Generated */       return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */ 
+/* Generated */    if( !outAngle )
+/* Generated */       return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */ 
+/* Generated */    if( !outLinearReg )
+/* Generated */       return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */ 
+/* Generated */    if( !outTSF )
+/* Generated */       return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */ 
+/* Generated */    #endif /* !defined(_JAVA) */
+/* Generated */ #endif /* TA_FUNC_NO_RANGE_CHECK */
+/* Generated */ 
+/**** END GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
+
+   /* Insert TA function code here. */
+
+   /* All the outputs of the linear regression family
+    * from a single pass over the input.
+    */
+   return FUNCTION_CALL(INT_LINEARREG)( startIdx, endIdx,
+                                        inReal, optInTimePeriod,
+                                        outBegIdx, outNBElement,
+                                        outSlope, outIntercept, outAngle,
+                                        outLinearReg, outTSF );
+}
+
+#if defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined(USE_SINGLE_PRECISION_INPUT)
+   // No INT function
+#else
+
+#if defined( _MANAGED ) && defined( USE_SUBARRAY )
+ enum class Core::RetCode Core::TA_INT_LINEARREG( int     startIdx,
+                                                  int     endIdx,
+                                                  SubArray<double>^ inReal,
+                                                  int     optInTimePeriod,
+                                                  [Out]int% outBegIdx,
+                                                  [Out]int% outNBElement,
+                                                  SubArray<double>^  outSlope,
+                                                  SubArray<double>^  outIntercept,
+                                                  SubArray<double>^  outAngle,
+                                                  SubArray<double>^  outLinearReg,
+                                                  SubArray<double>^  outTSF )
+#elif defined( _MANAGED )
+ enum class Core::RetCode Core::TA_INT_LINEARREG( int     startIdx,
+                                                  int     endIdx,
+                                                  cli::array<INPUT_TYPE>^ inReal,
+                                                  int     optInTimePeriod,
+                                                  [Out]int% outBegIdx,
+                                                  [Out]int% outNBElement,
+                                                  cli::array<double>^  outSlope,
+                                                  cli::array<double>^  outIntercept,
+                                                  cli::array<double>^  outAngle,
+                                                  cli::array<double>^  outLinearReg,
+                                                  cli::array<double>^  outTSF )
+#elif defined( _JAVA )
+RetCode TA_INT_LINEARREG( int    startIdx,
+                          int    endIdx,
+                          INPUT_TYPE inReal[],
+                          int      optInTimePeriod, /* From 2 to 100000 */
+                          MInteger outBegIdx,
+                          MInteger outNBElement,
+                          double   outSlope[],
+                          double   outIntercept[],
+                          double   outAngle[],
+                          double   outLinearReg[],
+                          double   outTSF[] )
+#else
+TA_RetCode TA_PREFIX(INT_LINEARREG)( int    startIdx,
+                                     int    endIdx,
+                                     const INPUT_TYPE *inReal,
+                                     int      optInTimePeriod, /* From 2 to 100000 */
+                                     int     *outBegIdx,
+                                     int     *outNBElement,
+                                     double  *outSlope,
+                                     double  *outIntercept,
+                                     double  *outAngle,
+                                     double  *outLinearReg,
+                                     double  *outTSF )
+#endif
+{
+   int outIdx;
+
+   int today, lookbackTotal, nextResync;
+   double SumX, SumXY, SumY, SumXSqr, Divisor;
+
+   double m, b;
+   int i;
+
+   double tempValue1, tempValue2;
+
+   /* Any of the outputs can be NULL, only the
+    * requested ones are calculated.
+    *
+    * For each point, a straight line over the specified
+    * previous bar period is determined in terms
+    * of y = b + m*x, where x counts back from the
+    * last bar of the period (see TA_LINEARREG):
+    *
+    * outSlope    : 'm'
+    * outIntercept: 'b'
+    * outAngle    : 'm' in degree.
+    * outLinearReg: b+m*(period-1)
+    * outTSF      : b+m*(period)
+    */
+
+   /* Adjust startIdx to account for the lookback period. */
+   lookbackTotal = optInTimePeriod-1;
+
+   if( startIdx < lookbackTotal )
+      startIdx = lookbackTotal;
+
+   /* Make sure there is still something to evaluate. */
+   if( startIdx > endIdx )
+   {
+      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   }
+
+   outIdx = 0; /* Index into the output. */
+   today = startIdx;
+
+   SumX = optInTimePeriod * ( optInTimePeriod - 1 ) * 0.5;
+   SumXSqr = optInTimePeriod * ( optInTimePeriod - 1 ) * ( 2 * optInTimePeriod - 1 ) / 6;
+   Divisor = SumX * SumX - optInTimePeriod * SumXSqr;
+
+   /* SumY and SumXY are slid along the input in O(1) per
+    * price bar. Moving the period by one bar adds one to
+    * every x, so:
+    *    SumXY' = SumXY + SumY - period * (value leaving the period)
+    *
+    * To bound the rounding drift, the sums are recalculated
+    * from the period every 'period' bars (still O(1) per bar
+    * on average), and whenever a non-finite value (NaN or
+    * infinity) enters or leaves the period.
+    */
+   SumXY = 0;
+   SumY = 0;
+   nextResync = today;
+
+   while( today <= endIdx )
+   {
+     if( today >= nextResync )
+     {
+       SumXY = 0;
+       SumY = 0;
+       for( i = optInTimePeriod; i-- != 0; )
+       {
+         SumY += tempValue1 = inReal[today - i];
+         SumXY += (double)i * tempValue1;
+       }
+       nextResync = today + optInTimePeriod;
+     }
+
+     /* Value leaving the period, read before the outputs
+      * are written in case the input is also an output.
+      */
+     tempValue1 = inReal[today - lookbackTotal];
+
+     m = ( optInTimePeriod * SumXY - SumX * SumY) / Divisor;
+     b = ( SumY - m * SumX ) / (double)optInTimePeriod;
+     if( outSlope != NULL )
+       outSlope[outIdx] = m;
+     if( outIntercept != NULL )
+       outIntercept[outIdx] = b;
+     if( outAngle != NULL )
+       outAngle[outIdx] = std_atan(m) * ( 180.0 / PI );
+     if( outLinearReg != NULL )
+       outLinearReg[outIdx] = b + m * (double)(optInTimePeriod-1);
+     if( outTSF != NULL )
+       outTSF[outIdx] = b + m * (double)optInTimePeriod;
+     outIdx++;
+
+     /* Slide the sums to the next period. */
+     if( today < endIdx )
+     {
+       tempValue2 = inReal[today+1];
+       SumXY += SumY - optInTimePeriod * tempValue1;
+       SumY += tempValue2 - tempValue1;
+       if( (tempValue1 - tempValue1 != 0.0) || (tempValue2 - tempValue2 != 0.0) )
+         nextResync = today+1;
+     }
+     today++;
+   }
+
+   VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+
+   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+}
+
+#endif // Not defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined(USE_SINGLE_PRECISION_INPUT)
+
+/**** START GENCODE SECTION 5 - DO NOT DELETE THIS LINE ****/
+/* Generated */ 
+/* Generated */ #define  USE_SINGLE_PRECISION_INPUT
+/* Generated */ #undef  TA_LIB_PRO
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA )
+/* Generated */    #undef   TA_PREFIX
+/* Generated */    #define  TA_PREFIX(x) TA_S_##x
+/* Generated */ #endif
+/* Generated */ #undef   INPUT_TYPE
+/* Generated */ #define  INPUT_TYPE float
+/* Generated */ #if defined( _MANAGED ) && defined( USE_SUBARRAY )
+/* Generated */ enum class Core::RetCode Core::LinearRegAll( int    startIdx,
+/* Generated */                                              int    endIdx,
+/* Generated */                                              SubArray<float>^ inReal,
+/* Generated */                                              int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                              [Out]int%    outBegIdx,
+/* Generated */                                              [Out]int%    outNBElement,
+/* Generated */                                              SubArray<double>^  outSlope,
+/* Generated */                                              SubArray<double>^  outIntercept,
+/* Generated */                                              SubArray<double>^  outAngle,
+/* Generated */                                              SubArray<double>^  outLinearReg,
+/* Generated */                                              SubArray<double>^  outTSF )
+/* Generated */ #elif defined( _MANAGED )
+/* Generated */ enum class Core::RetCode Core::LinearRegAll( int    startIdx,
+/* Generated */                                              int    endIdx,
+/* Generated */                                              cli::array<float>^ inReal,
+/* Generated */                                              int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                              [Out]int%    outBegIdx,
+/* Generated */                                              [Out]int%    outNBElement,
+/* Generated */                                              cli::array<double>^  outSlope,
+/* Generated */                                              cli::array<double>^  outIntercept,
+/* Generated */                                              cli::array<double>^  outAngle,
+/* Generated */                                              cli::array<double>^  outLinearReg,
+/* Generated */                                              cli::array<double>^  outTSF )
+/* Generated */ #elif defined( _JAVA )
+/* Generated */ public RetCode linearRegAll( int    startIdx,
+/* Generated */                              int    endIdx,
+/* Generated */                              float        inReal[],
+/* Generated */                              int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                              MInteger     outBegIdx,
+/* Generated */                              MInteger     outNBElement,
+/* Generated */                              double        outSlope[],
+/* Generated */                              double        outIntercept[],
+/* Generated */                              double        outAngle[],
+/* Generated */                              double        outLinearReg[],
+/* Generated */                              double        outTSF[] )
+/* Generated */ #else
+/* Generated */ TA_RetCode TA_S_LINEARREG_ALL( int    startIdx,
+/* Generated */                                int    endIdx,
+/* Generated */                                const float  inReal[],
+/* Generated */                                int           optInTimePeriod, /* From 2 to 100000 */
+/* Generated */                                int          *outBegIdx,
+/* Generated */                                int          *outNBElement,
+/* Generated */                                double        outSlope[],
+/* Generated */                                double        outIntercept[],
+/* Generated */                                double        outAngle[],
+/* Generated */                                double        outLinearReg[],
+/* Generated */                                double        outTSF[] )
+/* Generated */ #endif
+/* Generated */ {
+/* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
+/* Generated */     if( startIdx < 0 )
+/* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
+/* Generated */     if( (endIdx < 0) || (endIdx < startIdx))
+/* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_END_INDEX,OutOfRangeEndIndex);
+/* Generated */     #if !defined(_JAVA)
+/* Generated */     if( !inReal ) return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */     #endif 
+/* Generated */     if( (int)optInTimePeriod == TA_INTEGER_DEFAULT )
+/* Generated */        optInTimePeriod = 14;
+/* Generated */     else if( ((int)optInTimePeriod < 2) || ((int)optInTimePeriod > 100000) )
+/* Generated */        return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */     #if !defined(_JAVA)
+/* Generated */     if( !outSlope )
+/* Generated */        return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */     if( !outIntercept )
+/* Generated */        return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */     if( !outAngle )
+/* Generated */        return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */     if( !outLinearReg )
+/* Generated */        return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */     if( !outTSF )
+/* Generated */        return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
+/* Generated */     #endif 
+/* Generated */  #endif 
+/* Generated */    return FUNCTION_CALL(INT_LINEARREG)( startIdx, endIdx,
+/* Generated */                                         inReal, optInTimePeriod,
+/* Generated */                                         outBegIdx, outNBElement,
+/* Generated */                                         outSlope, outIntercept, outAngle,
+/* Generated */                                         outLinearReg, outTSF );
+/* Generated */ }
+/* Generated */ #if defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined(USE_SINGLE_PRECISION_INPUT)
+/* Generated */    // No INT function
+/* Generated */ #else
+/* Generated */ #if defined( _MANAGED ) && defined( USE_SUBARRAY )
+/* Generated */  enum class Core::RetCode Core::TA_INT_LINEARREG( int     startIdx,
+/* Generated */                                                   int     endIdx,
+/* Generated */                                                   SubArray<double>^ inReal,
+/* Generated */                                                   int     optInTimePeriod,
+/* Generated */                                                   [Out]int% outBegIdx,
+/* Generated */                                                   [Out]int% outNBElement,
+/* Generated */                                                   SubArray<double>^  outSlope,
+/* Generated */                                                   SubArray<double>^  outIntercept,
+/* Generated */                                                   SubArray<double>^  outAngle,
+/* Generated */                                                   SubArray<double>^  outLinearReg,
+/* Generated */                                                   SubArray<double>^  outTSF )
+/* Generated */ #elif defined( _MANAGED )
+/* Generated */  enum class Core::RetCode Core::TA_INT_LINEARREG( int     startIdx,
+/* Generated */                                                   int     endIdx,
+/* Generated */                                                   cli::array<INPUT_TYPE>^ inReal,
+/* Generated */                                                   int     optInTimePeriod,
+/* Generated */                                                   [Out]int% outBegIdx,
+/* Generated */                                                   [Out]int% outNBElement,
+/* Generated */                                                   cli::array<double>^  outSlope,
+/* Generated */                                                   cli::array<double>^  outIntercept,
+/* Generated */                                                   cli::array<double>^  outAngle,
+/* Generated */                                                   cli::array<double>^  outLinearReg,
+/* Generated */                                                   cli::array<double>^  outTSF )
+/* Generated */ #elif defined( _JAVA )
+/* Generated */ RetCode TA_INT_LINEARREG( int    startIdx,
+/* Generated */                           int    endIdx,
+/* Generated */                           INPUT_TYPE inReal[],
+/* Generated */                           int      optInTimePeriod, 
+/* Generated */                           MInteger outBegIdx,
+/* Generated */                           MInteger outNBElement,
+/* Generated */                           double   outSlope[],
+/* Generated */                           double   outIntercept[],
+/* Generated */                           double   outAngle[],
+/* Generated */                           double   outLinearReg[],
+/* Generated */                           double   outTSF[] )
+/* Generated */ #else
+/* Generated */ TA_RetCode TA_PREFIX(INT_LINEARREG)( int    startIdx,
+/* Generated */                                      int    endIdx,
+/* Generated */                                      const INPUT_TYPE *inReal,
+/* Generated */                                      int      optInTimePeriod, 
+/* Generated */                                      int     *outBegIdx,
+/* Generated */                                      int     *outNBElement,
+/* Generated */                                      double  *outSlope,
+/* Generated */                                      double  *outIntercept,
+/* Generated */                                      double  *outAngle,
+/* Generated */                                      double  *outLinearReg,
+/* Generated */                                      double  *outTSF )
+/* Generated */ #endif
+/* Generated */ {
+/* Generated */    int outIdx;
+/* Generated */    int today, lookbackTotal, nextResync;
+/* Generated */    double SumX, SumXY, SumY, SumXSqr, Divisor;
+/* Generated */    double m, b;
+/* Generated */    int i;
+/* Generated */    double tempValue1, tempValue2;
+/* Generated */    lookbackTotal = optInTimePeriod-1;
+/* Generated */    if( startIdx < lookbackTotal )
+/* Generated */       startIdx = lookbackTotal;
+/* Generated */    if( startIdx > endIdx )
+/* Generated */    {
+/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */    }
+/* Generated */    outIdx = 0; 
+/* Generated */    today = startIdx;
+/* Generated */    SumX = optInTimePeriod * ( optInTimePeriod - 1 ) * 0.5;
+/* Generated */    SumXSqr = optInTimePeriod * ( optInTimePeriod - 1 ) * ( 2 * optInTimePeriod - 1 ) / 6;
+/* Generated */    Divisor = SumX * SumX - optInTimePeriod * SumXSqr;
+/* Generated */    SumXY = 0;
+/* Generated */    SumY = 0;
+/* Generated */    nextResync = today;
+/* Generated */    while( today <= endIdx )
+/* Generated */    {
+/* Generated */      if( today >= nextResync )
+/* Generated */      {
+/* Generated */        SumXY = 0;
+/* Generated */        SumY = 0;
+/* Generated */        for( i = optInTimePeriod; i-- != 0; )
+/* Generated */        {
+/* Generated */          SumY += tempValue1 = inReal[today - i];
+/* Generated */          SumXY += (double)i * tempValue1;
+/* Generated */        }
+/* Generated */        nextResync = today + optInTimePeriod;
+/* Generated */      }
+/* Generated */      tempValue1 = inReal[today - lookbackTotal];
+/* Generated */      m = ( optInTimePeriod * SumXY - SumX * SumY) / Divisor;
+/* Generated */      b = ( SumY - m * SumX ) / (double)optInTimePeriod;
+/* Generated */      if( outSlope != NULL )
+/* Generated */        outSlope[outIdx] = m;
+/* Generated */      if( outIntercept != NULL )
+/* Generated */        outIntercept[outIdx] = b;
+/* Generated */      if( outAngle != NULL )
+/* Generated */        outAngle[outIdx] = std_atan(m) * ( 180.0 / PI );
+/* Generated */      if( outLinearReg != NULL )
+/* Generated */        outLinearReg[outIdx] = b + m * (double)(optInTimePeriod-1);
+/* Generated */      if( outTSF != NULL )
+/* Generated */        outTSF[outIdx] = b + m * (double)optInTimePeriod;
+/* Generated */      outIdx++;
+/* Generated */      if( today < endIdx )
+/* Generated */      {
+/* Generated */        tempValue2 = inReal[today+1];
+/* Generated */        SumXY += SumY - optInTimePeriod * tempValue1;
+/* Generated */        SumY += tempValue2 - tempValue1;
+/* Generated */        if( (tempValue1 - tempValue1 != 0.0) || (tempValue2 - tempValue2 != 0.0) )
+/* Generated */          nextResync = today+1;
+/* Generated */      }
+/* Generated */      today++;
+/* Generated */    }
+/* Generated */    VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+/* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
+/* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */ }
+/* Generated */ #endif // Not defined( _MANAGED ) && defined( USE_SUBARRAY ) && defined(USE_SINGLE_PRECISION_INPUT)
+/* Generated */ 
+/* Generated */ #if defined( _MANAGED )
+/* Generated */ }}} // Close namespace TicTacTec.TA.Lib
+/* Generated */ #endif
+/**** END GENCODE SECTION 5 - DO NOT DELETE THIS LINE ****/
+
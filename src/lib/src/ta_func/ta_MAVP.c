@@ -189,8 +189,16 @@
 {
    /* insert local variable here */
    int i, j, lookbackTotal, outputSize, tempInt, curPeriod;
+   int lowPeriod, highPeriod, firstIdx, prefixBase;
+   double tempReal, sumHigh, sumLow;
    ARRAY_INT_REF(localPeriodArray);
+   ARRAY_INT_REF(nextSamePeriod);
+   ARRAY_INT_REF(firstPeriodIdx);
+   ARRAY_INT_REF(lastPeriodIdx);
    ARRAY_REF(localOutputArray);
+   ARRAY_REF(localResultArray);
+   ARRAY_REF(prefixHigh);
+   ARRAY_REF(prefixLow);
    VALUE_HANDLE_INT(localBegIdx);
    VALUE_HANDLE_INT(localNbElement);
    ENUM_DECLARATION(RetCode) retCode;
@@ -272,68 +280,175 @@
    }   
    outputSize = endIdx - tempInt + 1;
 
-   /* Allocate intermediate local buffer. */
-   ARRAY_ALLOC(localOutputArray,outputSize);
+   /* Copy caller array of period into local buffer.
+    * At the same time, truncate to min/max and find the
+    * range of periods in use.
+    */
    ARRAY_INT_ALLOC(localPeriodArray,outputSize);
+   #if !defined(_JAVA)
+      if( !localPeriodArray )
+      {
+         VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+         VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+         return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+      }
+   #endif
 
-   /* Copy caller array of period into local buffer.
-    * At the same time, truncate to min/max.
-	*/
+   lowPeriod  = optInMaxPeriod;
+   highPeriod = optInMinPeriod;
    for( i=0; i < outputSize; i++ )
    {
       tempInt = (int)(inPeriods[startIdx+i]);
-	  if( tempInt < optInMinPeriod )
-		  tempInt = optInMinPeriod;
-	  else if( tempInt > optInMaxPeriod )
-          tempInt = optInMaxPeriod;
+      if( tempInt < optInMinPeriod )
+         tempInt = optInMinPeriod;
+      else if( tempInt > optInMaxPeriod )
+         tempInt = optInMaxPeriod;
       localPeriodArray[i] = tempInt;
+      if( tempInt < lowPeriod )
+         lowPeriod = tempInt;
+      if( tempInt > highPeriod )
+         highPeriod = tempInt;
    }
 
-   /* Process each element of the input. 
-    * For each possible period value, the MA is calculated 
-	* only once.
-	* The outReal is then fill up for all element with
-	* the same period.
-	* A local flag (value 0) is set in localPeriodArray
-	* to avoid doing a second time the same calculation.
-	*/   
-   for( i=0; i < outputSize; i++ )
+   /* The simple moving average of every element comes from the
+    * difference of two prefix sums, O(1) per element whatever the
+    * number of distinct periods. The prefix sums are compensated
+    * (the rounding error of each addition is accumulated in
+    * prefixLow) so the difference stays accurate on long inputs.
+    */
+   prefixBase = startIdx-highPeriod+1;
+   if( (optInMAType == ENUM_VALUE(MAType,TA_MAType_SMA,Sma)) && (prefixBase >= 0) )
    {
-	   curPeriod = localPeriodArray[i];
-	   if( curPeriod != 0 )
-	   {
-           /* TODO: This portion of the function can be slightly speed 
-            *       optimized by making the function without unstable period 
-	        *       start their calculation at 'startIdx+i' instead of startIdx.			
-	        */
+      ARRAY_ALLOC(prefixHigh,endIdx-prefixBase+2);
+      ARRAY_ALLOC(prefixLow,endIdx-prefixBase+2);
+      #if !defined(_JAVA)
+         if( !prefixHigh || !prefixLow )
+         {
+            ARRAY_FREE_COND(prefixHigh,prefixHigh);
+            ARRAY_FREE_COND(prefixLow,prefixLow);
+            ARRAY_INT_FREE(localPeriodArray);
+            VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+            VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+            return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+         }
+      #endif
+
+      sumHigh = 0.0;
+      sumLow  = 0.0;
+      prefixHigh[0] = 0.0;
+      prefixLow[0]  = 0.0;
+      for( i=prefixBase, j=1; i <= endIdx; i++, j++ )
+      {
+         tempReal = sumHigh+inReal[i];
+         if( std_fabs(sumHigh) >= std_fabs(inReal[i]) )
+            sumLow += (sumHigh-tempReal)+inReal[i];
+         else
+            sumLow += (inReal[i]-tempReal)+sumHigh;
+         sumHigh = tempReal;
+         prefixHigh[j] = sumHigh;
+         prefixLow[j]  = sumLow;
+      }
+
+      /* Done with the inputs, outReal can be written. */
+      for( i=0; i < outputSize; i++ )
+      {
+         curPeriod = localPeriodArray[i];
+         j = startIdx+i-prefixBase+1;
+         outReal[i] = ((prefixHigh[j]-prefixHigh[j-curPeriod]) +
+                       (prefixLow[j]-prefixLow[j-curPeriod])) / curPeriod;
+      }
 
-		   /* Calculation of the MA required. */
-		   retCode = FUNCTION_CALL(MA)( startIdx, endIdx, inReal,
-			                            curPeriod, optInMAType,
-									    VALUE_HANDLE_OUT(localBegIdx),VALUE_HANDLE_OUT(localNbElement),localOutputArray );
+      ARRAY_FREE(prefixHigh);
+      ARRAY_FREE(prefixLow);
+      ARRAY_INT_FREE(localPeriodArray);
 
-           if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
-		   {
-              ARRAY_FREE(localOutputArray);
-			  ARRAY_INT_FREE(localPeriodArray);
-              VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-              VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-              return retCode;
-	       }
-		   
-		   outReal[i] = localOutputArray[i];
-		   for( j=i+1; j < outputSize; j++ )
-		   {
-			   if( localPeriodArray[j] == curPeriod )
-			   {
-				   localPeriodArray[j] = 0; /* Flag to avoid recalculation */
-				   outReal[j] = localOutputArray[j];
-			   }
-		   }		   
-	   }
+      VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+      VALUE_HANDLE_DEREF(outNBElement) = outputSize;
+      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
    }
 
+   /* The other moving averages are calculated once per period in
+    * use. The elements are linked by period so each result is
+    * written directly where it belongs, and the MA for a period
+    * stops at the last element using it.
+    */
+   tempInt = highPeriod-lowPeriod+1;
+   ARRAY_INT_ALLOC(nextSamePeriod,outputSize);
+   ARRAY_INT_ALLOC(firstPeriodIdx,tempInt);
+   ARRAY_INT_ALLOC(lastPeriodIdx,tempInt);
+   ARRAY_ALLOC(localOutputArray,outputSize);
+   ARRAY_ALLOC(localResultArray,outputSize);
+   #if !defined(_JAVA)
+      if( !nextSamePeriod || !firstPeriodIdx || !lastPeriodIdx || !localOutputArray || !localResultArray )
+      {
+         ARRAY_INT_FREE_COND(nextSamePeriod,nextSamePeriod);
+         ARRAY_INT_FREE_COND(firstPeriodIdx,firstPeriodIdx);
+         ARRAY_INT_FREE_COND(lastPeriodIdx,lastPeriodIdx);
+         ARRAY_FREE_COND(localOutputArray,localOutputArray);
+         ARRAY_FREE_COND(localResultArray,localResultArray);
+         ARRAY_INT_FREE(localPeriodArray);
+         VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+         VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+         return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+      }
+   #endif
+
+   for( i=0; i < tempInt; i++ )
+   {
+      firstPeriodIdx[i] = -1;
+      lastPeriodIdx[i] = -1;
+   }
+   for( i=outputSize-1; i >= 0; i-- )
+   {
+      j = localPeriodArray[i]-lowPeriod;
+      nextSamePeriod[i] = firstPeriodIdx[j];
+      firstPeriodIdx[j] = i;
+      if( lastPeriodIdx[j] == -1 )
+         lastPeriodIdx[j] = i;
+   }
+
+   for( curPeriod=lowPeriod; curPeriod <= highPeriod; curPeriod++ )
+   {
+      firstIdx = firstPeriodIdx[curPeriod-lowPeriod];
+      if( firstIdx == -1 )
+         continue;
+
+      /* Only the MA without memory of the values before their
+       * period can start at the first element using it.
+       */
+      if( (optInMAType != ENUM_VALUE(MAType,TA_MAType_WMA,Wma)) &&
+          (optInMAType != ENUM_VALUE(MAType,TA_MAType_TRIMA,Trima)) )
+         firstIdx = 0;
+
+      retCode = FUNCTION_CALL(MA)( startIdx+firstIdx, startIdx+lastPeriodIdx[curPeriod-lowPeriod], inReal,
+                                   curPeriod, optInMAType,
+                                   VALUE_HANDLE_OUT(localBegIdx),VALUE_HANDLE_OUT(localNbElement),localOutputArray );
+
+      if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
+      {
+         ARRAY_INT_FREE(nextSamePeriod);
+         ARRAY_INT_FREE(firstPeriodIdx);
+         ARRAY_INT_FREE(lastPeriodIdx);
+         ARRAY_FREE(localOutputArray);
+         ARRAY_FREE(localResultArray);
+         ARRAY_INT_FREE(localPeriodArray);
+         VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+         VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+         return retCode;
+      }
+
+      for( i=firstPeriodIdx[curPeriod-lowPeriod]; i != -1; i=nextSamePeriod[i] )
+         localResultArray[i] = localOutputArray[startIdx+i-VALUE_HANDLE_GET(localBegIdx)];
+   }
+
+   /* The inputs are no longer needed, outReal can be written. */
+   ARRAY_MEMMOVE(outReal,0,localResultArray,0,outputSize);
+
+   ARRAY_INT_FREE(nextSamePeriod);
+   ARRAY_INT_FREE(firstPeriodIdx);
+   ARRAY_INT_FREE(lastPeriodIdx);
    ARRAY_FREE(localOutputArray);
+   ARRAY_FREE(localResultArray);
    ARRAY_INT_FREE(localPeriodArray);
 
    /* Done. Inform the caller of the success. */
@@ -399,8 +514,16 @@
 /* Generated */ #endif
 /* Generated */ {
 /* Generated */    int i, j, lookbackTotal, outputSize, tempInt, curPeriod;
+/* Generated */    int lowPeriod, highPeriod, firstIdx, prefixBase;
+/* Generated */    double tempReal, sumHigh, sumLow;
 /* Generated */    ARRAY_INT_REF(localPeriodArray);
+/* Generated */    ARRAY_INT_REF(nextSamePeriod);
+/* Generated */    ARRAY_INT_REF(firstPeriodIdx);
+/* Generated */    ARRAY_INT_REF(lastPeriodIdx);
 /* Generated */    ARRAY_REF(localOutputArray);
+/* Generated */    ARRAY_REF(localResultArray);
+/* Generated */    ARRAY_REF(prefixHigh);
+/* Generated */    ARRAY_REF(prefixLow);
 /* Generated */    VALUE_HANDLE_INT(localBegIdx);
 /* Generated */    VALUE_HANDLE_INT(localNbElement);
 /* Generated */    ENUM_DECLARATION(RetCode) retCode;
@@ -452,45 +575,140 @@
 /* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);      
 /* Generated */    }   
 /* Generated */    outputSize = endIdx - tempInt + 1;
-/* Generated */    ARRAY_ALLOC(localOutputArray,outputSize);
 /* Generated */    ARRAY_INT_ALLOC(localPeriodArray,outputSize);
+/* Generated */    #if !defined(_JAVA)
+/* Generated */       if( !localPeriodArray )
+/* Generated */       {
+/* Generated */          VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */          VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */          return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+/* Generated */       }
+/* Generated */    #endif
+/* Generated */    lowPeriod  = optInMaxPeriod;
+/* Generated */    highPeriod = optInMinPeriod;
 /* Generated */    for( i=0; i < outputSize; i++ )
 /* Generated */    {
 /* Generated */       tempInt = (int)(inPeriods[startIdx+i]);
-/* Generated */ 	  if( tempInt < optInMinPeriod )
-/* Generated */ 		  tempInt = optInMinPeriod;
-/* Generated */ 	  else if( tempInt > optInMaxPeriod )
-/* Generated */           tempInt = optInMaxPeriod;
+/* Generated */       if( tempInt < optInMinPeriod )
+/* Generated */          tempInt = optInMinPeriod;
+/* Generated */       else if( tempInt > optInMaxPeriod )
+/* Generated */          tempInt = optInMaxPeriod;
 /* Generated */       localPeriodArray[i] = tempInt;
+/* Generated */       if( tempInt < lowPeriod )
+/* Generated */          lowPeriod = tempInt;
+/* Generated */       if( tempInt > highPeriod )
+/* Generated */          highPeriod = tempInt;
 /* Generated */    }
-/* Generated */    for( i=0; i < outputSize; i++ )
+/* Generated */    prefixBase = startIdx-highPeriod+1;
+/* Generated */    if( (optInMAType == ENUM_VALUE(MAType,TA_MAType_SMA,Sma)) && (prefixBase >= 0) )
+/* Generated */    {
+/* Generated */       ARRAY_ALLOC(prefixHigh,endIdx-prefixBase+2);
+/* Generated */       ARRAY_ALLOC(prefixLow,endIdx-prefixBase+2);
+/* Generated */       #if !defined(_JAVA)
+/* Generated */          if( !prefixHigh || !prefixLow )
+/* Generated */          {
+/* Generated */             ARRAY_FREE_COND(prefixHigh,prefixHigh);
+/* Generated */             ARRAY_FREE_COND(prefixLow,prefixLow);
+/* Generated */             ARRAY_INT_FREE(localPeriodArray);
+/* Generated */             VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */             VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */             return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+/* Generated */          }
+/* Generated */       #endif
+/* Generated */       sumHigh = 0.0;
+/* Generated */       sumLow  = 0.0;
+/* Generated */       prefixHigh[0] = 0.0;
+/* Generated */       prefixLow[0]  = 0.0;
+/* Generated */       for( i=prefixBase, j=1; i <= endIdx; i++, j++ )
+/* Generated */       {
+/* Generated */          tempReal = sumHigh+inReal[i];
+/* Generated */          if( std_fabs(sumHigh) >= std_fabs(inReal[i]) )
+/* Generated */             sumLow += (sumHigh-tempReal)+inReal[i];
+/* Generated */          else
+/* Generated */             sumLow += (inReal[i]-tempReal)+sumHigh;
+/* Generated */          sumHigh = tempReal;
+/* Generated */          prefixHigh[j] = sumHigh;
+/* Generated */          prefixLow[j]  = sumLow;
+/* Generated */       }
+/* Generated */       for( i=0; i < outputSize; i++ )
+/* Generated */       {
+/* Generated */          curPeriod = localPeriodArray[i];
+/* Generated */          j = startIdx+i-prefixBase+1;
+/* Generated */          outReal[i] = ((prefixHigh[j]-prefixHigh[j-curPeriod]) +
+/* Generated */                        (prefixLow[j]-prefixLow[j-curPeriod])) / curPeriod;
+/* Generated */       }
+/* Generated */       ARRAY_FREE(prefixHigh);
+/* Generated */       ARRAY_FREE(prefixLow);
+/* Generated */       ARRAY_INT_FREE(localPeriodArray);
+/* Generated */       VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
+/* Generated */       VALUE_HANDLE_DEREF(outNBElement) = outputSize;
+/* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */    }
+/* Generated */    tempInt = highPeriod-lowPeriod+1;
+/* Generated */    ARRAY_INT_ALLOC(nextSamePeriod,outputSize);
+/* Generated */    ARRAY_INT_ALLOC(firstPeriodIdx,tempInt);
+/* Generated */    ARRAY_INT_ALLOC(lastPeriodIdx,tempInt);
+/* Generated */    ARRAY_ALLOC(localOutputArray,outputSize);
+/* Generated */    ARRAY_ALLOC(localResultArray,outputSize);
+/* Generated */    #if !defined(_JAVA)
+/* Generated */       if( !nextSamePeriod || !firstPeriodIdx || !lastPeriodIdx || !localOutputArray || !localResultArray )
+/* Generated */       {
+/* Generated */          ARRAY_INT_FREE_COND(nextSamePeriod,nextSamePeriod);
+/* Generated */          ARRAY_INT_FREE_COND(firstPeriodIdx,firstPeriodIdx);
+/* Generated */          ARRAY_INT_FREE_COND(lastPeriodIdx,lastPeriodIdx);
+/* Generated */          ARRAY_FREE_COND(localOutputArray,localOutputArray);
+/* Generated */          ARRAY_FREE_COND(localResultArray,localResultArray);
+/* Generated */          ARRAY_INT_FREE(localPeriodArray);
+/* Generated */          VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */          VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */          return ENUM_VALUE(RetCode,TA_ALLOC_ERR,AllocErr);
+/* Generated */       }
+/* Generated */    #endif
+/* Generated */    for( i=0; i < tempInt; i++ )
+/* Generated */    {
+/* Generated */       firstPeriodIdx[i] = -1;
+/* Generated */       lastPeriodIdx[i] = -1;
+/* Generated */    }
+/* Generated */    for( i=outputSize-1; i >= 0; i-- )
+/* Generated */    {
+/* Generated */       j = localPeriodArray[i]-lowPeriod;
+/* Generated */       nextSamePeriod[i] = firstPeriodIdx[j];
+/* Generated */       firstPeriodIdx[j] = i;
+/* Generated */       if( lastPeriodIdx[j] == -1 )
+/* Generated */          lastPeriodIdx[j] = i;
+/* Generated */    }
+/* Generated */    for( curPeriod=lowPeriod; curPeriod <= highPeriod; curPeriod++ )
 /* Generated */    {
-/* Generated */ 	   curPeriod = localPeriodArray[i];
-/* Generated */ 	   if( curPeriod != 0 )
-/* Generated */ 	   {
-/* Generated */ 		   retCode = FUNCTION_CALL(MA)( startIdx, endIdx, inReal,
-/* Generated */ 			                            curPeriod, optInMAType,
-/* Generated */ 									    VALUE_HANDLE_OUT(localBegIdx),VALUE_HANDLE_OUT(localNbElement),localOutputArray );
-/* Generated */            if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
-/* Generated */ 		   {
-/* Generated */               ARRAY_FREE(localOutputArray);
-/* Generated */ 			  ARRAY_INT_FREE(localPeriodArray);
-/* Generated */               VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-/* Generated */               VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-/* Generated */               return retCode;
-/* Generated */ 	       }
-/* Generated */ 		   outReal[i] = localOutputArray[i];
-/* Generated */ 		   for( j=i+1; j < outputSize; j++ )
-/* Generated */ 		   {
-/* Generated */ 			   if( localPeriodArray[j] == curPeriod )
-/* Generated */ 			   {
-/* Generated */ 				   localPeriodArray[j] = 0; 
-/* Generated */ 				   outReal[j] = localOutputArray[j];
-/* Generated */ 			   }
-/* Generated */ 		   }		   
-/* Generated */ 	   }
+/* Generated */       firstIdx = firstPeriodIdx[curPeriod-lowPeriod];
+/* Generated */       if( firstIdx == -1 )
+/* Generated */          continue;
+/* Generated */       if( (optInMAType != ENUM_VALUE(MAType,TA_MAType_WMA,Wma)) &&
+/* Generated */           (optInMAType != ENUM_VALUE(MAType,TA_MAType_TRIMA,Trima)) )
+/* Generated */          firstIdx = 0;
+/* Generated */       retCode = FUNCTION_CALL(MA)( startIdx+firstIdx, startIdx+lastPeriodIdx[curPeriod-lowPeriod], inReal,
+/* Generated */                                    curPeriod, optInMAType,
+/* Generated */                                    VALUE_HANDLE_OUT(localBegIdx),VALUE_HANDLE_OUT(localNbElement),localOutputArray );
+/* Generated */       if( retCode != ENUM_VALUE(RetCode,TA_SUCCESS,Success) )
+/* Generated */       {
+/* Generated */          ARRAY_INT_FREE(nextSamePeriod);
+/* Generated */          ARRAY_INT_FREE(firstPeriodIdx);
+/* Generated */          ARRAY_INT_FREE(lastPeriodIdx);
+/* Generated */          ARRAY_FREE(localOutputArray);
+/* Generated */          ARRAY_FREE(localResultArray);
+/* Generated */          ARRAY_INT_FREE(localPeriodArray);
+/* Generated */          VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
+/* Generated */          VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
+/* Generated */          return retCode;
+/* Generated */       }
+/* Generated */       for( i=firstPeriodIdx[curPeriod-lowPeriod]; i != -1; i=nextSamePeriod[i] )
+/* Generated */          localResultArray[i] = localOutputArray[startIdx+i-VALUE_HANDLE_GET(localBegIdx)];
 /* Generated */    }
+/* Generated */    ARRAY_MEMMOVE(outReal,0,localResultArray,0,outputSize);
+/* Generated */    ARRAY_INT_FREE(nextSamePeriod);
+/* Generated */    ARRAY_INT_FREE(firstPeriodIdx);
+/* Generated */    ARRAY_INT_FREE(lastPeriodIdx);
 /* Generated */    ARRAY_FREE(localOutputArray);
+/* Generated */    ARRAY_FREE(localResultArray);
 /* Generated */    ARRAY_INT_FREE(localPeriodArray);
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outputSize;
@@ -159,7 +159,8 @@
    /* Insert local variables here. */
    double highest, tmp;
    int outIdx, nbInitialElementNeeded;
-   int trailingIdx, today, i, highestIdx;
+   int trailingIdx, today, highestIdx;
+   EXTREME_PROLOG(maxWindow,64);
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -221,23 +222,23 @@
    highestIdx  = -1;
    highest     = 0.0;
 
+   EXTREME_INIT(maxWindow,optInTimePeriod);
+
    while( today <= endIdx )
    {
       tmp = inReal[today];
 
       if( highestIdx < trailingIdx )
       {
+        /* Same result as a rescan of the window: the first
+         * highest, unless the window starts with a NaN.
+         */
         highestIdx = trailingIdx;
         highest = inReal[highestIdx];
-        i = highestIdx;
-        while( ++i<=today )
+        if( highest == highest )
         {
-           tmp = inReal[i];
-           if( tmp > highest )
-           {
-              highestIdx = i;
-              highest = tmp;
-           }
+           EXTREME_FIND(maxWindow,inReal,trailingIdx,today,>,highestIdx);
+           highest = inReal[highestIdx];
         }
       }
       else if( tmp >= highest )
@@ -251,6 +252,8 @@
       today++;  
    }
 
+   EXTREME_DESTROY(maxWindow);
+
    /* Keep the outBegIdx relative to the
     * caller input before returning.
     */
@@ -306,7 +309,8 @@
 /* Generated */ {
 /* Generated */    double highest, tmp;
 /* Generated */    int outIdx, nbInitialElementNeeded;
-/* Generated */    int trailingIdx, today, i, highestIdx;
+/* Generated */    int trailingIdx, today, highestIdx;
+/* Generated */    EXTREME_PROLOG(maxWindow,64);
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -338,6 +342,7 @@
 /* Generated */    trailingIdx = startIdx-nbInitialElementNeeded;
 /* Generated */    highestIdx  = -1;
 /* Generated */    highest     = 0.0;
+/* Generated */    EXTREME_INIT(maxWindow,optInTimePeriod);
 /* Generated */    while( today <= endIdx )
 /* Generated */    {
 /* Generated */       tmp = inReal[today];
@@ -345,15 +350,10 @@
 /* Generated */       {
 /* Generated */         highestIdx = trailingIdx;
 /* Generated */         highest = inReal[highestIdx];
-/* Generated */         i = highestIdx;
-/* Generated */         while( ++i<=today )
+/* Generated */         if( highest == highest )
 /* Generated */         {
-/* Generated */            tmp = inReal[i];
-/* Generated */            if( tmp > highest )
-/* Generated */            {
-/* Generated */               highestIdx = i;
-/* Generated */               highest = tmp;
-/* Generated */            }
+/* Generated */            EXTREME_FIND(maxWindow,inReal,trailingIdx,today,>,highestIdx);
+/* Generated */            highest = inReal[highestIdx];
 /* Generated */         }
 /* Generated */       }
 /* Generated */       else if( tmp >= highest )
@@ -365,6 +365,7 @@
 /* Generated */       trailingIdx++;
 /* Generated */       today++;  
 /* Generated */    }
+/* Generated */    EXTREME_DESTROY(maxWindow);
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
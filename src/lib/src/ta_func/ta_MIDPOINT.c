@@ -159,9 +159,11 @@
 {
 	/* insert local variable here */
 
-   double lowest, highest, tmp;
+   double lowest, highest;
    int outIdx, nbInitialElementNeeded;
    int trailingIdx, today, i;
+   EXTREME_PROLOG(maxWindow,64);
+   EXTREME_PROLOG(minWindow,64);
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -228,22 +230,33 @@
    outIdx = 0;
    today       = startIdx;
    trailingIdx = startIdx-nbInitialElementNeeded;
-   
+
+   EXTREME_INIT(maxWindow,optInTimePeriod);
+   EXTREME_INIT(minWindow,optInTimePeriod);
+
    while( today <= endIdx )
    {
-      lowest  = inReal[trailingIdx++];
+      /* Same result as a scan of the window: the first
+       * extremes, unless the window starts with a NaN.
+       */
+      lowest  = inReal[trailingIdx];
       highest = lowest;
-      for( i=trailingIdx; i <= today; i++ )
+      if( lowest == lowest )
       {
-         tmp = inReal[i];
-         if( tmp < lowest ) lowest= tmp;
-         else if( tmp > highest) highest = tmp;
+         EXTREME_FIND(minWindow,inReal,trailingIdx,today,<,i);
+         lowest = inReal[i];
+         EXTREME_FIND(maxWindow,inReal,trailingIdx,today,>,i);
+         highest = inReal[i];
       }
+      trailingIdx++;
 
       outReal[outIdx++] = (highest+lowest)/2.0;
       today++;
    }
 
+   EXTREME_DESTROY(maxWindow);
+   EXTREME_DESTROY(minWindow);
+
    /* Keep the outBegIdx relative to the
     * caller input before returning.
     */
@@ -297,9 +310,11 @@
 /* Generated */                           double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
-/* Generated */    double lowest, highest, tmp;
+/* Generated */    double lowest, highest;
 /* Generated */    int outIdx, nbInitialElementNeeded;
 /* Generated */    int trailingIdx, today, i;
+/* Generated */    EXTREME_PROLOG(maxWindow,64);
+/* Generated */    EXTREME_PROLOG(minWindow,64);
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -329,19 +344,25 @@
 /* Generated */    outIdx = 0;
 /* Generated */    today       = startIdx;
 /* Generated */    trailingIdx = startIdx-nbInitialElementNeeded;
+/* Generated */    EXTREME_INIT(maxWindow,optInTimePeriod);
+/* Generated */    EXTREME_INIT(minWindow,optInTimePeriod);
 /* Generated */    while( today <= endIdx )
 /* Generated */    {
-/* Generated */       lowest  = inReal[trailingIdx++];
+/* Generated */       lowest  = inReal[trailingIdx];
 /* Generated */       highest = lowest;
-/* Generated */       for( i=trailingIdx; i <= today; i++ )
+/* Generated */       if( lowest == lowest )
 /* Generated */       {
-/* Generated */          tmp = inReal[i];
-/* Generated */          if( tmp < lowest ) lowest= tmp;
-/* Generated */          else if( tmp > highest) highest = tmp;
+/* Generated */          EXTREME_FIND(minWindow,inReal,trailingIdx,today,<,i);
+/* Generated */          lowest = inReal[i];
+/* Generated */          EXTREME_FIND(maxWindow,inReal,trailingIdx,today,>,i);
+/* Generated */          highest = inReal[i];
 /* Generated */       }
+/* Generated */       trailingIdx++;
 /* Generated */       outReal[outIdx++] = (highest+lowest)/2.0;
 /* Generated */       today++;
 /* Generated */    }
+/* Generated */    EXTREME_DESTROY(maxWindow);
+/* Generated */    EXTREME_DESTROY(minWindow);
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
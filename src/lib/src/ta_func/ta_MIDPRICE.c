@@ -162,9 +162,11 @@
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
 	/* insert local variable here */
-   double lowest, highest, tmp;
+   double lowest, highest;
    int outIdx, nbInitialElementNeeded;
    int trailingIdx, today, i;
+   EXTREME_PROLOG(maxWindow,64);
+   EXTREME_PROLOG(minWindow,64);
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -232,24 +234,36 @@
    outIdx = 0;
    today       = startIdx;
    trailingIdx = startIdx-nbInitialElementNeeded;
-   
+
+   EXTREME_INIT(maxWindow,optInTimePeriod);
+   EXTREME_INIT(minWindow,optInTimePeriod);
+
    while( today <= endIdx )
    {
+      /* Same result as a scan of the window: the first
+       * extremes, unless the window starts with a NaN.
+       */
       lowest  = inLow[trailingIdx];
       highest = inHigh[trailingIdx];
-      trailingIdx++;
-      for( i=trailingIdx; i <= today; i++ )
+      if( lowest == lowest )
       {
-         tmp = inLow[i];
-         if( tmp < lowest ) lowest= tmp;
-         tmp = inHigh[i];
-         if( tmp > highest) highest = tmp;
+         EXTREME_FIND(minWindow,inLow,trailingIdx,today,<,i);
+         lowest = inLow[i];
       }
+      if( highest == highest )
+      {
+         EXTREME_FIND(maxWindow,inHigh,trailingIdx,today,>,i);
+         highest = inHigh[i];
+      }
+      trailingIdx++;
 
       outReal[outIdx++] = (highest+lowest)/2.0;
       today++;
    }
 
+   EXTREME_DESTROY(maxWindow);
+   EXTREME_DESTROY(minWindow);
+
    /* Keep the outBegIdx relative to the
     * caller input before returning.
     */
@@ -307,9 +321,11 @@
 /* Generated */                           double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
-/* Generated */    double lowest, highest, tmp;
+/* Generated */    double lowest, highest;
 /* Generated */    int outIdx, nbInitialElementNeeded;
 /* Generated */    int trailingIdx, today, i;
+/* Generated */    EXTREME_PROLOG(maxWindow,64);
+/* Generated */    EXTREME_PROLOG(minWindow,64);
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -340,21 +356,28 @@
 /* Generated */    outIdx = 0;
 /* Generated */    today       = startIdx;
 /* Generated */    trailingIdx = startIdx-nbInitialElementNeeded;
+/* Generated */    EXTREME_INIT(maxWindow,optInTimePeriod);
+/* Generated */    EXTREME_INIT(minWindow,optInTimePeriod);
 /* Generated */    while( today <= endIdx )
 /* Generated */    {
 /* Generated */       lowest  = inLow[trailingIdx];
 /* Generated */       highest = inHigh[trailingIdx];
-/* Generated */       trailingIdx++;
-/* Generated */       for( i=trailingIdx; i <= today; i++ )
+/* Generated */       if( lowest == lowest )
 /* Generated */       {
-/* Generated */          tmp = inLow[i];
-/* Generated */          if( tmp < lowest ) lowest= tmp;
-/* Generated */          tmp = inHigh[i];
-/* Generated */          if( tmp > highest) highest = tmp;
+/* Generated */          EXTREME_FIND(minWindow,inLow,trailingIdx,today,<,i);
+/* Generated */          lowest = inLow[i];
 /* Generated */       }
+/* Generated */       if( highest == highest )
+/* Generated */       {
+/* Generated */          EXTREME_FIND(maxWindow,inHigh,trailingIdx,today,>,i);
+/* Generated */          highest = inHigh[i];
+/* Generated */       }
+/* Generated */       trailingIdx++;
 /* Generated */       outReal[outIdx++] = (highest+lowest)/2.0;
 /* Generated */       today++;
 /* Generated */    }
+/* Generated */    EXTREME_DESTROY(maxWindow);
+/* Generated */    EXTREME_DESTROY(minWindow);
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
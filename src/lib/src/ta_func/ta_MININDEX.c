@@ -159,7 +159,8 @@
    /* Insert local variables here. */
    double lowest, tmp;
    int outIdx, nbInitialElementNeeded;
-   int trailingIdx, lowestIdx, today, i;
+   int trailingIdx, lowestIdx, today;
+   EXTREME_PROLOG(minWindow,64);
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -220,24 +221,24 @@
    trailingIdx = startIdx-nbInitialElementNeeded;
    lowestIdx   = -1;
    lowest      = 0.0;
-   
+
+   EXTREME_INIT(minWindow,optInTimePeriod);
+
    while( today <= endIdx )
    {
       tmp = inReal[today];
 
       if( lowestIdx < trailingIdx )
       {
+        /* Same result as a rescan of the window: the first
+         * lowest, unless the window starts with a NaN.
+         */
         lowestIdx = trailingIdx;
         lowest = inReal[lowestIdx];
-        i = lowestIdx;
-        while( ++i<=today )
+        if( lowest == lowest )
         {
-           tmp = inReal[i];
-           if( tmp < lowest )
-           {
-              lowestIdx = i;
-              lowest = tmp;
-           }
+           EXTREME_FIND(minWindow,inReal,trailingIdx,today,<,lowestIdx);
+           lowest = inReal[lowestIdx];
         }
       }
       else if( tmp <= lowest )
@@ -251,6 +252,8 @@
       today++;  
    }
 
+   EXTREME_DESTROY(minWindow);
+
    /* Keep the outBegIdx relative to the
     * caller input before returning.
     */
@@ -306,7 +309,8 @@
 /* Generated */ {
 /* Generated */    double lowest, tmp;
 /* Generated */    int outIdx, nbInitialElementNeeded;
-/* Generated */    int trailingIdx, lowestIdx, today, i;
+/* Generated */    int trailingIdx, lowestIdx, today;
+/* Generated */    EXTREME_PROLOG(minWindow,64);
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -338,6 +342,7 @@
 /* Generated */    trailingIdx = startIdx-nbInitialElementNeeded;
 /* Generated */    lowestIdx   = -1;
 /* Generated */    lowest      = 0.0;
+/* Generated */    EXTREME_INIT(minWindow,optInTimePeriod);
 /* Generated */    while( today <= endIdx )
 /* Generated */    {
 /* Generated */       tmp = inReal[today];
@@ -345,15 +350,10 @@
 /* Generated */       {
 /* Generated */         lowestIdx = trailingIdx;
 /* Generated */         lowest = inReal[lowestIdx];
-/* Generated */         i = lowestIdx;
-/* Generated */         while( ++i<=today )
+/* Generated */         if( lowest == lowest )
 /* Generated */         {
-/* Generated */            tmp = inReal[i];
-/* Generated */            if( tmp < lowest )
-/* Generated */            {
-/* Generated */               lowestIdx = i;
-/* Generated */               lowest = tmp;
-/* Generated */            }
+/* Generated */            EXTREME_FIND(minWindow,inReal,trailingIdx,today,<,lowestIdx);
+/* Generated */            lowest = inReal[lowestIdx];
 /* Generated */         }
 /* Generated */       }
 /* Generated */       else if( tmp <= lowest )
@@ -365,6 +365,7 @@
 /* Generated */       trailingIdx++;
 /* Generated */       today++;  
 /* Generated */    }
+/* Generated */    EXTREME_DESTROY(minWindow);
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
@@ -163,7 +163,9 @@
    /* Insert local variables here. */
    double highest, lowest, tmpHigh, tmpLow;
    int outIdx, nbInitialElementNeeded;
-   int trailingIdx, today, i, highestIdx, lowestIdx;
+   int trailingIdx, today, highestIdx, lowestIdx;
+   EXTREME_PROLOG(maxWindow,64);
+   EXTREME_PROLOG(minWindow,64);
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -230,23 +232,24 @@
    lowestIdx   = -1;
    lowest      = 0.0;
 
+   EXTREME_INIT(maxWindow,optInTimePeriod);
+   EXTREME_INIT(minWindow,optInTimePeriod);
+
    while( today <= endIdx )
    {
       tmpLow = tmpHigh = inReal[today];
 
       if( highestIdx < trailingIdx )
       {
+        /* Same result as a rescan of the window: the first
+         * highest, unless the window starts with a NaN.
+         */
         highestIdx = trailingIdx;
         highest = inReal[highestIdx];
-        i = highestIdx;
-        while( ++i<=today )
+        if( highest == highest )
         {
-           tmpHigh = inReal[i];
-           if( tmpHigh > highest )
-           {
-              highestIdx = i;
-              highest = tmpHigh;
-           }
+           EXTREME_FIND(maxWindow,inReal,trailingIdx,today,>,highestIdx);
+           highest = inReal[highestIdx];
         }
       }
       else if( tmpHigh >= highest )
@@ -257,17 +260,15 @@
 
       if( lowestIdx < trailingIdx )
       {
+        /* Same result as a rescan of the window: the first
+         * lowest, unless the window starts with a NaN.
+         */
         lowestIdx = trailingIdx;
         lowest = inReal[lowestIdx];
-        i = lowestIdx;
-        while( ++i<=today )
+        if( lowest == lowest )
         {
-           tmpLow = inReal[i];
-           if( tmpLow < lowest )
-           {
-              lowestIdx = i;
-              lowest = tmpLow;
-           }
+           EXTREME_FIND(minWindow,inReal,trailingIdx,today,<,lowestIdx);
+           lowest = inReal[lowestIdx];
         }
       }
       else if( tmpLow <= lowest )
@@ -283,6 +284,9 @@
       today++;  
    }
 
+   EXTREME_DESTROY(maxWindow);
+   EXTREME_DESTROY(minWindow);
+
    /* Keep the outBegIdx relative to the
     * caller input before returning.
     */
@@ -342,7 +346,9 @@
 /* Generated */ {
 /* Generated */    double highest, lowest, tmpHigh, tmpLow;
 /* Generated */    int outIdx, nbInitialElementNeeded;
-/* Generated */    int trailingIdx, today, i, highestIdx, lowestIdx;
+/* Generated */    int trailingIdx, today, highestIdx, lowestIdx;
+/* Generated */    EXTREME_PROLOG(maxWindow,64);
+/* Generated */    EXTREME_PROLOG(minWindow,64);
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -378,6 +384,8 @@
 /* Generated */    highest     = 0.0;
 /* Generated */    lowestIdx   = -1;
 /* Generated */    lowest      = 0.0;
+/* Generated */    EXTREME_INIT(maxWindow,optInTimePeriod);
+/* Generated */    EXTREME_INIT(minWindow,optInTimePeriod);
 /* Generated */    while( today <= endIdx )
 /* Generated */    {
 /* Generated */       tmpLow = tmpHigh = inReal[today];
@@ -385,15 +393,10 @@
 /* Generated */       {
 /* Generated */         highestIdx = trailingIdx;
 /* Generated */         highest = inReal[highestIdx];
-/* Generated */         i = highestIdx;
-/* Generated */         while( ++i<=today )
+/* Generated */         if( highest == highest )
 /* Generated */         {
-/* Generated */            tmpHigh = inReal[i];
-/* Generated */            if( tmpHigh > highest )
-/* Generated */            {
-/* Generated */               highestIdx = i;
-/* Generated */               highest = tmpHigh;
-/* Generated */            }
+/* Generated */            EXTREME_FIND(maxWindow,inReal,trailingIdx,today,>,highestIdx);
+/* Generated */            highest = inReal[highestIdx];
 /* Generated */         }
 /* Generated */       }
 /* Generated */       else if( tmpHigh >= highest )
@@ -405,15 +408,10 @@
 /* Generated */       {
 /* Generated */         lowestIdx = trailingIdx;
 /* Generated */         lowest = inReal[lowestIdx];
-/* Generated */         i = lowestIdx;
-/* Generated */         while( ++i<=today )
+/* Generated */         if( lowest == lowest )
 /* Generated */         {
-/* Generated */            tmpLow = inReal[i];
-/* Generated */            if( tmpLow < lowest )
-/* Generated */            {
-/* Generated */               lowestIdx = i;
-/* Generated */               lowest = tmpLow;
-/* Generated */            }
+/* Generated */            EXTREME_FIND(minWindow,inReal,trailingIdx,today,<,lowestIdx);
+/* Generated */            lowest = inReal[lowestIdx];
 /* Generated */         }
 /* Generated */       }
 /* Generated */       else if( tmpLow <= lowest )
@@ -427,6 +425,8 @@
 /* Generated */       trailingIdx++;
 /* Generated */       today++;  
 /* Generated */    }
+/* Generated */    EXTREME_DESTROY(maxWindow);
+/* Generated */    EXTREME_DESTROY(minWindow);
 /* Generated */    VALUE_HANDLE_DEREF(outBegIdx)    = startIdx;
 /* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
 /* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
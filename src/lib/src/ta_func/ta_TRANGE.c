@@ -209,6 +209,12 @@
 
    outIdx = 0;
    today = startIdx;
+#if !defined( _MANAGED ) && !defined( _JAVA ) && !defined( USE_SINGLE_PRECISION_INPUT )
+   /* Vectorized kernel chosen from the CPU features, see ta_simd.c */
+   outIdx = endIdx-startIdx+1;
+   TA_INT_SimdTrueRange( &inHigh[today], &inLow[today], &inClose[today-1], outReal, outIdx );
+   today += outIdx;
+#endif
    while( today <= endIdx )
    {
 
@@ -311,6 +317,11 @@
 /* Generated */    }
 /* Generated */    outIdx = 0;
 /* Generated */    today = startIdx;
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA ) && !defined( USE_SINGLE_PRECISION_INPUT )
+/* Generated */    outIdx = endIdx-startIdx+1;
+/* Generated */    TA_INT_SimdTrueRange( &inHigh[today], &inLow[today], &inClose[today-1], outReal, outIdx );
+/* Generated */    today += outIdx;
+/* Generated */ #endif
 /* Generated */    while( today <= endIdx )
 /* Generated */    {
 /* Generated */       tempLT = inLow[today];
@@ -157,15 +157,6 @@
 /**** END GENCODE SECTION 3 - DO NOT DELETE THIS LINE ****/
 {
    /* insert local variable here */
-   int outIdx;
-
-   int today, lookbackTotal;
-   double SumX, SumXY, SumY, SumXSqr, Divisor;
-
-   double m, b;
-   int i;
-
-   double tempValue1;
 
 /**** START GENCODE SECTION 4 - DO NOT DELETE THIS LINE ****/
 /* Generated */ 
@@ -214,46 +205,14 @@
     * TA_TSF                : Returns b+m*(period)
     */
 
-   /* Adjust startIdx to account for the lookback period. */
-   lookbackTotal = LOOKBACK_CALL(TSF)( optInTimePeriod );
-
-   if( startIdx < lookbackTotal )
-      startIdx = lookbackTotal;
-
-   /* Make sure there is still something to evaluate. */
-   if( startIdx > endIdx )
-   {
-      VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-      VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-      return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
-   }
-
-   outIdx = 0; /* Index into the output. */
-   today = startIdx;
-
-   SumX = optInTimePeriod * ( optInTimePeriod - 1 ) * 0.5;
-   SumXSqr = optInTimePeriod * ( optInTimePeriod - 1 ) * ( 2 * optInTimePeriod - 1 ) / 6;
-   Divisor = SumX * SumX - optInTimePeriod * SumXSqr;
-
-   while( today <= endIdx )
-   {
-     SumXY = 0;
-     SumY = 0;
-     for( i = optInTimePeriod; i-- != 0; )
-     {
-       SumY += tempValue1 = inReal[today - i];
-       SumXY += (double)i * tempValue1;
-     }
-     m = ( optInTimePeriod * SumXY - SumX * SumY) / Divisor;
-     b = ( SumY - m * SumX ) / (double)optInTimePeriod;
-     outReal[outIdx++] = b + m * (double)optInTimePeriod;
-     today++;
-   }
-
-   VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
-   VALUE_HANDLE_DEREF(outNBElement) = outIdx;
-
-   return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+   /* The sums are slid along the input by the shared
+    * kernel, see TA_INT_LINEARREG in ta_LINEARREG_ALL.c
+    */
+   return FUNCTION_CALL(INT_LINEARREG)( startIdx, endIdx,
+                                        inReal, optInTimePeriod,
+                                        outBegIdx, outNBElement,
+                                        NULL, NULL, NULL,
+                                        NULL, outReal );
 }
 
 /**** START GENCODE SECTION 5 - DO NOT DELETE THIS LINE ****/
@@ -300,12 +259,6 @@
 /* Generated */                      double        outReal[] )
 /* Generated */ #endif
 /* Generated */ {
-/* Generated */    int outIdx;
-/* Generated */    int today, lookbackTotal;
-/* Generated */    double SumX, SumXY, SumY, SumXSqr, Divisor;
-/* Generated */    double m, b;
-/* Generated */    int i;
-/* Generated */    double tempValue1;
 /* Generated */  #ifndef TA_FUNC_NO_RANGE_CHECK
 /* Generated */     if( startIdx < 0 )
 /* Generated */        return ENUM_VALUE(RetCode,TA_OUT_OF_RANGE_START_INDEX,OutOfRangeStartIndex);
@@ -323,37 +276,11 @@
 /* Generated */        return ENUM_VALUE(RetCode,TA_BAD_PARAM,BadParam);
 /* Generated */     #endif 
 /* Generated */  #endif 
-/* Generated */    lookbackTotal = LOOKBACK_CALL(TSF)( optInTimePeriod );
-/* Generated */    if( startIdx < lookbackTotal )
-/* Generated */       startIdx = lookbackTotal;
-/* Generated */    if( startIdx > endIdx )
-/* Generated */    {
-/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outBegIdx);
-/* Generated */       VALUE_HANDLE_DEREF_TO_ZERO(outNBElement);
-/* Generated */       return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
-/* Generated */    }
-/* Generated */    outIdx = 0; 
-/* Generated */    today = startIdx;
-/* Generated */    SumX = optInTimePeriod * ( optInTimePeriod - 1 ) * 0.5;
-/* Generated */    SumXSqr = optInTimePeriod * ( optInTimePeriod - 1 ) * ( 2 * optInTimePeriod - 1 ) / 6;
-/* Generated */    Divisor = SumX * SumX - optInTimePeriod * SumXSqr;
-/* Generated */    while( today <= endIdx )
-/* Generated */    {
-/* Generated */      SumXY = 0;
-/* Generated */      SumY = 0;
-/* Generated */      for( i = optInTimePeriod; i-- != 0; )
-/* Generated */      {
-/* Generated */        SumY += tempValue1 = inReal[today - i];
-/* Generated */        SumXY += (double)i * tempValue1;
-/* Generated */      }
-/* Generated */      m = ( optInTimePeriod * SumXY - SumX * SumY) / Divisor;
-/* Generated */      b = ( SumY - m * SumX ) / (double)optInTimePeriod;
-/* Generated */      outReal[outIdx++] = b + m * (double)optInTimePeriod;
-/* Generated */      today++;
-/* Generated */    }
-/* Generated */    VALUE_HANDLE_DEREF(outBegIdx) = startIdx;
-/* Generated */    VALUE_HANDLE_DEREF(outNBElement) = outIdx;
-/* Generated */    return ENUM_VALUE(RetCode,TA_SUCCESS,Success);
+/* Generated */    return FUNCTION_CALL(INT_LINEARREG)( startIdx, endIdx,
+/* Generated */                                         inReal, optInTimePeriod,
+/* Generated */                                         outBegIdx, outNBElement,
+/* Generated */                                         NULL, NULL, NULL,
+/* Generated */                                         NULL, outReal );
 /* Generated */ }
 /* Generated */ 
 /* Generated */ #if defined( _MANAGED )
@@ -185,7 +185,15 @@
 
    outIdx = 0;
 
-   for( i= startIdx; i <= endIdx; i++ )
+   i = startIdx;
+#if !defined( _MANAGED ) && !defined( _JAVA ) && !defined( USE_SINGLE_PRECISION_INPUT )
+   /* Vectorized kernel chosen from the CPU features, see ta_simd.c */
+   outIdx = endIdx-startIdx+1;
+   TA_INT_SimdWclPrice( &inHigh[i], &inLow[i], &inClose[i], outReal, outIdx );
+   i += outIdx;
+#endif
+
+   for( ; i <= endIdx; i++ )
    {
       outReal[outIdx++] = ( inHigh [i] +
 		                    inLow  [i] +
@@ -262,7 +270,13 @@
 /* Generated */     #endif 
 /* Generated */  #endif 
 /* Generated */    outIdx = 0;
-/* Generated */    for( i= startIdx; i <= endIdx; i++ )
+/* Generated */    i = startIdx;
+/* Generated */ #if !defined( _MANAGED ) && !defined( _JAVA ) && !defined( USE_SINGLE_PRECISION_INPUT )
+/* Generated */    outIdx = endIdx-startIdx+1;
+/* Generated */    TA_INT_SimdWclPrice( &inHigh[i], &inLow[i], &inClose[i], outReal, outIdx );
+/* Generated */    i += outIdx;
+/* Generated */ #endif
+/* Generated */    for( ; i <= endIdx; i++ )
 /* Generated */    {
 /* Generated */       outReal[outIdx++] = ( inHigh [i] +
 /* Generated */ 		                    inLow  [i] +
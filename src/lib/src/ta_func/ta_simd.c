@@ -0,0 +1,397 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Description:
+ *   SIMD kernels of the element-wise functions and of the
+ *   price transforms.
+ *
+ *   The instruction set is detected once with CPUID (and XGETBV for
+ *   the OS support of the AVX registers), and can be lowered with
+ *   TA_SetSimdLevel. Every kernel uses the same correctly rounded
+ *   operation than the scalar loop, so the output is identical for
+ *   every level.
+ *
+ *   Only x86 compilers with GCC/Clang target attributes or MSVC get the
+ *   vectorized kernels, other targets always run the scalar loops.
+ */
+
+#include <math.h>
+#include "ta_utility.h"
+#include "ta_func.h"
+
+#if (defined( __GNUC__ ) || defined( __clang__ )) && (defined( __x86_64__ ) || defined( __i386__ ))
+   #include <cpuid.h>
+   #include <immintrin.h>
+   #define TA_SIMD_X86
+   #define TA_SIMD_TARGET(x) __attribute__((target(x)))
+#elif defined( _MSC_VER ) && (defined( _M_X64 ) || defined( _M_IX86 ))
+   #include <intrin.h>
+   #include <immintrin.h>
+   #define TA_SIMD_X86
+   #define TA_SIMD_TARGET(x)
+#endif
+
+/* Level supported by the CPU, -1 until detected. */
+static int simdSupported = -1;
+
+/* Level in use, -1 until set or detected. */
+static int simdLevel = -1;
+
+/**** Local functions declarations.    ****/
+static int detectSimdLevel( void );
+
+/**** Global functions definitions.   ****/
+TA_RetCode TA_SetSimdLevel( TA_SimdLevel value )
+{
+   int supported;
+
+   if( (value < TA_SIMD_SCALAR) || (value > TA_SIMD_AVX512) )
+      return TA_BAD_PARAM;
+
+   supported = detectSimdLevel();
+   simdLevel = ((int)value < supported)? (int)value : supported;
+
+   return TA_SUCCESS;
+}
+
+TA_SimdLevel TA_GetSimdLevel( void )
+{
+   if( simdLevel < 0 )
+      simdLevel = detectSimdLevel();
+
+   return (TA_SimdLevel)simdLevel;
+}
+
+/* Loops over the vectors of each level, the remaining
+ * elements are done by the scalar loop.
+ */
+#define SIMD_BINARY(NAME,OP,SSE2,AVX2,AVX512) \
+TA_SIMD_KERNELS(NAME, \
+   ( const double *inReal0, const double *inReal1, double *outReal, int nbElement ), \
+   ( inReal0, inReal1, outReal, nbElement ), \
+   _mm_storeu_pd( &outReal[i], SSE2( _mm_loadu_pd(&inReal0[i]), _mm_loadu_pd(&inReal1[i]) ) ), \
+   _mm256_storeu_pd( &outReal[i], AVX2( _mm256_loadu_pd(&inReal0[i]), _mm256_loadu_pd(&inReal1[i]) ) ), \
+   _mm512_storeu_pd( &outReal[i], AVX512( _mm512_loadu_pd(&inReal0[i]), _mm512_loadu_pd(&inReal1[i]) ) ), \
+   outReal[i] = inReal0[i] OP inReal1[i] )
+
+#define SIMD_UNARY(NAME,FUNC,SSE2,AVX2,AVX512) \
+TA_SIMD_KERNELS(NAME, \
+   ( const double *inReal, double *outReal, int nbElement ), \
+   ( inReal, outReal, nbElement ), \
+   _mm_storeu_pd( &outReal[i], SSE2( _mm_loadu_pd(&inReal[i]) ) ), \
+   _mm256_storeu_pd( &outReal[i], AVX2( _mm256_loadu_pd(&inReal[i]) ) ), \
+   _mm512_storeu_pd( &outReal[i], AVX512( _mm512_loadu_pd(&inReal[i]) ) ), \
+   outReal[i] = FUNC(inReal[i]) )
+
+#if defined( TA_SIMD_X86 )
+
+#define TA_SIMD_KERNELS(NAME,PARAMS,ARGS,SSE2_STEP,AVX2_STEP,AVX512_STEP,SCALAR_STEP) \
+TA_SIMD_TARGET("sse2") static int NAME##_SSE2 PARAMS \
+{ \
+   int i; \
+   for( i=0; i+2 <= nbElement; i += 2 ) \
+      SSE2_STEP; \
+   return i; \
+} \
+TA_SIMD_TARGET("avx2") static int NAME##_AVX2 PARAMS \
+{ \
+   int i; \
+   for( i=0; i+4 <= nbElement; i += 4 ) \
+      AVX2_STEP; \
+   return i; \
+} \
+TA_SIMD_TARGET("avx512f") static int NAME##_AVX512 PARAMS \
+{ \
+   int i; \
+   for( i=0; i+8 <= nbElement; i += 8 ) \
+      AVX512_STEP; \
+   return i; \
+} \
+void TA_INT_Simd##NAME PARAMS \
+{ \
+   int i; \
+   switch( TA_GetSimdLevel() ) \
+   { \
+   case TA_SIMD_AVX512: i = NAME##_AVX512 ARGS; break; \
+   case TA_SIMD_AVX2:   i = NAME##_AVX2 ARGS; break; \
+   case TA_SIMD_SSE2:   i = NAME##_SSE2 ARGS; break; \
+   default:             i = 0; break; \
+   } \
+   for( ; i < nbElement; i++ ) \
+      SCALAR_STEP; \
+}
+
+/* SSE2 has no rounding instruction. Adding and subtracting 2^52
+ * rounds to the nearest integer (in the default rounding mode),
+ * which is then moved by one toward the requested direction. The
+ * sign of x is restored for the zero results, and values already
+ * integral (|x| >= 2^52), infinite or NaN are left as is.
+ */
+TA_SIMD_TARGET("sse2") static __m128d roundSSE2( __m128d x, int up )
+{
+   const __m128d sign  = _mm_set1_pd( -0.0 );
+   const __m128d two52 = _mm_set1_pd( 4503599627370496.0 );
+   const __m128d one   = _mm_set1_pd( 1.0 );
+   __m128d absX, small, r;
+
+   absX  = _mm_andnot_pd( sign, x );
+   small = _mm_cmplt_pd( absX, two52 );
+   r     = _mm_sub_pd( _mm_add_pd( absX, two52 ), two52 );
+   r     = _mm_or_pd( r, _mm_and_pd( x, sign ) );
+   if( up )
+      r = _mm_add_pd( r, _mm_and_pd( _mm_cmplt_pd( r, x ), one ) );
+   else
+      r = _mm_sub_pd( r, _mm_and_pd( _mm_cmpgt_pd( r, x ), one ) );
+   r     = _mm_or_pd( r, _mm_and_pd( x, sign ) );
+
+   return _mm_or_pd( _mm_and_pd( small, r ), _mm_andnot_pd( small, x ) );
+}
+
+#define SSE2_CEIL(x)    roundSSE2( x, 1 )
+#define SSE2_FLOOR(x)   roundSSE2( x, 0 )
+#define AVX512_CEIL(x)  _mm512_roundscale_pd( x, _MM_FROUND_TO_POS_INF|_MM_FROUND_NO_EXC )
+#define AVX512_FLOOR(x) _mm512_roundscale_pd( x, _MM_FROUND_TO_NEG_INF|_MM_FROUND_NO_EXC )
+
+/* Operations of each level used by the price transforms.
+ * MAX returns its second operand when the first is not greater,
+ * NaN included, like the comparisons of the scalar code.
+ */
+#define SSE2_T              __m128d
+#define SSE2_LOAD(p)        _mm_loadu_pd(p)
+#define SSE2_STORE(p,v)     _mm_storeu_pd(p,v)
+#define SSE2_SET1(x)        _mm_set1_pd(x)
+#define SSE2_ADD(a,b)       _mm_add_pd(a,b)
+#define SSE2_SUB(a,b)       _mm_sub_pd(a,b)
+#define SSE2_MUL(a,b)       _mm_mul_pd(a,b)
+#define SSE2_DIV(a,b)       _mm_div_pd(a,b)
+#define SSE2_MAX(a,b)       _mm_max_pd(a,b)
+#define SSE2_ABS(a)         _mm_andnot_pd(_mm_set1_pd(-0.0),a)
+#define SSE2_ZERO_IF_LT(v,a,b) _mm_andnot_pd(_mm_cmplt_pd(a,b),v)
+
+#define AVX2_T              __m256d
+#define AVX2_LOAD(p)        _mm256_loadu_pd(p)
+#define AVX2_STORE(p,v)     _mm256_storeu_pd(p,v)
+#define AVX2_SET1(x)        _mm256_set1_pd(x)
+#define AVX2_ADD(a,b)       _mm256_add_pd(a,b)
+#define AVX2_SUB(a,b)       _mm256_sub_pd(a,b)
+#define AVX2_MUL(a,b)       _mm256_mul_pd(a,b)
+#define AVX2_DIV(a,b)       _mm256_div_pd(a,b)
+#define AVX2_MAX(a,b)       _mm256_max_pd(a,b)
+#define AVX2_ABS(a)         _mm256_andnot_pd(_mm256_set1_pd(-0.0),a)
+#define AVX2_ZERO_IF_LT(v,a,b) _mm256_andnot_pd(_mm256_cmp_pd(a,b,_CMP_LT_OQ),v)
+
+#define AVX512_T            __m512d
+#define AVX512_LOAD(p)      _mm512_loadu_pd(p)
+#define AVX512_STORE(p,v)   _mm512_storeu_pd(p,v)
+#define AVX512_SET1(x)      _mm512_set1_pd(x)
+#define AVX512_ADD(a,b)     _mm512_add_pd(a,b)
+#define AVX512_SUB(a,b)     _mm512_sub_pd(a,b)
+#define AVX512_MUL(a,b)     _mm512_mul_pd(a,b)
+#define AVX512_DIV(a,b)     _mm512_div_pd(a,b)
+#define AVX512_MAX(a,b)     _mm512_max_pd(a,b)
+#define AVX512_ABS(a)       _mm512_abs_pd(a)
+#define AVX512_ZERO_IF_LT(v,a,b) _mm512_maskz_mov_pd(_mm512_cmp_pd_mask(a,b,_CMP_NLT_UQ),v)
+
+#else
+
+#define TA_SIMD_KERNELS(NAME,PARAMS,ARGS,SSE2_STEP,AVX2_STEP,AVX512_STEP,SCALAR_STEP) \
+void TA_INT_Simd##NAME PARAMS \
+{ \
+   int i; \
+   for( i=0; i < nbElement; i++ ) \
+      SCALAR_STEP; \
+}
+
+#endif
+
+SIMD_BINARY( Add,  +, _mm_add_pd, _mm256_add_pd, _mm512_add_pd )
+SIMD_BINARY( Sub,  -, _mm_sub_pd, _mm256_sub_pd, _mm512_sub_pd )
+SIMD_BINARY( Mult, *, _mm_mul_pd, _mm256_mul_pd, _mm512_mul_pd )
+SIMD_BINARY( Div,  /, _mm_div_pd, _mm256_div_pd, _mm512_div_pd )
+
+SIMD_UNARY( Sqrt,  sqrt,  _mm_sqrt_pd, _mm256_sqrt_pd,  _mm512_sqrt_pd )
+SIMD_UNARY( Ceil,  ceil,  SSE2_CEIL,   _mm256_ceil_pd,  AVX512_CEIL )
+SIMD_UNARY( Floor, floor, SSE2_FLOOR,  _mm256_floor_pd, AVX512_FLOOR )
+
+/* The price transforms keep the order of the operations of
+ * their scalar code, so the results are the same.
+ */
+#define SIMD_PRICE(NAME,PARAMS,ARGS,STEP,SCALAR_STEP) \
+TA_SIMD_KERNELS(NAME,PARAMS,ARGS,STEP(SSE2),STEP(AVX2),STEP(AVX512),SCALAR_STEP)
+
+#define AVGPRICE_STEP(P) \
+   P##_STORE( &outReal[i], P##_DIV( P##_ADD( P##_ADD( P##_ADD( P##_LOAD(&inHigh[i]), P##_LOAD(&inLow[i]) ), \
+                                                  P##_LOAD(&inClose[i]) ), P##_LOAD(&inOpen[i]) ), P##_SET1(4.0) ) )
+
+#define MEDPRICE_STEP(P) \
+   P##_STORE( &outReal[i], P##_DIV( P##_ADD( P##_LOAD(&inHigh[i]), P##_LOAD(&inLow[i]) ), P##_SET1(2.0) ) )
+
+#define TYPPRICE_STEP(P) \
+   P##_STORE( &outReal[i], P##_DIV( P##_ADD( P##_ADD( P##_LOAD(&inHigh[i]), P##_LOAD(&inLow[i]) ), \
+                                             P##_LOAD(&inClose[i]) ), P##_SET1(3.0) ) )
+
+#define WCLPRICE_STEP(P) \
+   P##_STORE( &outReal[i], P##_DIV( P##_ADD( P##_ADD( P##_LOAD(&inHigh[i]), P##_LOAD(&inLow[i]) ), \
+                                             P##_MUL( P##_LOAD(&inClose[i]), P##_SET1(2.0) ) ), P##_SET1(4.0) ) )
+
+#define TRANGE_STEP(P) \
+   { \
+      P##_T high      = P##_LOAD( &inHigh[i] ); \
+      P##_T low       = P##_LOAD( &inLow[i] ); \
+      P##_T prevClose = P##_LOAD( &inPrevClose[i] ); \
+      P##_T greatest  = P##_SUB( high, low ); \
+      greatest = P##_MAX( P##_ABS( P##_SUB( prevClose, high ) ), greatest ); \
+      greatest = P##_MAX( P##_ABS( P##_SUB( prevClose, low ) ), greatest ); \
+      P##_STORE( &outReal[i], greatest ); \
+   }
+
+#define BOP_STEP(P) \
+   { \
+      P##_T range = P##_SUB( P##_LOAD(&inHigh[i]), P##_LOAD(&inLow[i]) ); \
+      P##_T bop   = P##_DIV( P##_SUB( P##_LOAD(&inClose[i]), P##_LOAD(&inOpen[i]) ), range ); \
+      P##_STORE( &outReal[i], P##_ZERO_IF_LT( bop, range, P##_SET1(TA_EPSILON) ) ); \
+   }
+
+SIMD_PRICE( AvgPrice,
+   ( const double *inOpen, const double *inHigh, const double *inLow, const double *inClose, double *outReal, int nbElement ),
+   ( inOpen, inHigh, inLow, inClose, outReal, nbElement ),
+   AVGPRICE_STEP,
+   outReal[i] = ( inHigh[i] + inLow[i] + inClose[i] + inOpen[i] ) / 4 )
+
+SIMD_PRICE( MedPrice,
+   ( const double *inHigh, const double *inLow, double *outReal, int nbElement ),
+   ( inHigh, inLow, outReal, nbElement ),
+   MEDPRICE_STEP,
+   outReal[i] = ( inHigh[i] + inLow[i] ) / 2.0 )
+
+SIMD_PRICE( TypPrice,
+   ( const double *inHigh, const double *inLow, const double *inClose, double *outReal, int nbElement ),
+   ( inHigh, inLow, inClose, outReal, nbElement ),
+   TYPPRICE_STEP,
+   outReal[i] = ( inHigh[i] + inLow[i] + inClose[i] ) / 3.0 )
+
+SIMD_PRICE( WclPrice,
+   ( const double *inHigh, const double *inLow, const double *inClose, double *outReal, int nbElement ),
+   ( inHigh, inLow, inClose, outReal, nbElement ),
+   WCLPRICE_STEP,
+   outReal[i] = ( inHigh[i] + inLow[i] + (inClose[i]*2.0) ) / 4.0 )
+
+SIMD_PRICE( TrueRange,
+   ( const double *inHigh, const double *inLow, const double *inPrevClose, double *outReal, int nbElement ),
+   ( inHigh, inLow, inPrevClose, outReal, nbElement ),
+   TRANGE_STEP,
+   {
+      double greatest = inHigh[i] - inLow[i];
+      double val = fabs( inPrevClose[i] - inHigh[i] );
+      if( val > greatest )
+         greatest = val;
+      val = fabs( inPrevClose[i] - inLow[i] );
+      if( val > greatest )
+         greatest = val;
+      outReal[i] = greatest;
+   } )
+
+SIMD_PRICE( Bop,
+   ( const double *inOpen, const double *inHigh, const double *inLow, const double *inClose, double *outReal, int nbElement ),
+   ( inOpen, inHigh, inLow, inClose, outReal, nbElement ),
+   BOP_STEP,
+   outReal[i] = TA_IS_ZERO_OR_NEG( inHigh[i] - inLow[i] )? 0.0 : (inClose[i] - inOpen[i])/(inHigh[i] - inLow[i]) )
+
+/**** Local functions definitions.     ****/
+static int detectSimdLevel( void )
+{
+#if defined( TA_SIMD_X86 )
+   unsigned int regs[4];
+   unsigned long long xcr0;
+   int level;
+
+   if( simdSupported >= 0 )
+      return simdSupported;
+
+   level = TA_SIMD_SCALAR;
+
+   #if defined( _MSC_VER )
+      #define CPUID(leaf,r) __cpuidex( (int *)(r), leaf, 0 )
+   #else
+      #define CPUID(leaf,r) __cpuid_count( leaf, 0, (r)[0], (r)[1], (r)[2], (r)[3] )
+   #endif
+
+   CPUID( 0, regs );
+   if( regs[0] >= 1 )
+   {
+      CPUID( 1, regs );
+
+      /* EDX bit 26: SSE2 */
+      if( regs[3] & (1u<<26) )
+         level = TA_SIMD_SSE2;
+
+      /* ECX bit 27: OSXSAVE, bit 28: AVX. The OS must save the
+       * XMM and YMM registers (XCR0 bits 1 and 2) for AVX2, and
+       * the opmask and ZMM registers (XCR0 bits 5 to 7) for AVX-512.
+       */
+      if( (level == TA_SIMD_SSE2) && (regs[2] & (1u<<27)) && (regs[2] & (1u<<28)) )
+      {
+         #if defined( _MSC_VER )
+            xcr0 = _xgetbv( 0 );
+         #else
+            {
+               unsigned int eax, edx;
+               __asm__ __volatile__( "xgetbv" : "=a"(eax), "=d"(edx) : "c"(0) );
+               xcr0 = ((unsigned long long)edx << 32) | eax;
+            }
+         #endif
+
+         CPUID( 0, regs );
+         if( ((xcr0 & 0x06) == 0x06) && (regs[0] >= 7) )
+         {
+            /* EBX bit 5: AVX2, bit 16: AVX512F */
+            CPUID( 7, regs );
+            if( regs[1] & (1u<<5) )
+            {
+               level = TA_SIMD_AVX2;
+               if( ((xcr0 & 0xE6) == 0xE6) && (regs[1] & (1u<<16)) )
+                  level = TA_SIMD_AVX512;
+            }
+         }
+      }
+   }
+
+   #undef CPUID
+
+   simdSupported = level;
+   return level;
+#else
+   simdSupported = TA_SIMD_SCALAR;
+   return TA_SIMD_SCALAR;
+#endif
+}
@@ -53,6 +53,7 @@
    #include "ta_memory.h"
 namespace TicTacTec { namespace TA { namespace Library {
 #else
+   #include <string.h>
    #include "ta_utility.h"
    #include "ta_func.h"
    #include "ta_memory.h"
@@ -129,6 +130,201 @@ TA_Compatibility TA_GetCompatibility( void )
    return TA_GLOBALS_COMPATIBILITY;
 }
 
+#if !defined( _MANAGED )
+/* Index of the first element of 'sorted' that is not less than 'value'.
+ * Branchless, the comparisons on price data are unpredictable.
+ */
+static int meanDevLowerBound( const double *sorted, int nbSorted, double value )
+{
+   const double *base = sorted;
+   int half;
+
+   if( nbSorted == 0 )
+      return 0;
+
+   while( nbSorted > 1 )
+   {
+      half = nbSorted >> 1;
+      base = (base[half] < value)? base+half : base;
+      nbSorted -= half;
+   }
+   return (int)(base-sorted) + (*base < value);
+}
+
+TA_RetCode TA_INT_MeanDev( const double *inReal,
+                           int           nbValues,
+                           int           optInTimePeriod,
+                           double       *outMean,
+                           double       *outMeanDev )
+{
+   double *sorted;
+   int nbSorted, nonFinite, nextResync, pivot;
+   int i, j, k, posIn, posOut;
+   double value, leaving, sum, mean, pivotValue, sumBelow, dev, ref;
+
+   /* The finite values of the window are kept sorted, with
+    * 'pivot' the number of them below 'pivotValue', the last
+    * mean, and 'sumBelow' their sum. The sum of the absolute
+    * deviations from the mean only needs the values below it:
+    *
+    *    Sum(|x-mean|) = Sum(x-mean) + 2*Sum(mean-x, x < mean)
+    *                  = 2*(pivot*mean - sumBelow)
+    *
+    * The new and the leaving values are located with a binary
+    * search, O(log period), and the pivot only moves over the
+    * values crossed by the mean from one bar to the next.
+    *
+    * 'sum' and 'sumBelow' accumulate the values minus 'ref', the
+    * median of the window at the last resync. Accumulating the
+    * prices themselves cancels in pivot*mean-sumBelow, the error
+    * would grow with the price level instead of the window range.
+    */
+   sorted = (double *)TA_Malloc( sizeof(double)*optInTimePeriod );
+   if( !sorted )
+      return TA_ALLOC_ERR;
+
+   nbSorted   = 0;
+   nonFinite  = 0;
+   pivot      = 0;
+   pivotValue = TA_REAL_MIN;
+   sumBelow   = 0.0;
+   sum        = 0.0;
+   ref        = 0.0;
+
+   /* The running sums are recalculated every period and after a
+    * non-finite value left the window to bound the rounding drift.
+    */
+   nextResync = optInTimePeriod-1;
+   k = 0;
+   for( i=0; i < nbValues; i++ )
+   {
+      /* Replace the value leaving the window by the new one, only
+       * the sorted values between their two positions are moved.
+       */
+      value = inReal[i];
+      posIn = -1;
+      if( value - value != 0.0 )
+         nonFinite++;
+      else
+      {
+         posIn = meanDevLowerBound( sorted, nbSorted, value );
+         if( value < pivotValue )
+         {
+            pivot++;
+            sumBelow += value-ref;
+         }
+      }
+      sum += value-ref;
+
+      posOut = -1;
+      if( i >= optInTimePeriod )
+      {
+         leaving = inReal[i-optInTimePeriod];
+         if( leaving - leaving != 0.0 )
+         {
+            nonFinite--;
+            nextResync = i;
+         }
+         else
+         {
+            posOut = meanDevLowerBound( sorted, nbSorted, leaving );
+            if( leaving < pivotValue )
+            {
+               pivot--;
+               sumBelow -= leaving-ref;
+            }
+         }
+         sum -= leaving-ref;
+      }
+
+      if( posOut < 0 )
+      {
+         if( posIn >= 0 )
+         {
+            memmove( &sorted[posIn+1], &sorted[posIn], (nbSorted-posIn)*sizeof(double) );
+            sorted[posIn] = value;
+            nbSorted++;
+         }
+      }
+      else if( posIn < 0 )
+      {
+         nbSorted--;
+         memmove( &sorted[posOut], &sorted[posOut+1], (nbSorted-posOut)*sizeof(double) );
+      }
+      else if( posIn > posOut )
+      {
+         memmove( &sorted[posOut], &sorted[posOut+1], (posIn-1-posOut)*sizeof(double) );
+         sorted[posIn-1] = value;
+      }
+      else
+      {
+         memmove( &sorted[posIn+1], &sorted[posIn], (posOut-posIn)*sizeof(double) );
+         sorted[posIn] = value;
+      }
+
+      if( i < optInTimePeriod-1 )
+         continue;
+
+      if( i >= nextResync )
+      {
+         /* 'sumBelow' is only recalculated for a finite window. */
+         if( nonFinite == 0 )
+            ref = sorted[nbSorted>>1];
+         sum = 0.0;
+         for( j=i-optInTimePeriod+1; j <= i; j++ )
+            sum += inReal[j]-ref;
+      }
+      mean = ref+sum/optInTimePeriod;
+
+      if( nonFinite != 0 )
+      {
+         /* Same NaN/infinity propagation as a direct summation. */
+         dev = mean-mean;
+      }
+      else
+      {
+         /* Move the pivot to the new mean. */
+         while( (pivot < nbSorted) && (sorted[pivot] < mean) )
+            sumBelow += sorted[pivot++]-ref;
+         while( (pivot > 0) && (sorted[pivot-1] >= mean) )
+            sumBelow -= sorted[--pivot]-ref;
+         pivotValue = mean;
+
+         if( i >= nextResync )
+         {
+            sumBelow = 0.0;
+            for( j=0; j < pivot; j++ )
+               sumBelow += sorted[j]-ref;
+         }
+
+         if( sorted[0] == sorted[nbSorted-1] )
+         {
+            /* All the values in the window are equal. */
+            mean = sorted[0];
+            dev  = 0.0;
+         }
+         else
+         {
+            dev = 2.0*(pivot*(mean-ref)-sumBelow)/optInTimePeriod;
+            if( dev < 0.0 )
+               dev = 0.0;
+         }
+      }
+
+      if( i >= nextResync )
+         nextResync = i+optInTimePeriod;
+
+      if( outMean )
+         outMean[k] = mean;
+      outMeanDev[k++] = dev;
+   }
+
+   TA_Free( sorted );
+
+   return TA_SUCCESS;
+}
+#endif
+
 #if defined( _MANAGED )
 }}} // Close namespace TicTacTec::TA::Lib
 #endif
@@ -21,6 +21,8 @@
    #ifndef NULL
       #define NULL 0
    #endif
+#elif defined( _JAVA )
+   #define NULL null
 #endif
 
 /* Calculate a Simple Moving Average.
@@ -130,6 +132,37 @@ TA_RetCode TA_S_INT_PO( int           startIdx,
                         int  doPercentageOutput );
 #endif
 
+/* Internal linear regression function.
+ *
+ * All the outputs are optional (NULL), only the
+ * requested ones are calculated.
+ */
+#if !defined( _MANAGED ) && !defined( _JAVA )
+TA_RetCode TA_INT_LINEARREG( int           startIdx,
+                             int           endIdx,
+                             const double *inReal,
+                             int           optInTimePeriod,
+                             int          *outBegIdx,
+                             int          *outNBElement,
+                             double       *outSlope,
+                             double       *outIntercept,
+                             double       *outAngle,
+                             double       *outLinearReg,
+                             double       *outTSF );
+
+TA_RetCode TA_S_INT_LINEARREG( int           startIdx,
+                               int           endIdx,
+                               const float  *inReal,
+                               int           optInTimePeriod,
+                               int          *outBegIdx,
+                               int          *outNBElement,
+                               double       *outSlope,
+                               double       *outIntercept,
+                               double       *outAngle,
+                               double       *outLinearReg,
+                               double       *outTSF );
+#endif
+
 /* Internal variance function. */
 #if !defined( _MANAGED ) && !defined( _JAVA )
 TA_RetCode TA_INT_VAR( int           startIdx,
@@ -149,6 +182,56 @@ TA_RetCode TA_S_INT_VAR( int           startIdx,
                          double       *outReal );
 #endif
 
+/* Mean and mean absolute deviation of each 'optInTimePeriod'
+ * window of inReal, from a sorted copy of the window updated
+ * with binary searches instead of two summations per window.
+ *
+ * The first output is for the window ending at
+ * inReal[optInTimePeriod-1]. inReal must not be one of
+ * the outputs. outMean can be NULL.
+ *
+ * Used by CCI and AVGDEV once the period is at least
+ * TA_MEANDEV_MIN_PERIOD, below that the direct summation
+ * is faster.
+ */
+#define TA_MEANDEV_MIN_PERIOD 64
+
+#if !defined( _MANAGED ) && !defined( _JAVA )
+TA_RetCode TA_INT_MeanDev( const double *inReal,
+                           int           nbValues,
+                           int           optInTimePeriod,
+                           double       *outMean,
+                           double       *outMeanDev );
+#endif
+
+/* Element-wise kernels of ADD, SUB, MULT, DIV, SQRT, CEIL
+ * and FLOOR, vectorized with the instruction set returned by
+ * TA_GetSimdLevel. Results are identical to the scalar loops.
+ * The output may be one of the inputs.
+ */
+#if !defined( _MANAGED ) && !defined( _JAVA )
+void TA_INT_SimdAdd  ( const double *inReal0, const double *inReal1, double *outReal, int nbElement );
+void TA_INT_SimdSub  ( const double *inReal0, const double *inReal1, double *outReal, int nbElement );
+void TA_INT_SimdMult ( const double *inReal0, const double *inReal1, double *outReal, int nbElement );
+void TA_INT_SimdDiv  ( const double *inReal0, const double *inReal1, double *outReal, int nbElement );
+void TA_INT_SimdSqrt ( const double *inReal, double *outReal, int nbElement );
+void TA_INT_SimdCeil ( const double *inReal, double *outReal, int nbElement );
+void TA_INT_SimdFloor( const double *inReal, double *outReal, int nbElement );
+#endif
+
+/* Same for the price transforms AVGPRICE, MEDPRICE, TYPPRICE,
+ * WCLPRICE, TRANGE and BOP. inPrevClose is the close of the
+ * bar before each inHigh/inLow.
+ */
+#if !defined( _MANAGED ) && !defined( _JAVA )
+void TA_INT_SimdAvgPrice ( const double *inOpen, const double *inHigh, const double *inLow, const double *inClose, double *outReal, int nbElement );
+void TA_INT_SimdMedPrice ( const double *inHigh, const double *inLow, double *outReal, int nbElement );
+void TA_INT_SimdTypPrice ( const double *inHigh, const double *inLow, const double *inClose, double *outReal, int nbElement );
+void TA_INT_SimdWclPrice ( const double *inHigh, const double *inLow, const double *inClose, double *outReal, int nbElement );
+void TA_INT_SimdTrueRange( const double *inHigh, const double *inLow, const double *inPrevClose, double *outReal, int nbElement );
+void TA_INT_SimdBop      ( const double *inOpen, const double *inHigh, const double *inLow, const double *inClose, double *outReal, int nbElement );
+#endif
+
 /* A function to calculate a standard deviation.
  *
  * This function allows speed optimization when the
@@ -272,7 +272,7 @@ static void printFunc( FILE *out,
                      );
 
 static void printCallFrame  ( FILE *out, const TA_FuncInfo *funcInfo );
-static void printFrameHeader( FILE *out, const TA_FuncInfo *funcInfo, unsigned int lookbackSignature );
+static void printFrameHeader( FILE *out, const TA_FuncInfo *funcInfo, unsigned int lookbackSignature, unsigned int inputIsSinglePrecision );
 
 static void printExternReferenceForEachFunction( const TA_FuncInfo *info,
                                                  void *opaqueData );
@@ -1652,9 +1652,11 @@ static void doForEachFunctionPhase2( const TA_FuncInfo *funcInfo,
 
    /* Create the frame definition (ta_frame.c) and declaration (ta_frame.h) */
    genPrefix = 1;
-   printFrameHeader( gOutFrame_H->file, funcInfo, 0 );
+   printFrameHeader( gOutFrame_H->file, funcInfo, 0, 0 );
    fprintf( gOutFrame_H->file, ";\n" );
-   printFrameHeader( gOutFrame_H->file, funcInfo, 1 );
+   printFrameHeader( gOutFrame_H->file, funcInfo, 1, 0 );
+   fprintf( gOutFrame_H->file, ";\n" );
+   printFrameHeader( gOutFrame_H->file, funcInfo, 0, 1 );
    fprintf( gOutFrame_H->file, ";\n\n" );
    printCallFrame( gOutFrame_C->file, funcInfo );
 
@@ -2121,8 +2123,9 @@ static void printFunc( FILE *out,
       }
       else
       {  
-         print( out, "%sTA_%s(\n", prefix == NULL? "" : prefix, funcName );
-         indent += 4;
+         print( out, "%sTA_%s%s(\n", prefix == NULL? "" : prefix,
+                inputIsSinglePrecision? "S_" : "", funcName );
+         indent += inputIsSinglePrecision? 6 : 4;
       }
    }
    else if( validationCode )
@@ -2257,7 +2260,7 @@ static void printFunc( FILE *out,
                {
                   printIndent( out, indent );
                   if( frame )
-                     fprintf( out, "params->in[%d].data.inPrice.open, /*", paramNb );
+                     fprintf( out, "params->in[%d].data.inPrice%s.open, /*", paramNb, inputIsSinglePrecision? "S":"" );
 				  if( arrayToSubArrayCnvt )
 				  {
                      fprintf( out, "              gcnew SubArrayFrom1D<%s>(inOpen,0)", inputDoubleArrayType );
@@ -2278,7 +2281,7 @@ static void printFunc( FILE *out,
                {
                   printIndent( out, indent );
                   if( frame )
-                     fprintf( out, "params->in[%d].data.inPrice.high, /*", paramNb );
+                     fprintf( out, "params->in[%d].data.inPrice%s.high, /*", paramNb, inputIsSinglePrecision? "S":"" );
 				  if( arrayToSubArrayCnvt )
 				  {
                      fprintf( out, "              gcnew SubArrayFrom1D<%s>(inHigh,0)", inputDoubleArrayType );
@@ -2299,7 +2302,7 @@ static void printFunc( FILE *out,
                {
                   printIndent( out, indent );
                   if( frame )
-                     fprintf( out, "params->in[%d].data.inPrice.low, /*", paramNb );
+                     fprintf( out, "params->in[%d].data.inPrice%s.low, /*", paramNb, inputIsSinglePrecision? "S":"" );
                   if( arrayToSubArrayCnvt )
 				  {
 					  fprintf( out, "              gcnew SubArrayFrom1D<%s>(inLow,0)", inputDoubleArrayType );
@@ -2321,7 +2324,7 @@ static void printFunc( FILE *out,
                {
                   printIndent( out, indent );
                   if( frame )
-                     fprintf( out, "params->in[%d].data.inPrice.close, /*", paramNb );
+                     fprintf( out, "params->in[%d].data.inPrice%s.close, /*", paramNb, inputIsSinglePrecision? "S":"" );
                   if( arrayToSubArrayCnvt )
 				  {
 					  fprintf( out, "              gcnew SubArrayFrom1D<%s>(inClose,0)", inputDoubleArrayType );
@@ -2343,7 +2346,7 @@ static void printFunc( FILE *out,
                {
                   printIndent( out, indent );
                   if( frame )
-                     fprintf( out, "params->in[%d].data.inPrice.volume, /*", paramNb );
+                     fprintf( out, "params->in[%d].data.inPrice%s.volume, /*", paramNb, inputIsSinglePrecision? "S":"" );
                   if( arrayToSubArrayCnvt )
 				  {
 					  fprintf( out, "              gcnew SubArrayFrom1D<%s>(inVolume,0)", inputDoubleArrayType );
@@ -2365,7 +2368,7 @@ static void printFunc( FILE *out,
                {
                   printIndent( out, indent );
                   if( frame )
-                     fprintf( out, "params->in[%d].data.inPrice.openInterest, /*", paramNb );
+                     fprintf( out, "params->in[%d].data.inPrice%s.openInterest, /*", paramNb, inputIsSinglePrecision? "S":"" );
                   if( arrayToSubArrayCnvt )
 				  {
 					  fprintf( out, "              gcnew SubArrayFrom1D<%s>(inOpenInterest,0)", inputDoubleArrayType );
@@ -2410,7 +2413,8 @@ static void printFunc( FILE *out,
             {
 				
                if( frame )
-                  fprintf( out, "params->in[%d].data.%s, /*", paramNb, defaultParamName );
+                  fprintf( out, "params->in[%d].data.%s%s, /*", paramNb, defaultParamName,
+                           (inputIsSinglePrecision && (inputParamInfo->type == TA_Input_Real))? "S":"" );
                if( outputForSWIG )
                   fprintf( out, "%-*s%s%s /* %s */",
                            prototype? 12 : 0,
@@ -2773,23 +2777,31 @@ static void printCallFrame( FILE *out, const TA_FuncInfo *funcInfo )
 {
    genPrefix = 1;
 
-   printFrameHeader( out, funcInfo, 0 );
+   printFrameHeader( out, funcInfo, 0, 0 );
    print( out, "{\n" );
    printFunc( out, "   return ", funcInfo, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 );
    print( out, "}\n" );
 
-   printFrameHeader( out, funcInfo, 1 );
+   printFrameHeader( out, funcInfo, 1, 0 );
    print( out, "{\n" );
    if( funcInfo->nbOptInput == 0 )
       print( out, "   (void)params;\n" );
    printFunc( out, "   return ", funcInfo, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0 );
    print( out, "}\n" );
+
+   /* Same frame calling the TA_S_XXX function, used by TA_CallFunc when the
+    * inputs were set with TA_SetInputParamSingleRealPtr/SinglePricePtr.
+    */
+   printFrameHeader( out, funcInfo, 0, 1 );
+   print( out, "{\n" );
+   printFunc( out, "   return ", funcInfo, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0 );
+   print( out, "}\n" );
    
    genPrefix = 0;
 }
 
 
-static void printFrameHeader( FILE *out, const TA_FuncInfo *funcInfo, unsigned int lookbackSignature )
+static void printFrameHeader( FILE *out, const TA_FuncInfo *funcInfo, unsigned int lookbackSignature, unsigned int inputIsSinglePrecision )
 {
    if( lookbackSignature )
    {
@@ -2797,7 +2809,8 @@ static void printFrameHeader( FILE *out, const TA_FuncInfo *funcInfo, unsigned i
    }
    else
    {
-      print( out, "TA_RetCode TA_%s_FramePP( const TA_ParamHolderPriv *params,\n", funcInfo->name );
+      print( out, "TA_RetCode TA_%s_FramePP%s( const TA_ParamHolderPriv *params,\n", funcInfo->name,
+             inputIsSinglePrecision? "S" : "" );
       print( out, "                          int            startIdx,\n" );
       print( out, "                          int            endIdx,\n" );
       print( out, "                          int           *outBegIdx,\n" );
@@ -4334,6 +4347,25 @@ static void appendToFunc( FILE *out )
    fprintf( out, " * to restore the default settings for the specified settingType\n" );
    fprintf( out, " */\n" );
    fprintf( out, "TA_RetCode TA_RestoreCandleDefaultSettings( TA_CandleSettingType settingType );\n" );
+   fprintf( out, "\n" );
+   fprintf( out, "/* Call TA_GetCandleSettings to retrieve the rangeType, avgPeriod \n" );
+   fprintf( out, " * and factor currently used for the specified settingType\n" );
+   fprintf( out, " */\n" );
+   fprintf( out, "TA_RetCode TA_GetCandleSettings( TA_CandleSettingType settingType, \n" );
+   fprintf( out, "                                 TA_RangeType *rangeType, \n" );
+   fprintf( out, "                                 int *avgPeriod, \n" );
+   fprintf( out, "                                 double *factor );\n" );
+   fprintf( out, "\n" );
+   fprintf( out, "/* ADD, SUB, MULT, DIV, SQRT, CEIL, FLOOR and the price transforms\n" );
+   fprintf( out, " * AVGPRICE, MEDPRICE, TYPPRICE, WCLPRICE, TRANGE and BOP use SIMD\n" );
+   fprintf( out, " * kernels chosen at runtime from the CPU features. TA_GetSimdLevel returns\n" );
+   fprintf( out, " * the instruction set in use, TA_SetSimdLevel lowers it (TA_SIMD_SCALAR\n" );
+   fprintf( out, " * disables the kernels). A level above what the CPU and OS support\n" );
+   fprintf( out, " * is reduced to the highest supported one. Results are the same\n" );
+   fprintf( out, " * for every level.\n" );
+   fprintf( out, " */\n" );
+   fprintf( out, "TA_RetCode TA_SetSimdLevel( TA_SimdLevel value );\n" );
+   fprintf( out, "TA_SimdLevel TA_GetSimdLevel( void );\n" );
 }
 
 void genJavaCodePhase1( const TA_FuncInfo *funcInfo )
@@ -292,6 +292,12 @@ typedef enum
   TA_TEST_FAIL_BUG1359452_4  = 2004,
   TA_TEST_FAIL_BUG1359452_5  = 2005,
 
+  /* Error code related to test_simd */
+  TA_SIMD_TEST_SCALAR_FAILED = 2100,
+  TA_SIMD_TEST_LEVEL_FAILED  = 2101,
+  TA_SIMD_TEST_BAD_RANGE     = 2102,
+  TA_SIMD_TEST_BAD_VALUE     = 2103,
+
   TA_LAST_VALID_ERROR = 0xFFFF
 } ErrorNumber;
 #endif
@@ -147,6 +147,10 @@ int main( int argc, char **argv )
       return retValue;
    }
 
+   /* Time the SIMD kernels against the scalar loops. */
+   if( doExtensiveProfiling )
+      profile_simd();
+
    /* Test abstract interface. */
    retValue = test_abstract();
    if( retValue != TA_TEST_PASS )
@@ -274,6 +278,7 @@ static ErrorNumber testTAFunction_ALL( void )
    DO_TEST( test_func_avgdev,   "AVGDEV" );
    DO_TEST( test_func_bbands,   "BBANDS" );
    DO_TEST( test_candlestick,   "All Candlesticks" );
+   DO_TEST( test_func_simd,     "SIMD kernels" );
 
    return TA_TEST_PASS; /* All tests succeeded. */
 }
@@ -294,6 +299,7 @@ static void printUsage(void)
       printf( "    -p Only generate profiling data on stdout. This is\n" );
       printf( "       intended only for the TA-Lib developers. It is\n" );
       printf( "       not further documented for general use.\n" );
+      printf( "       The SIMD kernels are timed at each level.\n" );
       printf( "\n" );
       printf( "   On success, the exit code is 0.\n" );
       printf( "   On failure, the exit code is a number that can be\n" );
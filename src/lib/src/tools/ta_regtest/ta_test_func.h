@@ -24,5 +24,8 @@ ErrorNumber test_func_1in_1out( TA_History *history );
 ErrorNumber test_func_1in_2out( TA_History *history );
 ErrorNumber test_func_avgdev  ( TA_History *history );
 ErrorNumber test_func_imi     ( TA_History *history );
+ErrorNumber test_func_simd    ( TA_History *history );
+
+void profile_simd( void );
 
 #endif
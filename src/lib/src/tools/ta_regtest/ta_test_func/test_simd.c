@@ -0,0 +1,261 @@
+/* TA-LIB Copyright (c) 1999-2008, Mario Fortier
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or
+ * without modification, are permitted provided that the following
+ * conditions are met:
+ *
+ * - Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ *
+ * - Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in
+ *   the documentation and/or other materials provided with the
+ *   distribution.
+ *
+ * - Neither name of author nor the names of its contributors
+ *   may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * ``AS IS'' AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ * FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ * REGENTS OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ * INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+ * EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Description:
+ *     Test the SIMD kernels of the element-wise and price
+ *     transform functions.
+ *
+ *     Every level supported by the CPU must give the same
+ *     bits than the scalar loops, for any start index (so
+ *     that all the tail lengths are covered).
+ *
+ *     When profiling (ta_regtest -p), the time of each level
+ *     is also reported for the gData history.
+ */
+
+/**** Headers ****/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "ta_test_priv.h"
+#include "ta_test_func.h"
+#include "ta_utility.h"
+
+/**** External functions declarations. ****/
+/* None */
+
+/**** External variables declarations. ****/
+extern double gDataOpen[];
+extern double gDataHigh[];
+extern double gDataLow[];
+extern double gDataClose[];
+
+/**** Global variables definitions.    ****/
+/* None */
+
+/**** Local declarations.              ****/
+typedef enum {
+TA_ADD_TEST,
+TA_SUB_TEST,
+TA_MULT_TEST,
+TA_DIV_TEST,
+TA_SQRT_TEST,
+TA_CEIL_TEST,
+TA_FLOOR_TEST,
+TA_AVGPRICE_TEST,
+TA_MEDPRICE_TEST,
+TA_TYPPRICE_TEST,
+TA_WCLPRICE_TEST,
+TA_TRANGE_TEST,
+TA_BOP_TEST,
+NB_SIMD_TEST
+} TA_TestId;
+
+static const char *testName[NB_SIMD_TEST] =
+{
+   "ADD", "SUB", "MULT", "DIV", "SQRT", "CEIL", "FLOOR",
+   "AVGPRICE", "MEDPRICE", "TYPPRICE", "WCLPRICE", "TRANGE", "BOP"
+};
+
+static const char *levelName[] = { "scalar", "sse2", "avx2", "avx512" };
+
+#define MAX_NB_BARS    10000
+#define NB_START_IDX   9
+#define NB_BENCH_LOOP  2000
+
+/**** Local functions declarations.    ****/
+static TA_RetCode callFunction( TA_TestId id,
+                                int startIdx,
+                                int endIdx,
+                                const TA_Real *open,
+                                const TA_Real *high,
+                                const TA_Real *low,
+                                const TA_Real *close,
+                                int *outBegIdx,
+                                int *outNbElement,
+                                TA_Real *out );
+
+/**** Local variables definitions.     ****/
+static TA_Real scalarOut[MAX_NB_BARS];
+static TA_Real simdOut[MAX_NB_BARS];
+
+/**** Global functions definitions.   ****/
+ErrorNumber test_func_simd( TA_History *history )
+{
+   TA_SimdLevel initialLevel, level;
+   TA_RetCode retCode;
+   int id, startIdx, i;
+   int scalarBegIdx, scalarNbElement;
+   int simdBegIdx, simdNbElement;
+
+   initialLevel = TA_GetSimdLevel();
+
+   for( level=TA_SIMD_SSE2; level <= initialLevel; level++ )
+   {
+      for( id=0; id < NB_SIMD_TEST; id++ )
+      {
+         for( startIdx=0; startIdx < NB_START_IDX; startIdx++ )
+         {
+            TA_SetSimdLevel( TA_SIMD_SCALAR );
+            retCode = callFunction( (TA_TestId)id, startIdx, history->nbBars-1,
+                                    history->open, history->high, history->low, history->close,
+                                    &scalarBegIdx, &scalarNbElement, scalarOut );
+            if( retCode != TA_SUCCESS )
+            {
+               TA_SetSimdLevel( initialLevel );
+               printf( "Fail: %s scalar (retCode=%d)\n", testName[id], retCode );
+               return TA_SIMD_TEST_SCALAR_FAILED;
+            }
+
+            TA_SetSimdLevel( level );
+            retCode = callFunction( (TA_TestId)id, startIdx, history->nbBars-1,
+                                    history->open, history->high, history->low, history->close,
+                                    &simdBegIdx, &simdNbElement, simdOut );
+            TA_SetSimdLevel( initialLevel );
+            if( retCode != TA_SUCCESS )
+            {
+               printf( "Fail: %s %s (retCode=%d)\n", testName[id], levelName[level], retCode );
+               return TA_SIMD_TEST_LEVEL_FAILED;
+            }
+
+            if( (simdBegIdx != scalarBegIdx) || (simdNbElement != scalarNbElement) )
+            {
+               printf( "Fail: %s %s output range [%d,%d] != [%d,%d]\n",
+                       testName[id], levelName[level],
+                       simdBegIdx, simdNbElement, scalarBegIdx, scalarNbElement );
+               return TA_SIMD_TEST_BAD_RANGE;
+            }
+
+            for( i=0; i < scalarNbElement; i++ )
+            {
+               if( memcmp( &simdOut[i], &scalarOut[i], sizeof(TA_Real) ) != 0 )
+               {
+                  printf( "Fail: %s %s at %d: %.17g != %.17g\n",
+                          testName[id], levelName[level],
+                          scalarBegIdx+i, simdOut[i], scalarOut[i] );
+                  return TA_SIMD_TEST_BAD_VALUE;
+               }
+            }
+         }
+      }
+   }
+
+   /* All test succeed. */
+   return TA_TEST_PASS;
+}
+
+void profile_simd( void )
+{
+   TA_SimdLevel initialLevel, level;
+   int id, loop, outBegIdx, outNbElement;
+   clock_t startClock;
+   double elapsed[TA_SIMD_AVX512+1];
+
+   initialLevel = TA_GetSimdLevel();
+
+   printf( "\nSIMD kernels (%d bars of gData, %d calls)\n", MAX_NB_BARS, NB_BENCH_LOOP );
+   printf( "%10s", "" );
+   for( level=TA_SIMD_SCALAR; level <= initialLevel; level++ )
+      printf( "%10s", levelName[level] );
+   printf( "   (milliseconds, speedup)\n" );
+
+   for( id=0; id < NB_SIMD_TEST; id++ )
+   {
+      printf( "%10s", testName[id] );
+      for( level=TA_SIMD_SCALAR; level <= initialLevel; level++ )
+      {
+         TA_SetSimdLevel( level );
+         startClock = clock();
+         for( loop=0; loop < NB_BENCH_LOOP; loop++ )
+         {
+            callFunction( (TA_TestId)id, 0, MAX_NB_BARS-1,
+                          gDataOpen, gDataHigh, gDataLow, gDataClose,
+                          &outBegIdx, &outNbElement, simdOut );
+         }
+         elapsed[level] = ((double)(clock()-startClock)*1000.0)/(double)CLOCKS_PER_SEC;
+         if( level == TA_SIMD_SCALAR )
+            printf( "%10.1f", elapsed[level] );
+         else
+            printf( "%10.2f", elapsed[level] > 0.0? elapsed[TA_SIMD_SCALAR]/elapsed[level] : 0.0 );
+      }
+      printf( "\n" );
+   }
+
+   TA_SetSimdLevel( initialLevel );
+}
+
+/**** Local functions definitions.     ****/
+static TA_RetCode callFunction( TA_TestId id,
+                                int startIdx,
+                                int endIdx,
+                                const TA_Real *open,
+                                const TA_Real *high,
+                                const TA_Real *low,
+                                const TA_Real *close,
+                                int *outBegIdx,
+                                int *outNbElement,
+                                TA_Real *out )
+{
+   switch( id )
+   {
+   case TA_ADD_TEST:
+      return TA_ADD( startIdx, endIdx, high, low, outBegIdx, outNbElement, out );
+   case TA_SUB_TEST:
+      return TA_SUB( startIdx, endIdx, high, low, outBegIdx, outNbElement, out );
+   case TA_MULT_TEST:
+      return TA_MULT( startIdx, endIdx, high, low, outBegIdx, outNbElement, out );
+   case TA_DIV_TEST:
+      return TA_DIV( startIdx, endIdx, close, open, outBegIdx, outNbElement, out );
+   case TA_SQRT_TEST:
+      return TA_SQRT( startIdx, endIdx, close, outBegIdx, outNbElement, out );
+   case TA_CEIL_TEST:
+      return TA_CEIL( startIdx, endIdx, close, outBegIdx, outNbElement, out );
+   case TA_FLOOR_TEST:
+      return TA_FLOOR( startIdx, endIdx, close, outBegIdx, outNbElement, out );
+   case TA_AVGPRICE_TEST:
+      return TA_AVGPRICE( startIdx, endIdx, open, high, low, close, outBegIdx, outNbElement, out );
+   case TA_MEDPRICE_TEST:
+      return TA_MEDPRICE( startIdx, endIdx, high, low, outBegIdx, outNbElement, out );
+   case TA_TYPPRICE_TEST:
+      return TA_TYPPRICE( startIdx, endIdx, high, low, close, outBegIdx, outNbElement, out );
+   case TA_WCLPRICE_TEST:
+      return TA_WCLPRICE( startIdx, endIdx, high, low, close, outBegIdx, outNbElement, out );
+   case TA_TRANGE_TEST:
+      return TA_TRANGE( startIdx, endIdx, high, low, close, outBegIdx, outNbElement, out );
+   case TA_BOP_TEST:
+      return TA_BOP( startIdx, endIdx, open, high, low, close, outBegIdx, outNbElement, out );
+   default:
+      return TA_BAD_PARAM;
+   }
+}
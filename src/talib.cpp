@@ -28,6 +28,15 @@
 #include <node.h>
 #include <nan.h>
 
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "./lib/include/ta_abstract.h"
 #include "./lib/include/ta_common.h"
 #include "./lib/include/ta_defs.h"
@@ -64,25 +73,194 @@ struct work_object {
     int endIdx;
     int nbOutput;
     TA_ParamHolder *func_params;
+    bool sharedParams;
     TA_RetCode retCode;
     int outBegIdx;
     int outNBElement;
     double **outReal;
     int **outInt;
-    double **garbage;
-    int garbage_count;
+    std::vector<double *> garbage;
+    struct input_cache *inputCache;
+    TA_Context *context;
+    bool sharedContext;
+    bool typedOutput;
+    bool callerOutput;
+    std::vector<void *> outputs;
 };
 
-static void REPORT_TA_ERROR(Callback *callback, TA_RetCode retCode) {
+// Input arrays converted once and shared by the work objects of a batch
+struct input_cache {
+    std::vector<Local<Value> > values;
+    std::vector<double *> arrays;
+    std::vector<int> lengths;
+};
 
-    // Report TA Error
-    Local<Value> argv[1];
-    Local<Object> result = New<Object>();
+// Function parameter layout
+struct func_layout {
+    const TA_FuncHandle *func_handle;
+    const TA_FuncInfo *func_info;
+    std::vector<const TA_InputParameterInfo *> inputs;
+    std::vector<const TA_OptInputParameterInfo *> optInputs;
+    std::vector<const TA_OutputParameterInfo *> outputs;
+};
+
+// Optional input parameter value
+struct opt_value {
+    double real;
+    int integer;
+};
+
+// Execution options
+struct execute_options {
+    int startIdx;
+    int endIdx;
+    bool typedOutput;
+    bool callerOutput;
+    Local<Object> outputs;
+};
+
+// Functions a graph computes from shared intermediates, the others are called as in a batch
+enum graph_function {
+    GRAPH_DIRECT,
+    GRAPH_TRANGE,
+    GRAPH_ATR,
+    GRAPH_NATR,
+    GRAPH_PLUS_DM,
+    GRAPH_MINUS_DM,
+    GRAPH_PLUS_DI,
+    GRAPH_MINUS_DI,
+    GRAPH_DX,
+    GRAPH_ADX,
+    GRAPH_ADXR,
+    GRAPH_RSI,
+    GRAPH_STOCHRSI
+};
+
+// Intermediates computed once for every function of a graph reading them
+enum graph_node_kind {
+    GRAPH_NODE_TRANGE,
+    GRAPH_NODE_ATR,
+    GRAPH_NODE_DM,
+    GRAPH_NODE_ADX,
+    GRAPH_NODE_RSI
+};
+
+// Intermediate of a graph, its values cover the bars first to last
+struct graph_node {
+    graph_node_kind kind;
+    const double *inputs[3];
+    int period;
+    int base;
+    int first;
+    int last;
+    int parent;
+    TA_Context *context;
+    double *values[3];
+};
+
+// Function of a graph and the intermediate it is computed from
+struct graph_item {
+    graph_function function;
+    int node;
+    int period;
+    int startIdx;
+    int base;
+    int lookback;
+    const double *close;
+    std::vector<opt_value> optValues;
+};
+
+// Async batch object
+struct batch_object {
+    std::vector<work_object *> items;
+    std::vector<double *> garbage;
+    TA_Context *context;
+    bool graph;
+    std::vector<graph_node> nodes;
+    std::vector<graph_item> graphItems;
+};
+
+// Price input fields in the order expected by TA_SetInputParamPricePtr
+static const struct {
+    TA_InputFlags flag;
+    const char *name;
+} price_fields[] = {
+    { TA_IN_PRICE_OPEN, "open" },
+    { TA_IN_PRICE_HIGH, "high" },
+    { TA_IN_PRICE_LOW, "low" },
+    { TA_IN_PRICE_CLOSE, "close" },
+    { TA_IN_PRICE_VOLUME, "volume" },
+    { TA_IN_PRICE_OPENINTEREST, "openInterest" }
+};
+
+// Function unstable period identifiers
+static const struct {
+    const char *name;
+    TA_FuncUnstId id;
+} unstable_ids[] = {
+    { "TA_FUNC_UNST_ADX", TA_FUNC_UNST_ADX },
+    { "TA_FUNC_UNST_ADXR", TA_FUNC_UNST_ADXR },
+    { "TA_FUNC_UNST_ATR", TA_FUNC_UNST_ATR },
+    { "TA_FUNC_UNST_CMO", TA_FUNC_UNST_CMO },
+    { "TA_FUNC_UNST_DX", TA_FUNC_UNST_DX },
+    { "TA_FUNC_UNST_EMA", TA_FUNC_UNST_EMA },
+    { "TA_FUNC_UNST_HT_DCPERIOD", TA_FUNC_UNST_HT_DCPERIOD },
+    { "TA_FUNC_UNST_HT_DCPHASE", TA_FUNC_UNST_HT_DCPHASE },
+    { "TA_FUNC_UNST_HT_PHASOR", TA_FUNC_UNST_HT_PHASOR },
+    { "TA_FUNC_UNST_HT_SINE", TA_FUNC_UNST_HT_SINE },
+    { "TA_FUNC_UNST_HT_TRENDLINE", TA_FUNC_UNST_HT_TRENDLINE },
+    { "TA_FUNC_UNST_HT_TRENDMODE", TA_FUNC_UNST_HT_TRENDMODE },
+    { "TA_FUNC_UNST_IMI", TA_FUNC_UNST_IMI },
+    { "TA_FUNC_UNST_KAMA", TA_FUNC_UNST_KAMA },
+    { "TA_FUNC_UNST_MAMA", TA_FUNC_UNST_MAMA },
+    { "TA_FUNC_UNST_MFI", TA_FUNC_UNST_MFI },
+    { "TA_FUNC_UNST_MINUS_DI", TA_FUNC_UNST_MINUS_DI },
+    { "TA_FUNC_UNST_MINUS_DM", TA_FUNC_UNST_MINUS_DM },
+    { "TA_FUNC_UNST_NATR", TA_FUNC_UNST_NATR },
+    { "TA_FUNC_UNST_PLUS_DI", TA_FUNC_UNST_PLUS_DI },
+    { "TA_FUNC_UNST_PLUS_DM", TA_FUNC_UNST_PLUS_DM },
+    { "TA_FUNC_UNST_RSI", TA_FUNC_UNST_RSI },
+    { "TA_FUNC_UNST_STOCHRSI", TA_FUNC_UNST_STOCHRSI },
+    { "TA_FUNC_UNST_T3", TA_FUNC_UNST_T3 },
+    { "TA_FUNC_UNST_ALL", TA_FUNC_UNST_ALL },
+    { "TA_FUNC_UNST_NONE", TA_FUNC_UNST_NONE }
+};
+
+// Candle setting types
+static const struct {
+    const char *name;
+    TA_CandleSettingType type;
+} candle_settings[] = {
+    { "BodyLong", TA_BodyLong },
+    { "BodyVeryLong", TA_BodyVeryLong },
+    { "BodyShort", TA_BodyShort },
+    { "BodyDoji", TA_BodyDoji },
+    { "ShadowLong", TA_ShadowLong },
+    { "ShadowVeryLong", TA_ShadowVeryLong },
+    { "ShadowShort", TA_ShadowShort },
+    { "ShadowVeryShort", TA_ShadowVeryShort },
+    { "Near", TA_Near },
+    { "Far", TA_Far },
+    { "Equal", TA_Equal }
+};
+
+// Candle range types
+static const struct {
+    const char *name;
+    TA_RangeType type;
+} range_types[] = {
+    { "RealBody", TA_RangeType_RealBody },
+    { "HighLow", TA_RangeType_HighLow },
+    { "Shadows", TA_RangeType_Shadows }
+};
+
+static std::string TA_ERROR_STRING(TA_RetCode retCode) {
+
+    // Get the TA Error name
     TA_RetCodeInfo retCodeInfo;
     TA_SetRetCodeInfo(retCode, &retCodeInfo);
-    Set(result, New<String>("error").ToLocalChecked(), New<String>(retCodeInfo.enumStr).ToLocalChecked());
-    argv[0] = result;
-    callback->Call(1, argv);
+    return retCodeInfo.enumStr;
+
 }
 
 static void REPORT_INTERNAL_ERROR(Callback *callback, const char *error) {
@@ -90,15 +268,20 @@ static void REPORT_INTERNAL_ERROR(Callback *callback, const char *error) {
     // Report Internal Error
     Local<Value> argv[1];
     Local<Object> result = New<Object>();
+
+    // Throw the error when called synchronously
+    if (callback == NULL) {
+        ThrowTypeError(error);
+        return;
+    }
+
     Set(result, New<String>("error").ToLocalChecked(), New<String>(error).ToLocalChecked());
     argv[0] = result;
     callback->Call(1, argv);
+    delete callback;
 }
 
-static double *V8_TO_DOUBLE_ARRAY(Local<Array> array) {
-        
-    // Get the array length
-    int length = array->Length();
+static double *V8_TO_DOUBLE_ARRAY(Local<Object> array, int length) {
     
     // Allocate memory for double array
     double *result = new double[length];
@@ -113,6 +296,254 @@ static double *V8_TO_DOUBLE_ARRAY(Local<Array> array) {
     
 }
 
+static double *V8_INPUT_DOUBLE_ARRAY(Local<Value> value, int *length, work_object *wo) {
+
+    // Float64Array values are read in place from their backing store
+    if (value->IsFloat64Array()) {
+        Nan::TypedArrayContents<double> contents(value);
+        *length = (int)contents.length();
+        return *contents;
+    }
+
+    // ArrayBuffer values are read in place as a sequence of doubles, a partial double is invalid
+    if (value->IsArrayBuffer()) {
+        Local<v8::ArrayBuffer> buffer = value.As<v8::ArrayBuffer>();
+        if (buffer->ByteLength() % sizeof(double) != 0) {
+            *length = -1;
+            return NULL;
+        }
+        *length = (int)(buffer->ByteLength() / sizeof(double));
+        return (double *)buffer->Data();
+    }
+
+    // Reuse an array already converted for another function of the batch
+    if (wo->inputCache) {
+        for (size_t i=0; i < wo->inputCache->values.size(); i++) {
+            if (wo->inputCache->values[i]->StrictEquals(value)) {
+                *length = wo->inputCache->lengths[i];
+                return wo->inputCache->arrays[i];
+            }
+        }
+    }
+
+    // Get the array length
+    if (value->IsArray()) {
+        *length = value.As<Array>()->Length();
+    } else if (value->IsTypedArray()) {
+        *length = (int)value.As<v8::TypedArray>()->Length();
+    } else {
+        *length = -1;
+        return NULL;
+    }
+
+    // Other arrays are copied into a double array owned by the work object, or by the batch
+    double *result = V8_TO_DOUBLE_ARRAY(value.As<Object>(), *length);
+    if (wo->inputCache) {
+        wo->inputCache->values.push_back(value);
+        wo->inputCache->arrays.push_back(result);
+        wo->inputCache->lengths.push_back(*length);
+    } else {
+        wo->garbage.push_back(result);
+    }
+    return result;
+
+}
+
+static double *GET_INPUT_DOUBLE_ARRAY(Local<Object> parameter, const char *name, work_object *wo, Local<Array> pinned, std::string &error) {
+
+    // Input array length
+    int length = 0;
+
+    // Check if the parameter object has the input field
+    if (!HasOwnProperty(parameter, New<String>(name).ToLocalChecked()).FromJust()) {
+        error = (std::string)("First argument must contain '") + (std::string)(name) + (std::string)("' field");
+        return NULL;
+    }
+
+    // Get the input values
+    Local<Value> value = Get(parameter, New<String>(name).ToLocalChecked()).ToLocalChecked();
+    double *result = V8_INPUT_DOUBLE_ARRAY(value, &length, wo);
+
+    // Check the input type
+    if (length < 0) {
+        error = (std::string)("Field '") + (std::string)(name) + (std::string)("' must be an Array, Float64Array or ArrayBuffer");
+        return NULL;
+    }
+
+    // Check the input covers the requested range
+    if (result == NULL || length <= wo->endIdx) {
+        error = (std::string)("Field '") + (std::string)(name) + (std::string)("' must contain at least endIdx + 1 values");
+        return NULL;
+    }
+
+    // Keep the input alive while the function is executed
+    Set(pinned, pinned->Length(), value);
+
+    return result;
+}
+
+static float *GET_INPUT_FLOAT_ARRAY(Local<Object> parameter, const char *name, work_object *wo, Local<Array> pinned, std::string &error) {
+
+    // Float32Array values are read in place from their backing store
+    Local<Value> value = Get(parameter, New<String>(name).ToLocalChecked()).ToLocalChecked();
+    Nan::TypedArrayContents<float> contents(value);
+
+    // Check the input covers the requested range
+    if (*contents == NULL || (int)contents.length() <= wo->endIdx) {
+        error = (std::string)("Field '") + (std::string)(name) + (std::string)("' must contain at least endIdx + 1 values");
+        return NULL;
+    }
+
+    // Keep the input alive while the function is executed
+    Set(pinned, pinned->Length(), value);
+
+    return *contents;
+}
+
+static bool SINGLE_PRECISION_INPUTS(Local<Object> parameter, const func_layout *layout) {
+
+    // Number of Float32Array inputs
+    int count = 0;
+
+    // Loop for all the real and price input fields
+    for (int i=0; i < (int)layout->inputs.size(); i++) {
+
+        const TA_InputParameterInfo *input_paraminfo = layout->inputs[i];
+
+        for (int p=0; p < 6; p++) {
+
+            // Get the field name, integer inputs have none
+            const char *name;
+            if (input_paraminfo->type == TA_Input_Price) {
+                if (!(input_paraminfo->flags & price_fields[p].flag))
+                    continue;
+                name = price_fields[p].name;
+            } else if (input_paraminfo->type == TA_Input_Real && p == 0) {
+                name = input_paraminfo->paramName;
+            } else {
+                break;
+            }
+
+            // Every field must be a Float32Array
+            Local<Value> value = Get(parameter, New<String>(name).ToLocalChecked()).ToLocalChecked();
+            if (!value->IsFloat32Array())
+                return false;
+            count++;
+
+        }
+
+    }
+
+    return count > 0;
+}
+
+static void *GET_OUTPUT_ARRAY(Local<Object> outputs, const TA_OutputParameterInfo *output_paraminfo, int length, Local<Array> pinned, std::string &error) {
+
+    // Output array value
+    Local<Value> value;
+
+    // Check if the outputs object has the output field
+    if (!HasOwnProperty(outputs, New<String>(output_paraminfo->paramName).ToLocalChecked()).FromJust()) {
+        error = (std::string)("Field 'outputs' must contain '") + (std::string)(output_paraminfo->paramName) + (std::string)("' field");
+        return NULL;
+    }
+
+    // Get the output array
+    value = Get(outputs, New<String>(output_paraminfo->paramName).ToLocalChecked()).ToLocalChecked();
+
+    // Check the output array type
+    if ((output_paraminfo->type == TA_Output_Real && !value->IsFloat64Array()) || (output_paraminfo->type == TA_Output_Integer && !value->IsInt32Array())) {
+        error = (std::string)("Output '") + (std::string)(output_paraminfo->paramName) + (std::string)(output_paraminfo->type == TA_Output_Real ? "' must be a Float64Array" : "' must be an Int32Array");
+        return NULL;
+    }
+
+    // Check the output array can hold all the results
+    if ((int)value.As<v8::TypedArray>()->Length() < length) {
+        error = (std::string)("Output '") + (std::string)(output_paraminfo->paramName) + (std::string)("' must hold at least ") + std::to_string(length) + (std::string)(" values");
+        return NULL;
+    }
+
+    // Keep the output alive while the function is executed
+    Set(pinned, pinned->Length(), value);
+
+    // Return the output backing store
+    if (output_paraminfo->type == TA_Output_Integer)
+        return *Nan::TypedArrayContents<int>(value);
+    return *Nan::TypedArrayContents<double>(value);
+}
+
+static void CLEAR_WORK_OBJECT(work_object *wo) {
+
+    // Clear the arrays allocated
+    for (size_t i=0; i < wo->garbage.size(); i++) {
+        delete[] wo->garbage[i];
+    }
+    wo->garbage.clear();
+
+    // Clear parameter holder memory
+    if (wo->func_params && !wo->sharedParams)
+        TA_ParamHolderFree(wo->func_params);
+    wo->func_params = NULL;
+
+    // Clear the settings context
+    if (!wo->sharedContext)
+        TA_ContextFree(wo->context);
+    wo->context = NULL;
+
+    // Dispose output arrays, caller provided outputs belong to the caller
+    for (int i=0; i < wo->nbOutput && !wo->callerOutput; i++) {
+        if (wo->outReal)
+            delete[] wo->outReal[i];
+        if (wo->outInt)
+            delete[] wo->outInt[i];
+    }
+    delete[] wo->outReal;
+    delete[] wo->outInt;
+    wo->outReal = NULL;
+    wo->outInt = NULL;
+
+}
+
+static void DISPOSE_WORK_OBJECT(work_object *wo) {
+
+    // Clear the work object memory
+    CLEAR_WORK_OBJECT(wo);
+
+    // Dispose work object
+    delete wo;
+
+}
+
+static void FREE_REAL_OUTPUT(void *data, size_t length, void *deleter_data) {
+
+    // Release a real output array handed over to V8
+    delete[] (double *)data;
+
+}
+
+static void FREE_INTEGER_OUTPUT(void *data, size_t length, void *deleter_data) {
+
+    // Release an integer output array handed over to V8
+    delete[] (int *)data;
+
+}
+
+static Local<Value> OUTPUT_TO_TYPED_ARRAY(void *data, int length, bool isInteger) {
+
+    // Element size of the output
+    size_t elementSize = isInteger ? sizeof(int) : sizeof(double);
+
+    // Hand the output memory over to an external array buffer
+    std::unique_ptr<v8::BackingStore> store = v8::ArrayBuffer::NewBackingStore(data, length * elementSize, isInteger ? FREE_INTEGER_OUTPUT : FREE_REAL_OUTPUT, NULL);
+    Local<v8::ArrayBuffer> buffer = v8::ArrayBuffer::New(v8::Isolate::GetCurrent(), std::move(store));
+
+    // Wrap the buffer with a typed array view
+    if (isInteger)
+        return v8::Int32Array::New(buffer, 0, length);
+    return v8::Float64Array::New(buffer, 0, length);
+
+}
+
 static Local<Object> generateResult(work_object *wo) {
     // Create the outputs object
     Local<Object> outputArray = New<Object>();
@@ -135,12 +566,45 @@ static Local<Object> generateResult(work_object *wo) {
     Set(result, New<String>("begIndex").ToLocalChecked(), New<Number>(wo->outBegIdx));
     Set(result, New<String>("nbElement").ToLocalChecked(), New<Number>(wo->outNBElement));
 
+    // Results were written to the caller provided outputs
+    if (wo->callerOutput) {
+        return result;
+    }
+
     // Loop for all the output parameters
     for (int i=0; i < wo->nbOutput; i++) {
 
         // Get the output parameter information
         TA_GetOutputParameterInfo(wo->func_handle, i, &output_paraminfo);
 
+        // Wrap the output memory when typed results are requested
+        if (wo->typedOutput) {
+
+            // Determine the output type
+            switch(output_paraminfo->type) {
+
+                    // Output type real is needed
+                case TA_Output_Real:
+
+                    // Set the Float64Array result, it now owns the output memory
+                    Set(outputArray, New<String>(output_paraminfo->paramName).ToLocalChecked(), OUTPUT_TO_TYPED_ARRAY(wo->outReal[i], resultLength, false));
+                    wo->outReal[i] = NULL;
+
+                    break;
+
+                    // Output type integer is needed
+                case TA_Output_Integer:
+
+                    // Set the Int32Array result, it now owns the output memory
+                    Set(outputArray, New<String>(output_paraminfo->paramName).ToLocalChecked(), OUTPUT_TO_TYPED_ARRAY(wo->outInt[i], resultLength, true));
+                    wo->outInt[i] = NULL;
+
+                    break;
+            }
+
+            continue;
+        }
+
         // Create an array for results
         Local<Array> resultArray = New<Array>(resultLength);
 
@@ -187,6 +651,7 @@ static Local<Value> TA_EXPLAIN_FUNCTION(const char *func_name) {
     // Function handle and information
     const TA_FuncHandle *func_handle;
     const TA_FuncInfo   *func_info;
+    unsigned int         func_id;
     
     // Function object
     Local<Object> func_object;
@@ -221,6 +686,8 @@ static Local<Value> TA_EXPLAIN_FUNCTION(const char *func_name) {
     
     // Store the function information
     Set(func_object, New("name").ToLocalChecked(), New(func_info->name).ToLocalChecked());
+    if (TA_GetFuncId(func_handle, &func_id) == TA_SUCCESS)
+        Set(func_object, New("id").ToLocalChecked(), New<Number>(func_id));
     Set(func_object, New("group").ToLocalChecked(), New(func_info->group).ToLocalChecked());
     Set(func_object, New("hint").ToLocalChecked(), New(func_info->hint).ToLocalChecked());
     
@@ -365,6 +832,29 @@ static Local<Value> TA_EXPLAIN_FUNCTION(const char *func_name) {
     
 }
 
+static void FREEZE_OBJECT(Local<Object> object) {
+
+    // Freeze the nested objects first
+    Local<Array> keys = Nan::GetOwnPropertyNames(object).ToLocalChecked();
+    for (unsigned int i=0; i < keys->Length(); i++) {
+        Local<Value> value = Get(object, Get(keys, i).ToLocalChecked()).ToLocalChecked();
+        if (value->IsObject())
+            FREEZE_OBJECT(value.As<Object>());
+    }
+
+    // Freeze the object itself
+    object->SetIntegrityLevel(Nan::GetCurrentContext(), v8::IntegrityLevel::kFrozen).Check();
+
+}
+
+static void CACHE_PROPERTY(Local<Object> holder, Local<String> property, Local<Value> value) {
+
+    // Replace the accessor with a read only value, so the value is only built once per context
+    Nan::Delete(holder, property).FromJust();
+    Nan::DefineOwnProperty(holder, property, value, static_cast<v8::PropertyAttribute>(v8::ReadOnly | v8::DontDelete)).FromJust();
+
+}
+
 NAN_GETTER(Functions) {
     HandleScope();
 
@@ -408,10 +898,40 @@ NAN_GETTER(Functions) {
         
     }
 
+    // Freeze and cache the function descriptions
+    FREEZE_OBJECT(func_array);
+    CACHE_PROPERTY(info.Holder(), property, func_array);
+
     // Return function names
     info.GetReturnValue().Set(func_array);
 }
 
+NAN_GETTER(FunctionsByName) {
+    HandleScope();
+
+    // Function lookup object
+    Local<Object> func_lookup = New<Object>();
+
+    // Get the cached function descriptions
+    Local<Array> func_array = Get(info.Holder(), New<String>("functions").ToLocalChecked()).ToLocalChecked().As<Array>();
+
+    // Loop for all the functions
+    for (unsigned int i=0; i < func_array->Length(); i++) {
+
+        // Key the function description by its name
+        Local<Object> func_object = Get(func_array, i).ToLocalChecked().As<Object>();
+        Set(func_lookup, Get(func_object, New<String>("name").ToLocalChecked()).ToLocalChecked(), func_object);
+
+    }
+
+    // Freeze and cache the function lookup
+    func_lookup->SetIntegrityLevel(Nan::GetCurrentContext(), v8::IntegrityLevel::kFrozen).Check();
+    CACHE_PROPERTY(info.Holder(), property, func_lookup);
+
+    // Return function lookup
+    info.GetReturnValue().Set(func_lookup);
+}
+
 NAN_METHOD(Explain) {
     HandleScope();
 
@@ -439,32 +959,9 @@ NAN_GETTER(FunctionUnstIds) {
     Local<Object> func_object = New<Object>();
 
     // Add Function Unstable IDs
-    Set(func_object, New<String>("TA_FUNC_UNST_ADX").ToLocalChecked(), New(TA_FUNC_UNST_ADX));
-    Set(func_object, New<String>("TA_FUNC_UNST_ADXR").ToLocalChecked(), New(TA_FUNC_UNST_ADXR));
-    Set(func_object, New<String>("TA_FUNC_UNST_ATR").ToLocalChecked(), New(TA_FUNC_UNST_ATR));
-    Set(func_object, New<String>("TA_FUNC_UNST_CMO").ToLocalChecked(), New(TA_FUNC_UNST_CMO));
-    Set(func_object, New<String>("TA_FUNC_UNST_DX").ToLocalChecked(), New(TA_FUNC_UNST_DX));
-    Set(func_object, New<String>("TA_FUNC_UNST_EMA").ToLocalChecked(), New(TA_FUNC_UNST_EMA));
-    Set(func_object, New<String>("TA_FUNC_UNST_HT_DCPERIOD").ToLocalChecked(), New(TA_FUNC_UNST_HT_DCPERIOD));
-    Set(func_object, New<String>("TA_FUNC_UNST_HT_DCPHASE").ToLocalChecked(), New(TA_FUNC_UNST_HT_DCPHASE));
-    Set(func_object, New<String>("TA_FUNC_UNST_HT_PHASOR").ToLocalChecked(), New(TA_FUNC_UNST_HT_PHASOR));
-    Set(func_object, New<String>("TA_FUNC_UNST_HT_SINE").ToLocalChecked(), New(TA_FUNC_UNST_HT_SINE));
-    Set(func_object, New<String>("TA_FUNC_UNST_HT_TRENDLINE").ToLocalChecked(), New(TA_FUNC_UNST_HT_TRENDLINE));
-    Set(func_object, New<String>("TA_FUNC_UNST_HT_TRENDMODE").ToLocalChecked(), New(TA_FUNC_UNST_HT_TRENDMODE));
-    Set(func_object, New<String>("TA_FUNC_UNST_IMI").ToLocalChecked(), New(TA_FUNC_UNST_IMI));
-    Set(func_object, New<String>("TA_FUNC_UNST_KAMA").ToLocalChecked(), New(TA_FUNC_UNST_KAMA));
-    Set(func_object, New<String>("TA_FUNC_UNST_MAMA").ToLocalChecked(), New(TA_FUNC_UNST_MAMA));
-    Set(func_object, New<String>("TA_FUNC_UNST_MFI").ToLocalChecked(), New(TA_FUNC_UNST_MFI));
-    Set(func_object, New<String>("TA_FUNC_UNST_MINUS_DI").ToLocalChecked(), New(TA_FUNC_UNST_MINUS_DI));
-    Set(func_object, New<String>("TA_FUNC_UNST_MINUS_DM").ToLocalChecked(), New(TA_FUNC_UNST_MINUS_DM));
-    Set(func_object, New<String>("TA_FUNC_UNST_NATR").ToLocalChecked(), New(TA_FUNC_UNST_NATR));
-    Set(func_object, New<String>("TA_FUNC_UNST_PLUS_DI").ToLocalChecked(), New(TA_FUNC_UNST_PLUS_DI));
-    Set(func_object, New<String>("TA_FUNC_UNST_PLUS_DM").ToLocalChecked(), New(TA_FUNC_UNST_PLUS_DM));
-    Set(func_object, New<String>("TA_FUNC_UNST_RSI").ToLocalChecked(), New(TA_FUNC_UNST_RSI));
-    Set(func_object, New<String>("TA_FUNC_UNST_STOCHRSI").ToLocalChecked(), New(TA_FUNC_UNST_STOCHRSI));
-    Set(func_object, New<String>("TA_FUNC_UNST_T3").ToLocalChecked(), New(TA_FUNC_UNST_T3));
-    Set(func_object, New<String>("TA_FUNC_UNST_ALL").ToLocalChecked(), New(TA_FUNC_UNST_ALL));
-    Set(func_object, New<String>("TA_FUNC_UNST_NONE").ToLocalChecked(), New(TA_FUNC_UNST_NONE));
+    for (size_t i=0; i < sizeof(unstable_ids) / sizeof(unstable_ids[0]); i++) {
+        Set(func_object, New<String>(unstable_ids[i].name).ToLocalChecked(), New(unstable_ids[i].id));
+    }
 
     // Return function IDs
     info.GetReturnValue().Set(func_object);
@@ -500,37 +997,31 @@ NAN_METHOD(SetUnstablePeriod) {
     }
 }
 
+static void CALL_WORK_OBJECT(work_object *wo) {
+
+    // Execute the function call with the settings of the work object on this thread
+    TA_Context *previous = TA_GetThreadContext();
+    if (wo->context)
+        TA_SetThreadContext(wo->context);
+    wo->retCode = TA_CallFunc((const TA_ParamHolder *)wo->func_params, wo->startIdx, wo->endIdx, &wo->outBegIdx, &wo->outNBElement);
+    TA_SetThreadContext(previous);
+
+}
+
 class ExecuteWorker : public AsyncWorker {
  public:
   ExecuteWorker(Callback *callback, work_object *wo): AsyncWorker(callback), wo(wo) {}
   ~ExecuteWorker() {
 
-    // Clear the arrays allocated
-    for (int i=0; i < wo->garbage_count; i++) {
-        delete[] wo->garbage[i];
-    }
-    delete[] wo->garbage;
-
-    // Clear parameter holder memory
-    TA_ParamHolderFree(wo->func_params);
-    
-    // Dispose output arrays
-    for (int i=0; i < wo->nbOutput; i++) {
-        delete wo->outReal[i];
-        delete wo->outInt[i];
-    }
-    delete wo->outReal;
-    delete wo->outInt;
-    
-    // Dispose work object
-    delete wo;
+    // Dispose the work object
+    DISPOSE_WORK_OBJECT(wo);
 
   }
 
   void Execute () {
 
     // Execute the function call with parameters declared
-    wo->retCode = TA_CallFunc((const TA_ParamHolder *)wo->func_params, wo->startIdx, wo->endIdx, &wo->outBegIdx, &wo->outNBElement);
+    CALL_WORK_OBJECT(wo);
 
   }
 
@@ -551,352 +1042,214 @@ class ExecuteWorker : public AsyncWorker {
   work_object *wo;
 };
 
-NAN_METHOD(Execute) {
+static TA_RetCode GET_FUNCTION_HANDLE(Local<Value> name, const TA_FuncHandle **handle) {
 
-    // Execution parameter
-    Local<Object> executeParameter;
+    // Numeric function identifiers are resolved without any string handling
+    if (name->IsNumber())
+        return TA_GetFuncHandleById(name->Uint32Value(Nan::GetCurrentContext()).FromJust(), handle);
 
-    // Callback function
-    Callback *cb;
-    bool isSync = false;
+    // Retreive the function name string
+    Utf8String func_name( name->ToString(Nan::GetCurrentContext()).FromMaybe(v8::Local<v8::String>()) );
+    return TA_GetFuncHandle(*func_name, handle);
+
+}
+
+static bool LOAD_FUNCTION_LAYOUT(Local<Value> name, func_layout *layout, std::string &error) {
 
-    // Price values
-    double *open            = NULL;
-    double *close           = NULL;
-    double *high            = NULL;
-    double *low             = NULL;
-    double *volume          = NULL;
-    double *openInterest    = NULL;
-
-    double *inRealList      = NULL;
-    
-    // Numeric values
-    double inReal;
-    int inInteger;
-    
     // Return code
     TA_RetCode retCode;
-    
-    // Function handle
-    const TA_FuncHandle *func_handle;
-    
-    // Function information
-    const TA_FuncInfo *func_info;
-    
-    // Function parameter holder
-    TA_ParamHolder *func_params;
-    
-    // Function parameter information
-    const TA_InputParameterInfo     *input_paraminfo;
-    const TA_OptInputParameterInfo  *opt_paraminfo;
-    const TA_OutputParameterInfo    *output_paraminfo;
 
-    // Check the arguments
-    if (info.Length() < 1) {
-        ThrowTypeError("argument required - Object");
-        return;
+    // Retreive the function handle for function name or identifier
+    if ((retCode = GET_FUNCTION_HANDLE(name, &layout->func_handle)) != TA_SUCCESS) {
+        error = TA_ERROR_STRING(retCode);
+        return false;
     }
 
-    // Check the execution parameter
-    if (!info[0]->IsObject()) {
-        ThrowTypeError("First argument must be an Object with fields name, startIdx, endIdx and function input parameters");
-        return;
+    // Retreive the function information for the function handle
+    if ((retCode = TA_GetFuncInfo(layout->func_handle, &layout->func_info)) != TA_SUCCESS) {
+        error = TA_ERROR_STRING(retCode);
+        return false;
     }
-    
-    // Check the callback parameter
-    if (!info[1]->IsFunction()) {
-        isSync = true;
+
+    // Retreive the input, optional input and output parameter information
+    layout->inputs.resize(layout->func_info->nbInput);
+    for (int i=0; i < (int)layout->func_info->nbInput; i++) {
+        TA_GetInputParameterInfo(layout->func_handle, i, &layout->inputs[i]);
     }
-    
-    // Get the execute parameter
-    executeParameter = info[0]->ToObject(Nan::GetCurrentContext()).FromMaybe(v8::Local<Object>());
-    
-    // Get the callback function
-    cb = new Callback(info[1].As<Function>());
-    
-    // Check the function name parameter
-    if (!HasOwnProperty(executeParameter, New<String>("name").ToLocalChecked()).FromJust()) {
-        REPORT_INTERNAL_ERROR(cb, "First argument must contain 'name' field");
-        return;
+    layout->optInputs.resize(layout->func_info->nbOptInput);
+    for (int i=0; i < (int)layout->func_info->nbOptInput; i++) {
+        TA_GetOptInputParameterInfo(layout->func_handle, i, &layout->optInputs[i]);
     }
-    
-    // Retreive the function name string
-    Utf8String func_name( Get(executeParameter, New<String>("name").ToLocalChecked()).ToLocalChecked()->ToString(Nan::GetCurrentContext()).FromMaybe(v8::Local<v8::String>()) );
-    
+    layout->outputs.resize(layout->func_info->nbOutput);
+    for (int i=0; i < (int)layout->func_info->nbOutput; i++) {
+        TA_GetOutputParameterInfo(layout->func_handle, i, &layout->outputs[i]);
+    }
+
+    return true;
+}
+
+static bool READ_EXECUTE_OPTIONS(Local<Object> parameter, execute_options *options, std::string &error) {
+
     // Check the start index
-    if (!HasOwnProperty(executeParameter, New<String>("startIdx").ToLocalChecked()).FromJust()) {
-        REPORT_INTERNAL_ERROR(cb, "First argument must contain 'startIdx' field");
-        return;
+    if (!HasOwnProperty(parameter, New<String>("startIdx").ToLocalChecked()).FromJust()) {
+        error = "First argument must contain 'startIdx' field";
+        return false;
     }
     
     // Check the end index
-    if (!HasOwnProperty(executeParameter, New<String>("endIdx").ToLocalChecked()).FromJust()) {
-        REPORT_INTERNAL_ERROR(cb, "First argument must contain 'endIdx' field");
-        return;
+    if (!HasOwnProperty(parameter, New<String>("endIdx").ToLocalChecked()).FromJust()) {
+        error = "First argument must contain 'endIdx' field";
+        return false;
     }
     
     // Refreive the start and end index
-    int startIdx = Get(executeParameter, New<String>("startIdx").ToLocalChecked()).ToLocalChecked()->Int32Value(Nan::GetCurrentContext()).FromJust();
-    int endIdx = Get(executeParameter, New<String>("endIdx").ToLocalChecked()).ToLocalChecked()->Int32Value(Nan::GetCurrentContext()).FromJust();
+    options->startIdx = Get(parameter, New<String>("startIdx").ToLocalChecked()).ToLocalChecked()->Int32Value(Nan::GetCurrentContext()).FromJust();
+    options->endIdx = Get(parameter, New<String>("endIdx").ToLocalChecked()).ToLocalChecked()->Int32Value(Nan::GetCurrentContext()).FromJust();
 
     // Check for negative indexes
-    if ((startIdx < 0) || (endIdx < 0)) {
-        REPORT_INTERNAL_ERROR(cb, "Arguments 'startIdx' and 'endIdx' need to be positive");
-        return;
+    if ((options->startIdx < 0) || (options->endIdx < 0)) {
+        error = "Arguments 'startIdx' and 'endIdx' need to be positive";
+        return false;
     }
 
     // Check for index correctness
-    if (startIdx > endIdx) {
-        REPORT_INTERNAL_ERROR(cb, "Argument 'startIdx' needs to be smaller than argument 'endIdx'");
-        return;
+    if (options->startIdx > options->endIdx) {
+        error = "Argument 'startIdx' needs to be smaller than argument 'endIdx'";
+        return false;
     }
 
-    // Retreive the function handle for function name
-    if ((retCode = TA_GetFuncHandle(*func_name, &func_handle)) != TA_SUCCESS) {
-        REPORT_TA_ERROR(cb, retCode);
-        return;
-    }
-    
-    // Retreive the function information for the function handle
-    if ((retCode = TA_GetFuncInfo(func_handle, &func_info)) != TA_SUCCESS) {
-        REPORT_TA_ERROR(cb, retCode);
-        return;
+    // Check for caller provided output arrays
+    options->callerOutput = false;
+    if (HasOwnProperty(parameter, New<String>("outputs").ToLocalChecked()).FromJust()) {
+
+        // Check the outputs parameter
+        Local<Value> outputs = Get(parameter, New<String>("outputs").ToLocalChecked()).ToLocalChecked();
+        if (!outputs->IsObject()) {
+            error = "Argument 'outputs' needs to be an Object with a typed array for every output";
+            return false;
+        }
+
+        options->outputs = outputs.As<Object>();
+        options->callerOutput = true;
+
     }
 
-    // Allocate parameter holder memory for function handle
-    if ((retCode = TA_ParamHolderAlloc(func_handle, &func_params)) != TA_SUCCESS) {
-        REPORT_TA_ERROR(cb, retCode);
-        return;
+    // Check the output mode
+    options->typedOutput = false;
+    if (HasOwnProperty(parameter, New<String>("output").ToLocalChecked()).FromJust()) {
+
+        // Retreive the output mode string
+        Utf8String output_mode( Get(parameter, New<String>("output").ToLocalChecked()).ToLocalChecked()->ToString(Nan::GetCurrentContext()).FromMaybe(v8::Local<v8::String>()) );
+
+        // Check for a known output mode
+        if (strcmp(*output_mode, "typed") == 0) {
+            options->typedOutput = true;
+        } else if (strcmp(*output_mode, "array") != 0) {
+            error = "Argument 'output' needs to be either 'array' or 'typed'";
+            return false;
+        }
+
     }
 
+    return true;
+}
+
+static bool BIND_INPUTS(Local<Object> parameter, const func_layout *layout, work_object *wo, Local<Array> pinned, std::string &error) {
+
+    // Return code
+    TA_RetCode retCode;
+
+    // Price values
+    double *prices[6];
+
+    // Real values
+    double *inRealList;
+
+    // Integer values
+    int inInteger;
+
+    // Single precision price and real values, when every real input is a Float32Array
+    float *pricesS[6];
+    float *inRealS;
+    bool single = SINGLE_PRECISION_INPUTS(parameter, layout);
+
     // Loop for all the input parameters
-    double **garbage = (double **)malloc(func_info->nbInput * 6 * sizeof(double*));
-    int garbage_count = 0;
-    for (int i=0; i < (int)func_info->nbInput; i++) {
+    for (int i=0; i < (int)layout->inputs.size(); i++) {
 
         // Get the function input parameter information
-        TA_GetInputParameterInfo(func_info->handle, i, &input_paraminfo);
+        const TA_InputParameterInfo *input_paraminfo = layout->inputs[i];
 
         // Check the input parameter type
         switch (input_paraminfo->type) {
 
             // Input parameter price type is needed
             case TA_Input_Price:
-                
-                // Check if the parameter info requires open price
-                if (input_paraminfo->flags & TA_IN_PRICE_OPEN) {
-                    
-                    // Check if the price object has open prices
-                    if (!HasOwnProperty(executeParameter, New<String>("open").ToLocalChecked()).FromJust()) {
-                        
-                        // Clear parameter holder memory
-                        TA_ParamHolderFree(func_params);
-
-                        // Clear values memory
-                        delete[] garbage;
-                        
-                        // Return internal error
-                        REPORT_INTERNAL_ERROR(cb, "First argument must contain 'open' field");
-                        return;
-                        
-                    }
-                    
-                    // Get the open prices
-                    open = V8_TO_DOUBLE_ARRAY(Local<Array>::Cast(Get(executeParameter, New<String>("open").ToLocalChecked()).ToLocalChecked()));
-                    garbage[garbage_count++] = open;
-                }
-                
-                // Check if the parameter info requires high price
-                if (input_paraminfo->flags & TA_IN_PRICE_HIGH) {
-                    
-                    // Check if the price object has high prices
-                    if (!HasOwnProperty(executeParameter, New<String>("high").ToLocalChecked()).FromJust()) {
-                        
-                        // Clear parameter holder memory
-                        TA_ParamHolderFree(func_params);
-
-                        // Clear values memory
-                        delete[] garbage;
-                        if (open)
-                            delete[] open;
-                        
-                        // Return internal error
-                        REPORT_INTERNAL_ERROR(cb, "First argument must contain 'high' field");
-                        return;
-                        
-                    }
-                    
-                    // Get the high prices
-                    high = V8_TO_DOUBLE_ARRAY(Local<Array>::Cast(Get(executeParameter, New<String>("high").ToLocalChecked()).ToLocalChecked()));
-                    garbage[garbage_count++] = high;
 
-                }
-                
-                // Check if the parameter info requires low price
-                if (input_paraminfo->flags & TA_IN_PRICE_LOW) {
-                    
-                    // Check if the price object has low prices
-                    if (!HasOwnProperty(executeParameter, New<String>("low").ToLocalChecked()).FromJust()) {
-                        
-                        // Clear parameter holder memory
-                        TA_ParamHolderFree(func_params);
-                        
-                        // Clear values memory
-                        delete[] garbage;
-                        if (open)
-                            delete[] open;
-                        if (high)
-                            delete[] high;
-                        
-                        // Return internal error
-                        REPORT_INTERNAL_ERROR(cb, "First argument must contain 'low' field");
-                        return;
-                        
-                    }
-                    
-                    // Get the low prices
-                    low = V8_TO_DOUBLE_ARRAY(Local<Array>::Cast(Get(executeParameter, New<String>("low").ToLocalChecked()).ToLocalChecked()));
-                    garbage[garbage_count++] = low;
-                    
-                }
-                
-                // Check if the parameter info requires close price
-                if (input_paraminfo->flags & TA_IN_PRICE_CLOSE) {
-                    
-                    // Check if the price object has close prices
-                    if (!HasOwnProperty(executeParameter, New<String>("close").ToLocalChecked()).FromJust()) {
-                        
-                        // Clear parameter holder memory
-                        TA_ParamHolderFree(func_params);
-                        
-                        // Clear values memory
-                        delete[] garbage;
-                        if (open)
-                            delete[] open;
-                        if (low)
-                            delete[] low;
-                        if (high)
-                            delete[] high;
-                        
-                        // Return internal error
-                        REPORT_INTERNAL_ERROR(cb, "First argument must contain 'close' field");
-                        return;
-                        
+                // Float32Array prices are given to the single precision function
+                if (single) {
+
+                    for (int p=0; p < 6; p++) {
+                        pricesS[p] = NULL;
+                        if ((input_paraminfo->flags & price_fields[p].flag) && (pricesS[p] = GET_INPUT_FLOAT_ARRAY(parameter, price_fields[p].name, wo, pinned, error)) == NULL)
+                            return false;
                     }
-                    
-                    // Get the close prices
-                    close = V8_TO_DOUBLE_ARRAY(Local<Array>::Cast(Get(executeParameter, New<String>("close").ToLocalChecked()).ToLocalChecked()));
-                    garbage[garbage_count++] = close;
-                    
-                }
-                
-                // Check if the parameter info requires volume
-                if (input_paraminfo->flags & TA_IN_PRICE_VOLUME) {
-                    
-                    // Check if the price object has volume
-                    if (!HasOwnProperty(executeParameter, New<String>("volume").ToLocalChecked()).FromJust()) {
-                        
-                        // Clear parameter holder memory
-                        TA_ParamHolderFree(func_params);
-
-                        // Clear values memory
-                        delete[] garbage;
-                        if (open)
-                            delete[] open;
-                        if (close)
-                            delete[] close;
-                        if (low)
-                            delete[] low;
-                        if (high)
-                            delete[] high;
-                        
-                        // Return internal error
-                        REPORT_INTERNAL_ERROR(cb, "First argument must contain 'volume' field");
-                        return;
-                        
+
+                    if ((retCode = TA_SetInputParamSinglePricePtr(wo->func_params, i, pricesS[0], pricesS[1], pricesS[2], pricesS[3], pricesS[4], pricesS[5])) != TA_SUCCESS) {
+                        error = TA_ERROR_STRING(retCode);
+                        return false;
                     }
-                    
-                    // Get the volume
-                    volume = V8_TO_DOUBLE_ARRAY(Local<Array>::Cast(Get(executeParameter, New<String>("volume").ToLocalChecked()).ToLocalChecked()));
-                    garbage[garbage_count++] = volume;
-                    
+
+                    break;
                 }
-                
-                // Check if the parameter info requires open interest values
-                if (input_paraminfo->flags & TA_IN_PRICE_OPENINTEREST) {
-                    
-                    // Check if the price object has open interest values
-                    if (!HasOwnProperty(executeParameter, New<String>("openInterest").ToLocalChecked()).FromJust()) {
-                        
-                        // Clear parameter holder memory
-                        TA_ParamHolderFree(func_params);
-                        
-                        // Clear values memory
-                        delete[] garbage;
-                        if (close)
-                            delete[] close;
-                        if (volume)
-                            delete[] volume;
-                        if (high)
-                            delete[] high;
-                        if (low)
-                            delete[] low;
-                        
-                        // Return internal error
-                        REPORT_INTERNAL_ERROR(cb, "First argument must contain 'openInterest' field");
-                        return;
-                        
-                    }
-                    
-                    // Get the open interest values
-                    openInterest = V8_TO_DOUBLE_ARRAY(Local<Array>::Cast(Get(executeParameter, New<String>("openInterest").ToLocalChecked()).ToLocalChecked()));
-                    garbage[garbage_count++] = openInterest;
-                    
+
+                // Loop for all the price fields
+                for (int p=0; p < 6; p++) {
+
+                    prices[p] = NULL;
+
+                    // Check if the parameter info requires the price field
+                    if (!(input_paraminfo->flags & price_fields[p].flag))
+                        continue;
+
+                    // Get the price values
+                    if ((prices[p] = GET_INPUT_DOUBLE_ARRAY(parameter, price_fields[p].name, wo, pinned, error)) == NULL)
+                        return false;
+
                 }
                 
                 // Save the price parameters
-                if ((retCode = TA_SetInputParamPricePtr(func_params, i, open, high, low, close, volume, openInterest)) != TA_SUCCESS) {
-                    
-                    // Clear parameter holder memory
-                    TA_ParamHolderFree(func_params);
-                    
-                    // Return TA error
-                    REPORT_TA_ERROR(cb, retCode);
-                    return;
-                     
+                if ((retCode = TA_SetInputParamPricePtr(wo->func_params, i, prices[0], prices[1], prices[2], prices[3], prices[4], prices[5])) != TA_SUCCESS) {
+                    error = TA_ERROR_STRING(retCode);
+                    return false;
                 }
                 
                 break;
 
             // Input parameter real type is needed
             case TA_Input_Real:
-                
-                // Check if the input parameter object has real value
-                if (!HasOwnProperty(executeParameter, New<String>(input_paraminfo->paramName).ToLocalChecked()).FromJust()) {
-                    
-                    // Clear parameter holder memory
-                    TA_ParamHolderFree(func_params);
-                    
-                    // Return internal error
-                    REPORT_INTERNAL_ERROR(cb, ((std::string)("First argument must contain '") + (std::string)(input_paraminfo->paramName) + (std::string)("' field")).c_str());
-                    return;
-                    
+
+                // Float32Array values are given to the single precision function
+                if (single) {
+
+                    if ((inRealS = GET_INPUT_FLOAT_ARRAY(parameter, input_paraminfo->paramName, wo, pinned, error)) == NULL)
+                        return false;
+
+                    if ((retCode = TA_SetInputParamSingleRealPtr(wo->func_params, i, inRealS)) != TA_SUCCESS) {
+                        error = TA_ERROR_STRING(retCode);
+                        return false;
+                    }
+
+                    break;
                 }
                 
                 // Get the number parameter value
-                inRealList = V8_TO_DOUBLE_ARRAY(Local<Array>::Cast(Get(executeParameter, New<String>(input_paraminfo->paramName).ToLocalChecked()).ToLocalChecked()));
-                garbage[garbage_count++] = inRealList;
+                if ((inRealList = GET_INPUT_DOUBLE_ARRAY(parameter, input_paraminfo->paramName, wo, pinned, error)) == NULL)
+                    return false;
                  
                 // Save the number parameter
-                if ((retCode = TA_SetInputParamRealPtr(func_params, i, inRealList)) != TA_SUCCESS) {
-                    
-                    // Clear parameter holder memory
-                    TA_ParamHolderFree(func_params);
-                    
-                    // Return TA error
-                    REPORT_TA_ERROR(cb, retCode);
-                    return;
-                    
+                if ((retCode = TA_SetInputParamRealPtr(wo->func_params, i, inRealList)) != TA_SUCCESS) {
+                    error = TA_ERROR_STRING(retCode);
+                    return false;
                 }
                 
                 break;
@@ -905,30 +1258,18 @@ NAN_METHOD(Execute) {
             case TA_Input_Integer:
                 
                 // Check if the input parameter object has integer parameter
-                if (!HasOwnProperty(executeParameter, New<String>(input_paraminfo->paramName).ToLocalChecked()).FromJust()) {
-                    
-                    // Clear parameter holder memory
-                    TA_ParamHolderFree(func_params);
-                    
-                    // Return internal error
-                    REPORT_INTERNAL_ERROR(cb, ((std::string)("First argument must contain '") + (std::string)(input_paraminfo->paramName) + (std::string)("' field")).c_str());
-                    return;
-
+                if (!HasOwnProperty(parameter, New<String>(input_paraminfo->paramName).ToLocalChecked()).FromJust()) {
+                    error = (std::string)("First argument must contain '") + (std::string)(input_paraminfo->paramName) + (std::string)("' field");
+                    return false;
                 }
                 
                 // Get the integer parameter value
-                inInteger = Get(executeParameter, New<String>(input_paraminfo->paramName).ToLocalChecked()).ToLocalChecked()->IntegerValue(Nan::GetCurrentContext()).FromJust();
+                inInteger = Get(parameter, New<String>(input_paraminfo->paramName).ToLocalChecked()).ToLocalChecked()->IntegerValue(Nan::GetCurrentContext()).FromJust();
                 
                 // Save the integer parameter
-                if ((retCode = TA_SetInputParamIntegerPtr(func_params, i, &inInteger)) != TA_SUCCESS) {
-                    
-                    // Clear parameter holder memory
-                    TA_ParamHolderFree(func_params);
-                    
-                    // Return TA error
-                    REPORT_TA_ERROR(cb, retCode);
-                    return;
-                    
+                if ((retCode = TA_SetInputParamIntegerPtr(wo->func_params, i, &inInteger)) != TA_SUCCESS) {
+                    error = TA_ERROR_STRING(retCode);
+                    return false;
                 }
                 
                 break;
@@ -937,23 +1278,26 @@ NAN_METHOD(Execute) {
 
     }
 
+    return true;
+}
+
+static bool READ_OPT_INPUTS(Local<Object> parameter, const func_layout *layout, std::vector<opt_value> &values, std::string &error) {
+
     // Loop for all the optional input parameters
-    for (int i=0; i < (int)func_info->nbOptInput; i++) {
+    values.resize(layout->optInputs.size());
+    for (int i=0; i < (int)layout->optInputs.size(); i++) {
         
         // Get the optional input parameter information
-        TA_GetOptInputParameterInfo(func_info->handle, i, &opt_paraminfo);
+        const TA_OptInputParameterInfo *opt_paraminfo = layout->optInputs[i];
         
         // Check if the optional parameter object has real value
-        if (!HasOwnProperty(executeParameter, New<String>(opt_paraminfo->paramName).ToLocalChecked()).FromJust()) {
-            
-            // Clear parameter holder memory
-            TA_ParamHolderFree(func_params);
-            
-            // Return internal error
-            REPORT_INTERNAL_ERROR(cb, ((std::string)("First argument must contain '") + (std::string)(opt_paraminfo->paramName) + (std::string)("' field")).c_str());
-            return;
-
+        if (!HasOwnProperty(parameter, New<String>(opt_paraminfo->paramName).ToLocalChecked()).FromJust()) {
+            error = (std::string)("First argument must contain '") + (std::string)(opt_paraminfo->paramName) + (std::string)("' field");
+            return false;
         }
+
+        // Get the optional parameter value
+        Local<Value> value = Get(parameter, New<String>(opt_paraminfo->paramName).ToLocalChecked()).ToLocalChecked();
         
         // Check the optional input parameter type
         switch (opt_paraminfo->type) {
@@ -961,73 +1305,118 @@ NAN_METHOD(Execute) {
             case TA_OptInput_RealRange:
             case TA_OptInput_RealList:
                 
-                // Get the integer parameter value
-                inReal = Get(executeParameter, New<String>(opt_paraminfo->paramName).ToLocalChecked()).ToLocalChecked()->NumberValue(Nan::GetCurrentContext()).FromJust();
-                
-                // Save the integer parameter
-                if ((retCode = TA_SetOptInputParamReal(func_params, i, inReal)) != TA_SUCCESS) {
-                    
-                    // Clear parameter holder memory
-                    TA_ParamHolderFree(func_params);
-                    
-                    // Return TA error
-                    REPORT_TA_ERROR(cb, retCode);
-                    return;
-                    
-                }
+                // Get the real parameter value
+                values[i].real = value->NumberValue(Nan::GetCurrentContext()).FromJust();
                 
                 break;
             case TA_OptInput_IntegerRange:
             case TA_OptInput_IntegerList:
                 
                 // Get the integer parameter value
-                inInteger = Get(executeParameter, New<String>(opt_paraminfo->paramName).ToLocalChecked()).ToLocalChecked()->IntegerValue(Nan::GetCurrentContext()).FromJust();
+                values[i].integer = value->IntegerValue(Nan::GetCurrentContext()).FromJust();
+                
+                break;
+                
+        }
+        
+    }
+
+    return true;
+}
+
+static bool BIND_OPT_INPUTS(const func_layout *layout, const std::vector<opt_value> &values, TA_ParamHolder *func_params, std::string &error) {
+
+    // Return code
+    TA_RetCode retCode = TA_SUCCESS;
+
+    // Loop for all the optional input parameters
+    for (int i=0; i < (int)layout->optInputs.size(); i++) {
+
+        // Check the optional input parameter type
+        switch (layout->optInputs[i]->type) {
+                
+            case TA_OptInput_RealRange:
+            case TA_OptInput_RealList:
+                
+                // Save the real parameter
+                retCode = TA_SetOptInputParamReal(func_params, i, values[i].real);
+                
+                break;
+            case TA_OptInput_IntegerRange:
+            case TA_OptInput_IntegerList:
                 
                 // Save the integer parameter
-                if ((retCode = TA_SetOptInputParamInteger(func_params, i, inInteger)) != TA_SUCCESS) {
-                    
-                    // Clear parameter holder memory
-                    TA_ParamHolderFree(func_params);
-                    
-                    // Return TA error
-                    REPORT_TA_ERROR(cb, retCode);
-                    return;
-                    
-                }
+                retCode = TA_SetOptInputParamInteger(func_params, i, values[i].integer);
                 
                 break;
                 
         }
+
+        // Check for error
+        if (retCode != TA_SUCCESS) {
+            error = TA_ERROR_STRING(retCode);
+            return false;
+        }
         
     }
 
-    // Setup the work object
-    work_object *wo = new work_object();
-    wo->func_handle = (TA_FuncHandle *)func_handle;
-    wo->startIdx = startIdx;
-    wo->endIdx = endIdx;
-    wo->nbOutput = func_info->nbOutput;
-    wo->func_params = func_params;
-    wo->outReal = new double*[func_info->nbOutput];
-    wo->outInt = new int*[func_info->nbOutput];
-    wo->garbage = garbage;
-    wo->garbage_count = garbage_count;
+    return true;
+}
+
+static bool OPT_VALUE_IN_RANGE(const TA_OptInputParameterInfo *opt_paraminfo, const opt_value &value) {
+
+    // Check a value against the limits of a range optional input, the functions only check them when called
+    if (opt_paraminfo->type == TA_OptInput_IntegerRange)
+        return value.integer >= ((const TA_IntegerRange *)opt_paraminfo->dataSet)->min &&
+               value.integer <= ((const TA_IntegerRange *)opt_paraminfo->dataSet)->max;
+    if (opt_paraminfo->type == TA_OptInput_RealRange)
+        return value.real >= ((const TA_RealRange *)opt_paraminfo->dataSet)->min &&
+               value.real <= ((const TA_RealRange *)opt_paraminfo->dataSet)->max;
+
+    return true;
+}
+
+static bool BIND_OUTPUTS(const func_layout *layout, const execute_options *options, int lookback, work_object *wo, Local<Array> pinned, std::string &error) {
+
+    // Determine the number of results, the first lookback elements of the range are never written
+    int outputLength = options->endIdx - (options->startIdx > lookback ? options->startIdx : lookback) + 1;
+    if (outputLength < 0)
+        outputLength = 0;
+
+    // Setup the output arrays
+    wo->typedOutput = options->typedOutput;
+    wo->callerOutput = options->callerOutput;
+    wo->nbOutput = layout->outputs.size();
     
     // Loop for all the ouput parameters
     for (int i=0; i < wo->nbOutput; i++) {
-        
-        // Allocate memory
-        wo->outReal[i] = new double[endIdx-startIdx+1];
-        wo->outInt[i] = new int[endIdx-startIdx+1];
-        
-        // Clear output results memory
-        for (int x=0; x < (endIdx-startIdx+1); x++) {
-            wo->outReal[i][x] = 0;
-            wo->outInt[i][x] = 0;
-        }
-        
+
         // Get the output parameter information
-        TA_GetOutputParameterInfo(func_info->handle, i, &output_paraminfo);
+        const TA_OutputParameterInfo *output_paraminfo = layout->outputs[i];
+
+        // Use the caller provided output arrays
+        if (options->callerOutput) {
+
+            // Get the output array memory
+            void *output = GET_OUTPUT_ARRAY(options->outputs, output_paraminfo, outputLength, pinned, error);
+            if (output == NULL)
+                return false;
+
+            // Assign the output parameter memory
+            if (output_paraminfo->type == TA_Output_Real)
+                TA_SetOutputParamRealPtr(wo->func_params, i, (double *)output);
+            else
+                TA_SetOutputParamIntegerPtr(wo->func_params, i, (int *)output);
+            wo->outputs.push_back(output);
+
+            continue;
+        }
+
+        // Allocate the output array pointers
+        if (wo->outReal == NULL) {
+            wo->outReal = new double*[wo->nbOutput]();
+            wo->outInt = new int*[wo->nbOutput]();
+        }
         
         // Check the output parameter type
         switch(output_paraminfo->type) {
@@ -1035,16 +1424,20 @@ NAN_METHOD(Execute) {
             // Output parameter type real is needed
             case TA_Output_Real:
                 
-                // Assign the real parameter memory
-                TA_SetOutputParamRealPtr(func_params, i, &wo->outReal[i][0]);
+                // Allocate and assign the real parameter memory
+                wo->outReal[i] = new double[outputLength];
+                TA_SetOutputParamRealPtr(wo->func_params, i, wo->outReal[i]);
+                wo->outputs.push_back(wo->outReal[i]);
                 
                 break;
             
             // Output parameter type integer is needed
             case TA_Output_Integer:
                 
-                // Assign the integer parameter memory
-                TA_SetOutputParamIntegerPtr(func_params, i, &wo->outInt[i][0]);
+                // Allocate and assign the integer parameter memory
+                wo->outInt[i] = new int[outputLength];
+                TA_SetOutputParamIntegerPtr(wo->func_params, i, wo->outInt[i]);
+                wo->outputs.push_back(wo->outInt[i]);
                 
                 break;
                 
@@ -1052,45 +1445,5397 @@ NAN_METHOD(Execute) {
         
     }
 
-    if (isSync) {
-        wo->retCode = TA_CallFunc((const TA_ParamHolder *)wo->func_params, wo->startIdx, wo->endIdx, &wo->outBegIdx, &wo->outNBElement);
-        info.GetReturnValue().Set(generateResult(wo));
-        for (int i=0; i < wo->garbage_count; i++) {
-            delete[] wo->garbage[i];
+    return true;
+}
+
+static void RUN_WORK_OBJECT(work_object *wo, Callback *cb, Local<Array> pinned, Nan::ReturnValue<Value> returnValue) {
+
+    // Execute synchronously and return the result
+    if (cb == NULL) {
+        CALL_WORK_OBJECT(wo);
+        returnValue.Set(generateResult(wo));
+        DISPOSE_WORK_OBJECT(wo);
+        return;
+    }
+
+    // Queue the work, keeping the input and output arrays referenced until it completes
+    ExecuteWorker *worker = new ExecuteWorker(cb, wo);
+    worker->SaveToPersistent("inputs", pinned);
+    AsyncQueueWorker(worker);
+
+}
+
+static TA_RetCode CONTEXT_LOOKBACK(TA_Context *context, const TA_ParamHolder *func_params, TA_Integer *lookback) {
+
+    // Compute the lookback with the settings the function will be called with
+    TA_Context *previous = TA_GetThreadContext();
+    if (context)
+        TA_SetThreadContext(context);
+    TA_RetCode retCode = TA_GetLookback(func_params, lookback);
+    TA_SetThreadContext(previous);
+
+    return retCode;
+}
+
+static bool READ_CONTEXT(Local<Object> parameter, bool snapshot, TA_Context **context, std::string &error) {
+
+    // Settings context field
+    Local<String> contextKey = New<String>("context").ToLocalChecked();
+    Local<Value> contextValue = Nan::Undefined();
+
+    *context = NULL;
+
+    // Retreive the settings context field
+    if (HasOwnProperty(parameter, contextKey).FromJust())
+        contextValue = Get(parameter, contextKey).ToLocalChecked();
+
+    if (!contextValue->IsUndefined() && !contextValue->IsObject()) {
+        error = "'context' must be an Object";
+        return false;
+    }
+
+    // Calls without overrides run with the process settings unless a snapshot is requested
+    if (contextValue->IsUndefined() && !snapshot)
+        return true;
+
+    // Copy the settings of the calling thread
+    TA_RetCode retCode;
+    if ((retCode = TA_ContextAlloc(context)) != TA_SUCCESS) {
+        error = TA_ERROR_STRING(retCode);
+        return false;
+    }
+
+    if (contextValue->IsUndefined())
+        return true;
+
+    Local<Object> contextObject = contextValue.As<Object>();
+    Local<String> unstableKey = New<String>("unstablePeriod").ToLocalChecked();
+    Local<String> compatibilityKey = New<String>("compatibility").ToLocalChecked();
+    Local<String> candleKey = New<String>("candleSettings").ToLocalChecked();
+
+    // Apply the overrides to the copied settings
+    TA_Context *previous = TA_GetThreadContext();
+    TA_SetThreadContext(*context);
+
+    // Unstable periods keyed by function name or unstable id name
+    if (error.empty() && HasOwnProperty(contextObject, unstableKey).FromJust()) {
+        Local<Value> unstableValue = Get(contextObject, unstableKey).ToLocalChecked();
+        if (!unstableValue->IsObject()) {
+            error = "'context.unstablePeriod' must be an Object";
+        } else {
+            Local<Object> unstableObject = unstableValue.As<Object>();
+            Local<Array> keys = Nan::GetOwnPropertyNames(unstableObject).ToLocalChecked();
+            for (uint32_t i=0; i < keys->Length() && error.empty(); i++) {
+                Local<Value> key = Get(keys, i).ToLocalChecked();
+                Local<Value> value = Get(unstableObject, key).ToLocalChecked();
+                Utf8String keyName(key);
+                std::string name = *keyName;
+                if (name.compare(0, 13, "TA_FUNC_UNST_") != 0)
+                    name = "TA_FUNC_UNST_" + name;
+                size_t j = 0;
+                while (j < sizeof(unstable_ids) / sizeof(unstable_ids[0]) && name != unstable_ids[j].name)
+                    j++;
+                if (j == sizeof(unstable_ids) / sizeof(unstable_ids[0]) || unstable_ids[j].id == TA_FUNC_UNST_NONE) {
+                    error = (std::string)("'context.unstablePeriod' has no function ") + *keyName;
+                } else if (!value->IsNumber() || value->NumberValue(Nan::GetCurrentContext()).FromJust() < 0) {
+                    error = (std::string)("'context.unstablePeriod.") + *keyName + "' must be a positive Integer";
+                } else if ((retCode = TA_SetUnstablePeriod(unstable_ids[j].id, value->Uint32Value(Nan::GetCurrentContext()).FromJust())) != TA_SUCCESS) {
+                    error = TA_ERROR_STRING(retCode);
+                }
+            }
         }
-        delete[] wo->garbage;
-        TA_ParamHolderFree(wo->func_params);
-        for (int i=0; i < wo->nbOutput; i++) {
-            delete wo->outReal[i];
-            delete wo->outInt[i];
+    }
+
+    // Compatibility mode
+    if (error.empty() && HasOwnProperty(contextObject, compatibilityKey).FromJust()) {
+        Local<Value> compatibilityValue = Get(contextObject, compatibilityKey).ToLocalChecked();
+        Utf8String compatibilityName(compatibilityValue);
+        std::string compatibility = *compatibilityName;
+        if (compatibility == "default" || compatibility == "0") {
+            TA_SetCompatibility(TA_COMPATIBILITY_DEFAULT);
+        } else if (compatibility == "metastock" || compatibility == "1") {
+            TA_SetCompatibility(TA_COMPATIBILITY_METASTOCK);
+        } else {
+            error = "'context.compatibility' must be 'default' or 'metastock'";
         }
-        delete wo->outReal;
-        delete wo->outInt;
-        delete wo;
-        return;
     }
 
-    // Queue the work
-    AsyncQueueWorker(new ExecuteWorker(cb, wo));
-    return;
+    // Candle settings keyed by setting name
+    if (error.empty() && HasOwnProperty(contextObject, candleKey).FromJust()) {
+        Local<Value> candleValue = Get(contextObject, candleKey).ToLocalChecked();
+        if (!candleValue->IsObject()) {
+            error = "'context.candleSettings' must be an Object";
+        } else {
+            Local<Object> candleObject = candleValue.As<Object>();
+            Local<Array> keys = Nan::GetOwnPropertyNames(candleObject).ToLocalChecked();
+            for (uint32_t i=0; i < keys->Length() && error.empty(); i++) {
+                Local<Value> key = Get(keys, i).ToLocalChecked();
+                Local<Value> value = Get(candleObject, key).ToLocalChecked();
+                Utf8String keyName(key);
+                size_t j = 0;
+                while (j < sizeof(candle_settings) / sizeof(candle_settings[0]) && strcmp(*keyName, candle_settings[j].name) != 0)
+                    j++;
+                if (j == sizeof(candle_settings) / sizeof(candle_settings[0])) {
+                    error = (std::string)("'context.candleSettings' has no setting ") + *keyName;
+                    break;
+                }
+                Local<Value> rangeType, avgPeriod, factor;
+                if (value->IsObject()) {
+                    rangeType = Get(value.As<Object>(), New<String>("rangeType").ToLocalChecked()).ToLocalChecked();
+                    avgPeriod = Get(value.As<Object>(), New<String>("avgPeriod").ToLocalChecked()).ToLocalChecked();
+                    factor = Get(value.As<Object>(), New<String>("factor").ToLocalChecked()).ToLocalChecked();
+                }
+                if (!value->IsObject() || !rangeType->IsString() || !avgPeriod->IsNumber() || !factor->IsNumber()) {
+                    error = (std::string)("'context.candleSettings.") + *keyName + "' must be an Object with fields rangeType, avgPeriod and factor";
+                    break;
+                }
+                Utf8String rangeName(rangeType);
+                size_t k = 0;
+                while (k < sizeof(range_types) / sizeof(range_types[0]) && strcmp(*rangeName, range_types[k].name) != 0)
+                    k++;
+                if (k == sizeof(range_types) / sizeof(range_types[0])) {
+                    error = (std::string)("'context.candleSettings.") + *keyName + ".rangeType' must be 'RealBody', 'HighLow' or 'Shadows'";
+                } else if ((retCode = TA_SetCandleSettings(candle_settings[j].type, range_types[k].type,
+                                                           avgPeriod->Int32Value(Nan::GetCurrentContext()).FromJust(),
+                                                           factor->NumberValue(Nan::GetCurrentContext()).FromJust())) != TA_SUCCESS) {
+                    error = TA_ERROR_STRING(retCode);
+                }
+            }
+        }
+    }
+
+    TA_SetThreadContext(previous);
+
+    // Release the copied settings on error
+    if (!error.empty()) {
+        TA_ContextFree(*context);
+        *context = NULL;
+        return false;
+    }
+
+    return true;
 }
 
-void Init(Local<Object> exports, Local<Context> context) {
+static work_object *CREATE_WORK_OBJECT(Local<Object> parameter, input_cache *cache, TA_Context *shared, bool snapshot, Local<Array> pinned, std::string &error) {
 
-    // Initialize the engine
-    TA_Initialize();
+    // Execution options
+    execute_options options;
 
-    // Define fields
-    Set(exports, New<String>("version").ToLocalChecked(), New<String>("1.1.6").ToLocalChecked());
+    // Function parameter layout
+    func_layout layout;
 
-    // Define accessors
-    SetAccessor(exports, New<String>("functions").ToLocalChecked(), Functions);
-    SetAccessor(exports, New<String>("functionUnstIds").ToLocalChecked(), FunctionUnstIds);
+    // Optional input parameter values
+    std::vector<opt_value> optValues;
 
-    // Define functions
-    Set(exports, New<String>("explain").ToLocalChecked(), GetFunction(New<FunctionTemplate>(Explain)).ToLocalChecked());
-    Set(exports, New<String>("execute").ToLocalChecked(), GetFunction(New<FunctionTemplate>(Execute)).ToLocalChecked());
-    Set(exports, New<String>("setUnstablePeriod").ToLocalChecked(), GetFunction(New<FunctionTemplate>(SetUnstablePeriod)).ToLocalChecked());
+    // Return code
+    TA_RetCode retCode;
+    
+    // Function parameter holder
+    TA_ParamHolder *func_params;
+
+    // Function lookback
+    int lookback = 0;
+
+    // Settings context
+    TA_Context *context = NULL;
+
+    // Check the function name parameter
+    if (!HasOwnProperty(parameter, New<String>("name").ToLocalChecked()).FromJust()) {
+        error = "First argument must contain 'name' field";
+        return NULL;
+    }
+
+    // Retreive the execution options
+    if (!READ_EXECUTE_OPTIONS(parameter, &options, error))
+        return NULL;
+
+    // Retreive the function parameter layout
+    if (!LOAD_FUNCTION_LAYOUT(Get(parameter, New<String>("name").ToLocalChecked()).ToLocalChecked(), &layout, error))
+        return NULL;
+
+    // Retreive the settings context, unless one is shared by the caller
+    if (shared == NULL && !READ_CONTEXT(parameter, snapshot, &context, error))
+        return NULL;
+
+    // Allocate parameter holder memory for function handle
+    if ((retCode = TA_ParamHolderAlloc(layout.func_handle, &func_params)) != TA_SUCCESS) {
+        TA_ContextFree(context);
+        error = TA_ERROR_STRING(retCode);
+        return NULL;
+    }
+
+    // Setup the work object
+    work_object *wo = new work_object();
+    wo->func_handle = (TA_FuncHandle *)layout.func_handle;
+    wo->startIdx = options.startIdx;
+    wo->endIdx = options.endIdx;
+    wo->func_params = func_params;
+    wo->inputCache = cache;
+    wo->context = shared ? shared : context;
+    wo->sharedContext = shared != NULL;
+
+    // Bind the inputs, the optional inputs and the outputs
+    if (!BIND_INPUTS(parameter, &layout, wo, pinned, error) ||
+        !READ_OPT_INPUTS(parameter, &layout, optValues, error) ||
+        !BIND_OPT_INPUTS(&layout, optValues, func_params, error) ||
+        ((retCode = CONTEXT_LOOKBACK(wo->context, func_params, &lookback)) != TA_SUCCESS && !(error = TA_ERROR_STRING(retCode)).empty()) ||
+        !BIND_OUTPUTS(&layout, &options, lookback, wo, pinned, error)) {
+
+        // Clear the work object
+        DISPOSE_WORK_OBJECT(wo);
+        return NULL;
+
+    }
+
+    // The input cache is only used while binding
+    wo->inputCache = NULL;
+
+    return wo;
+}
+
+NAN_METHOD(Execute) {
+
+    // Execution parameter
+    Local<Object> executeParameter;
+
+    // Callback function
+    Callback *cb = NULL;
+
+    // Input and output arrays referenced while the function is executed
+    Local<Array> pinned = New<Array>();
+
+    // Error message
+    std::string error;
+
+    // Check the arguments
+    if (info.Length() < 1) {
+        ThrowTypeError("argument required - Object");
+        return;
+    }
+
+    // Check the execution parameter
+    if (!info[0]->IsObject()) {
+        ThrowTypeError("First argument must be an Object with fields name, startIdx, endIdx and function input parameters");
+        return;
+    }
+    
+    // Get the execute parameter
+    executeParameter = info[0]->ToObject(Nan::GetCurrentContext()).FromMaybe(v8::Local<Object>());
+    
+    // Get the callback function
+    if (info[1]->IsFunction()) {
+        cb = new Callback(info[1].As<Function>());
+    }
+
+    // Setup the work object
+    work_object *wo = CREATE_WORK_OBJECT(executeParameter, NULL, NULL, cb != NULL, pinned, error);
+    if (wo == NULL) {
+        REPORT_INTERNAL_ERROR(cb, error.c_str());
+        return;
+    }
+
+    // Execute the function
+    RUN_WORK_OBJECT(wo, cb, pinned, info.GetReturnValue());
+}
+
+static void DISPOSE_BATCH_OBJECT(batch_object *batch) {
+
+    // Dispose the work objects
+    for (size_t i=0; i < batch->items.size(); i++) {
+        DISPOSE_WORK_OBJECT(batch->items[i]);
+    }
+
+    // Clear the shared input arrays
+    for (size_t i=0; i < batch->garbage.size(); i++) {
+        delete[] batch->garbage[i];
+    }
+
+    // Clear the shared settings context
+    TA_ContextFree(batch->context);
+
+    // Dispose batch object
+    delete batch;
+
+}
+
+static Local<Array> generateBatchResult(batch_object *batch) {
+
+    // Batch result array
+    Local<Array> results = New<Array>(batch->items.size());
+
+    // Store the result of every function in order
+    for (size_t i=0; i < batch->items.size(); i++) {
+        Set(results, i, generateResult(batch->items[i]));
+    }
+
+    return results;
+}
+
+// Zero threshold of the TA functions, reproduced by the shared graph and sweep kernels
+#define SWEEP_EPSILON (0.00000000000001)
+
+// Functions a graph computes from shared intermediates
+static const struct {
+    const char *name;
+    graph_function function;
+} graph_functions[] = {
+    { "TRANGE", GRAPH_TRANGE },
+    { "ATR", GRAPH_ATR },
+    { "NATR", GRAPH_NATR },
+    { "PLUS_DM", GRAPH_PLUS_DM },
+    { "MINUS_DM", GRAPH_MINUS_DM },
+    { "PLUS_DI", GRAPH_PLUS_DI },
+    { "MINUS_DI", GRAPH_MINUS_DI },
+    { "DX", GRAPH_DX },
+    { "ADX", GRAPH_ADX },
+    { "ADXR", GRAPH_ADXR },
+    { "RSI", GRAPH_RSI },
+    { "STOCHRSI", GRAPH_STOCHRSI }
+};
+
+static int GRAPH_NODE(batch_object *batch, graph_node_kind kind, const double *const *inputs, int period, int base, int first, int last, int parent, TA_Context *context) {
+
+    // Reuse the node computing the same intermediate, extending the bars it covers
+    for (size_t i=0; i < batch->nodes.size(); i++) {
+        graph_node &node = batch->nodes[i];
+        if (node.kind == kind && node.period == period && node.base == base && node.context == context &&
+            node.inputs[0] == inputs[0] && node.inputs[1] == inputs[1] && node.inputs[2] == inputs[2]) {
+            if (first < node.first)
+                node.first = first;
+            if (last > node.last)
+                node.last = last;
+            return i;
+        }
+    }
+
+    // Add the node after the one it is computed from, so the nodes are evaluated in order
+    graph_node node;
+    node.kind = kind;
+    for (int i=0; i < 3; i++)
+        node.inputs[i] = inputs[i];
+    node.period = period;
+    node.base = base;
+    node.first = first;
+    node.last = last;
+    node.parent = parent;
+    node.context = context;
+    for (int i=0; i < 3; i++)
+        node.values[i] = NULL;
+    batch->nodes.push_back(node);
+
+    return batch->nodes.size() - 1;
+}
+
+static void GRAPH_PLAN(batch_object *batch, Local<Object> parameter, work_object *wo, input_cache *cache, Local<Array> pinned) {
+
+    // Function of the graph, called directly unless it reads a shared intermediate
+    graph_item item = graph_item();
+    item.function = GRAPH_DIRECT;
+    item.node = -1;
+    batch->graphItems.push_back(item);
+
+    // Find the function
+    const TA_FuncInfo *func_info;
+    if (TA_GetFuncInfo(wo->func_handle, &func_info) != TA_SUCCESS)
+        return;
+    graph_function function = GRAPH_DIRECT;
+    for (size_t i=0; i < sizeof(graph_functions) / sizeof(graph_functions[0]); i++) {
+        if (strcmp(graph_functions[i].name, func_info->name) == 0)
+            function = graph_functions[i].function;
+    }
+    if (function == GRAPH_DIRECT)
+        return;
+
+    // Retreive the optional inputs and the lookback the function is called with
+    func_layout layout;
+    std::string error;
+    TA_Integer lookback;
+    if (!LOAD_FUNCTION_LAYOUT(New<String>(func_info->name).ToLocalChecked(), &layout, error) ||
+        !READ_OPT_INPUTS(parameter, &layout, item.optValues, error) ||
+        CONTEXT_LOOKBACK(wo->context, wo->func_params, &lookback) != TA_SUCCESS)
+        return;
+    item.period = item.optValues.empty() ? 0 : item.optValues[0].integer;
+    item.startIdx = wo->startIdx > lookback ? wo->startIdx : lookback;
+    item.base = item.startIdx - lookback;
+    if (item.startIdx > wo->endIdx)
+        return;
+
+    // The inputs must be double arrays, single precision inputs are left to the TA_S functions
+    bool price = function != GRAPH_RSI && function != GRAPH_STOCHRSI;
+    const char *names[3] = { "high", "low", "close" };
+    const double *inputs[3] = { NULL, NULL, NULL };
+    if (!price)
+        names[0] = layout.inputs[0]->paramName;
+    wo->inputCache = cache;
+    for (int i=0; i < (price ? 3 : 1); i++) {
+        if (Get(parameter, New<String>(names[i]).ToLocalChecked()).ToLocalChecked()->IsFloat32Array() ||
+            (inputs[i] = GET_INPUT_DOUBLE_ARRAY(parameter, names[i], wo, pinned, error)) == NULL)
+            break;
+    }
+    wo->inputCache = NULL;
+    if (inputs[price ? 2 : 0] == NULL)
+        return;
+    item.close = inputs[2];
+
+    // Intermediates of the function, TRANGE is shared by the true range and directional movement functions
+    int period = item.period;
+    int base = item.base;
+    int endIdx = wo->endIdx;
+    int node;
+    switch (function) {
+        case GRAPH_TRANGE:
+            item.node = GRAPH_NODE(batch, GRAPH_NODE_TRANGE, inputs, 0, 0, item.startIdx, endIdx, -1, NULL);
+            break;
+        case GRAPH_ATR:
+        case GRAPH_NATR:
+            if (period <= 1) {
+                function = GRAPH_TRANGE;
+                item.node = GRAPH_NODE(batch, GRAPH_NODE_TRANGE, inputs, 0, 0, item.startIdx, endIdx, -1, NULL);
+                break;
+            }
+            node = GRAPH_NODE(batch, GRAPH_NODE_TRANGE, inputs, 0, 0, base + 1, endIdx, -1, NULL);
+            item.node = GRAPH_NODE(batch, GRAPH_NODE_ATR, inputs, period, base, base + period, endIdx, node, NULL);
+            break;
+        case GRAPH_PLUS_DM:
+        case GRAPH_MINUS_DM:
+        case GRAPH_PLUS_DI:
+        case GRAPH_MINUS_DI:
+        case GRAPH_DX:
+            if (period <= 1)
+                return;
+            node = GRAPH_NODE(batch, GRAPH_NODE_TRANGE, inputs, 0, 0, base + 1, endIdx, -1, NULL);
+            item.node = GRAPH_NODE(batch, GRAPH_NODE_DM, inputs, period, base, base + period - 1, endIdx, node, NULL);
+            break;
+        case GRAPH_ADX:
+        case GRAPH_ADXR:
+            if (period <= 1)
+                return;
+            node = GRAPH_NODE(batch, GRAPH_NODE_TRANGE, inputs, 0, 0, base + 1, endIdx, -1, NULL);
+            node = GRAPH_NODE(batch, GRAPH_NODE_DM, inputs, period, base, base + period - 1, endIdx, node, NULL);
+            item.node = GRAPH_NODE(batch, GRAPH_NODE_ADX, inputs, period, base, base + 2 * period - 1, endIdx, node, NULL);
+            break;
+        case GRAPH_RSI:
+        case GRAPH_STOCHRSI: {
+            // The RSI values depend on the settings context, STOCHRSI runs STOCHF over them
+            TA_Context *previous = TA_GetThreadContext();
+            if (wo->context)
+                TA_SetThreadContext(wo->context);
+            int rsiLookback = TA_RSI_Lookback(period);
+            TA_SetThreadContext(previous);
+            item.lookback = lookback - rsiLookback;
+            item.node = GRAPH_NODE(batch, GRAPH_NODE_RSI, inputs, period, base, base + rsiLookback, endIdx, -1, wo->context);
+            break;
+        }
+        default:
+            break;
+    }
+    item.function = function;
+    batch->graphItems.back() = item;
+
+}
+
+static void GRAPH_NODE_VALUES(batch_object *batch, graph_node *node) {
+
+    // Values of the node from its first to its last bar, unless a function output holds them
+    int period = node->period;
+    int count = node->last - node->first + 1;
+    for (int k=0; k < (node->kind == GRAPH_NODE_DM ? 3 : 1); k++) {
+        if (node->values[k] == NULL) {
+            node->values[k] = new double[count];
+            batch->garbage.push_back(node->values[k]);
+        }
+    }
+    const graph_node *parent = node->parent >= 0 ? &batch->nodes[node->parent] : NULL;
+    const double *high = node->inputs[0];
+    const double *low = node->inputs[1];
+    TA_Integer outBegIdx, outNBElement;
+
+    switch (node->kind) {
+
+        case GRAPH_NODE_TRANGE:
+
+            // True range of every bar
+            TA_TRANGE(node->first, node->last, high, low, node->inputs[2], &outBegIdx, &outNBElement, node->values[0]);
+            break;
+
+        case GRAPH_NODE_ATR: {
+
+            // Simple average of the first period, then smoothed the way TA_ATR does
+            const double *range = parent->values[0] - parent->first;
+            double *atr = node->values[0] - node->first;
+            double sum = 0.0;
+            for (int t=node->base + 1; t <= node->first; t++)
+                sum += range[t];
+            atr[node->first] = sum / period;
+            for (int t=node->first + 1; t <= node->last; t++) {
+                double value = atr[t - 1];
+                value *= period - 1;
+                value += range[t];
+                value /= period;
+                atr[t] = value;
+            }
+            break;
+        }
+
+        case GRAPH_NODE_DM: {
+
+            // Sums of the first period - 1 bars, then smoothed the way the directional functions do
+            const double *range = parent->values[0] - parent->first;
+            double *plusDM = node->values[0] - node->first;
+            double *minusDM = node->values[1] - node->first;
+            double *sumTR = node->values[2] - node->first;
+            double prevPlusDM = 0.0, prevMinusDM = 0.0, prevTR = 0.0;
+            for (int t=node->base + 1; t <= node->last; t++) {
+                double diffP = high[t] - high[t - 1];
+                double diffM = low[t - 1] - low[t];
+                if (t >= node->base + period) {
+                    prevMinusDM -= prevMinusDM / period;
+                    prevPlusDM -= prevPlusDM / period;
+                    prevTR = prevTR - (prevTR / period) + range[t];
+                } else {
+                    prevTR += range[t];
+                }
+                if ((diffM > 0) && (diffP < diffM))
+                    prevMinusDM += diffM;
+                else if ((diffP > 0) && (diffP > diffM))
+                    prevPlusDM += diffP;
+                if (t >= node->first) {
+                    plusDM[t] = prevPlusDM;
+                    minusDM[t] = prevMinusDM;
+                    sumTR[t] = prevTR;
+                }
+            }
+            break;
+        }
+
+        case GRAPH_NODE_ADX: {
+
+            // Average DX of the first period, then smoothed the way TA_ADX does
+            const double *plusDM = parent->values[0] - parent->first;
+            const double *minusDM = parent->values[1] - parent->first;
+            const double *sumTR = parent->values[2] - parent->first;
+            double *adx = node->values[0] - node->first;
+            double sumDX = 0.0, prevADX = 0.0;
+            for (int t=node->base + period; t <= node->last; t++) {
+                bool defined = false;
+                double dx = 0.0;
+                if (!(-SWEEP_EPSILON < sumTR[t] && sumTR[t] < SWEEP_EPSILON)) {
+                    double minusDI = 100.0 * (minusDM[t] / sumTR[t]);
+                    double plusDI = 100.0 * (plusDM[t] / sumTR[t]);
+                    double total = minusDI + plusDI;
+                    if (!(-SWEEP_EPSILON < total && total < SWEEP_EPSILON)) {
+                        dx = 100.0 * (std::fabs(minusDI - plusDI) / total);
+                        defined = true;
+                    }
+                }
+                if (t < node->first) {
+                    if (defined)
+                        sumDX += dx;
+                    continue;
+                }
+                if (t == node->first) {
+                    if (defined)
+                        sumDX += dx;
+                    prevADX = sumDX / period;
+                } else if (defined) {
+                    prevADX = ((prevADX * (period - 1)) + dx) / period;
+                }
+                adx[t] = prevADX;
+            }
+            break;
+        }
+
+        case GRAPH_NODE_RSI: {
+
+            // The RSI is only shared, it is computed by TA_RSI with the settings of its functions
+            TA_Context *previous = TA_GetThreadContext();
+            if (node->context)
+                TA_SetThreadContext(node->context);
+            TA_RSI(node->first, node->last, high, period, &outBegIdx, &outNBElement, node->values[0]);
+            TA_SetThreadContext(previous);
+            break;
+        }
+
+    }
+
+}
+
+// Component of the node a function outputs unchanged, -1 when the output is computed from it
+static int GRAPH_ITEM_COPY(graph_function function) {
+    switch (function) {
+        case GRAPH_TRANGE:
+        case GRAPH_ATR:
+        case GRAPH_PLUS_DM:
+        case GRAPH_ADX:
+        case GRAPH_RSI:
+            return 0;
+        case GRAPH_MINUS_DM:
+            return 1;
+        default:
+            return -1;
+    }
+}
+
+static void GRAPH_ITEM_VALUES(batch_object *batch, const graph_item *item, work_object *wo) {
+
+    // Intermediate of the function by bar
+    const graph_node *node = &batch->nodes[item->node];
+    const double *values[3] = { NULL, NULL, NULL };
+    for (int k=0; k < 3; k++) {
+        if (node->values[k] != NULL)
+            values[k] = node->values[k] - node->first;
+    }
+    int period = item->period;
+    int startIdx = item->startIdx;
+    int endIdx = wo->endIdx;
+    wo->retCode = TA_SUCCESS;
+    wo->outBegIdx = startIdx;
+    wo->outNBElement = endIdx - startIdx + 1;
+
+    // STOCHRSI runs STOCHF over the shared RSI values, from the first bar it reads
+    if (item->function == GRAPH_STOCHRSI) {
+        const double *rsi = values[0] + startIdx - item->lookback;
+        TA_Integer outBegIdx;
+        TA_Context *previous = TA_GetThreadContext();
+        if (wo->context)
+            TA_SetThreadContext(wo->context);
+        wo->retCode = TA_STOCHF(0, item->lookback + wo->outNBElement - 1, rsi, rsi, rsi,
+                                item->optValues[1].integer, item->optValues[2].integer, (TA_MAType)item->optValues[3].integer,
+                                &outBegIdx, &wo->outNBElement, (double *)wo->outputs[0], (double *)wo->outputs[1]);
+        TA_SetThreadContext(previous);
+        if (wo->retCode != TA_SUCCESS || wo->outNBElement == 0) {
+            wo->outBegIdx = 0;
+            wo->outNBElement = 0;
+        }
+        return;
+    }
+
+    // Output of every bar, with the arithmetic of the TA function
+    double *output = (double *)wo->outputs[0] - startIdx;
+    int copy = GRAPH_ITEM_COPY(item->function);
+    if (copy >= 0) {
+        if (output + startIdx != values[copy] + startIdx)
+            memcpy(output + startIdx, values[copy] + startIdx, wo->outNBElement * sizeof(double));
+        return;
+    }
+    switch (item->function) {
+        case GRAPH_NATR:
+            for (int t=startIdx; t <= endIdx; t++) {
+                // TA_NATR reads the close at the offset of the bar from the first bar it reads, and
+                // on a zero close zeroes its first output, leaving the current one unwritten
+                double close = item->close[t - item->base];
+                if (!(-SWEEP_EPSILON < close && close < SWEEP_EPSILON)) {
+                    output[t] = (values[0][t] / close) * 100.0;
+                } else {
+                    output[startIdx] = 0.0;
+                    output[t] = 0.0;
+                }
+            }
+            break;
+        case GRAPH_PLUS_DI:
+        case GRAPH_MINUS_DI: {
+            const double *dm = values[item->function == GRAPH_PLUS_DI ? 0 : 1];
+            for (int t=startIdx; t <= endIdx; t++) {
+                if (!(-SWEEP_EPSILON < values[2][t] && values[2][t] < SWEEP_EPSILON))
+                    output[t] = 100.0 * (dm[t] / values[2][t]);
+                else
+                    output[t] = 0.0;
+            }
+            break;
+        }
+        case GRAPH_DX: {
+            // The DX repeats its previous output when undefined, the first one is zero
+            double dx = 0.0;
+            for (int t=startIdx; t <= endIdx; t++) {
+                if (!(-SWEEP_EPSILON < values[2][t] && values[2][t] < SWEEP_EPSILON)) {
+                    double minusDI = 100.0 * (values[1][t] / values[2][t]);
+                    double plusDI = 100.0 * (values[0][t] / values[2][t]);
+                    double total = minusDI + plusDI;
+                    if (!(-SWEEP_EPSILON < total && total < SWEEP_EPSILON))
+                        dx = 100.0 * (std::fabs(minusDI - plusDI) / total);
+                }
+                output[t] = dx;
+            }
+            break;
+        }
+        case GRAPH_ADXR:
+            for (int t=startIdx; t <= endIdx; t++)
+                output[t] = (values[0][t] + values[0][t - (period - 1)]) / 2.0;
+            break;
+        default:
+            break;
+    }
+
+}
+
+static void CALL_BATCH_OBJECT(batch_object *batch) {
+
+    // Execute every function call of a batch
+    if (!batch->graph) {
+        for (size_t i=0; i < batch->items.size(); i++) {
+            CALL_WORK_OBJECT(batch->items[i]);
+        }
+        return;
+    }
+
+    // A function outputting a node unchanged over the same bars lends its output to hold the node values
+    for (size_t i=0; i < batch->items.size(); i++) {
+        const graph_item &item = batch->graphItems[i];
+        int copy = GRAPH_ITEM_COPY(item.function);
+        if (item.node < 0 || copy < 0)
+            continue;
+        graph_node &node = batch->nodes[item.node];
+        if (node.values[copy] == NULL && node.first == item.startIdx && node.last == batch->items[i]->endIdx)
+            node.values[copy] = (double *)batch->items[i]->outputs[0];
+    }
+
+    // Compute every intermediate of a graph once, then the functions from them
+    for (size_t i=0; i < batch->nodes.size(); i++) {
+        GRAPH_NODE_VALUES(batch, &batch->nodes[i]);
+    }
+    for (size_t i=0; i < batch->items.size(); i++) {
+        if (batch->graphItems[i].node < 0)
+            CALL_WORK_OBJECT(batch->items[i]);
+        else
+            GRAPH_ITEM_VALUES(batch, &batch->graphItems[i], batch->items[i]);
+    }
+
+}
+
+class BatchWorker : public AsyncWorker {
+ public:
+  BatchWorker(Callback *callback, batch_object *batch): AsyncWorker(callback), batch(batch) {}
+  ~BatchWorker() {
+
+    // Dispose the batch object
+    DISPOSE_BATCH_OBJECT(batch);
+
+  }
+
+  void Execute () {
+
+    // Execute all the function calls on this thread
+    CALL_BATCH_OBJECT(batch);
+
+  }
+
+  void HandleOKCallback () {
+    HandleScope scope;
+
+    // Result info
+    Local<Value> argv[2];
+
+    // Return the execution results
+    argv[0] = Nan::Null();
+    argv[1] = generateBatchResult(batch);
+    callback->Call(2, argv);
+
+  };
+
+ private:
+  batch_object *batch;
+};
+
+static Local<Object> MERGE_PARAMETERS(Local<Object> inputs, Local<Object> spec) {
+
+    // Merged parameter object
+    Local<Object> merged = New<Object>();
+
+    // Copy the shared inputs, then the function specific fields over them
+    Local<Object> sources[2] = { inputs, spec };
+    for (int s=0; s < 2; s++) {
+        Local<Array> keys = Nan::GetOwnPropertyNames(sources[s]).ToLocalChecked();
+        for (unsigned int i=0; i < keys->Length(); i++) {
+            Local<Value> key = Get(keys, i).ToLocalChecked();
+            Set(merged, key, Get(sources[s], key).ToLocalChecked());
+        }
+    }
+
+    return merged;
+}
+
+static void RUN_BATCH(const Nan::FunctionCallbackInfo<Value> &info, bool graph) {
+
+    // Shared inputs and function specifications
+    Local<Object> inputs;
+    Local<Array> specs;
+
+    // Callback function
+    Callback *cb = NULL;
+
+    // Input and output arrays referenced while the functions are executed
+    Local<Array> pinned = New<Array>();
+
+    // Arrays converted once for all the functions
+    input_cache cache;
+
+    // Error message
+    std::string error;
+
+    // Check the arguments
+    if (info.Length() < 2 || !info[0]->IsObject() || !info[1]->IsArray()) {
+        ThrowTypeError("Two arguments required - Object with the shared inputs, Array of function specifications");
+        return;
+    }
+    inputs = info[0].As<Object>();
+    specs = info[1].As<Array>();
+
+    // Get the callback function
+    if (info[2]->IsFunction()) {
+        cb = new Callback(info[2].As<Function>());
+    }
+
+    // Setup the batch object
+    batch_object *batch = new batch_object();
+    batch->graph = graph;
+
+    // Retreive the settings context shared by the functions
+    if (!READ_CONTEXT(inputs, cb != NULL, &batch->context, error)) {
+        DISPOSE_BATCH_OBJECT(batch);
+        REPORT_INTERNAL_ERROR(cb, error.c_str());
+        return;
+    }
+
+    // Loop for all the function specifications
+    for (unsigned int i=0; i < specs->Length(); i++) {
+
+        // Check the function specification
+        Local<Value> spec = Get(specs, i).ToLocalChecked();
+        if (!spec->IsObject()) {
+            error = "Function specifications must be Objects with field name and the function parameters";
+            break;
+        }
+
+        // Setup the work object of the function, a specification may carry its own settings context
+        TA_Context *shared = HasOwnProperty(spec.As<Object>(), New<String>("context").ToLocalChecked()).FromJust() ? NULL : batch->context;
+        Local<Object> parameter = MERGE_PARAMETERS(inputs, spec.As<Object>());
+        work_object *wo = CREATE_WORK_OBJECT(parameter, &cache, shared, cb != NULL, pinned, error);
+        if (wo == NULL) {
+            error = (std::string)("Function specification ") + std::to_string(i) + (std::string)(": ") + error;
+            break;
+        }
+        batch->items.push_back(wo);
+
+        // Find the intermediates the function shares with the previous ones
+        if (graph)
+            GRAPH_PLAN(batch, parameter, wo, &cache, pinned);
+
+    }
+
+    // The batch owns the converted input arrays
+    batch->garbage = cache.arrays;
+
+    // Check for error
+    if (!error.empty()) {
+        DISPOSE_BATCH_OBJECT(batch);
+        REPORT_INTERNAL_ERROR(cb, error.c_str());
+        return;
+    }
+
+    // Execute synchronously and return the results
+    if (cb == NULL) {
+        CALL_BATCH_OBJECT(batch);
+        info.GetReturnValue().Set(generateBatchResult(batch));
+        DISPOSE_BATCH_OBJECT(batch);
+        return;
+    }
+
+    // Queue the work, keeping the input and output arrays referenced until it completes
+    BatchWorker *worker = new BatchWorker(cb, batch);
+    worker->SaveToPersistent("inputs", pinned);
+    AsyncQueueWorker(worker);
+}
+
+NAN_METHOD(ExecuteBatch) {
+    RUN_BATCH(info, false);
+}
+
+NAN_METHOD(ExecuteGraph) {
+    RUN_BATCH(info, true);
+}
+
+// Kernels computing every column of a sweep from intermediates shared across the swept values
+enum sweep_kernel {
+    SWEEP_GENERIC,
+    SWEEP_SMA,
+    SWEEP_VAR,
+    SWEEP_STDDEV,
+    SWEEP_BBANDS,
+    SWEEP_RSI
+};
+
+// Async sweep object, one column of results per swept value
+struct sweep_object {
+    work_object *wo;
+    sweep_kernel kernel;
+    int sweepIndex;
+    bool sweepInteger;
+    std::vector<opt_value> values;
+    std::vector<opt_value> optValues;
+    std::vector<int> lookbacks;
+    std::vector<int> begIndexes;
+    std::vector<int> nbElements;
+    int begIdx;
+    int rows;
+    const double *inReal;
+};
+
+static void DISPOSE_SWEEP_OBJECT(sweep_object *sweep) {
+
+    // Dispose the work object holding the inputs and the result matrices
+    if (sweep->wo)
+        DISPOSE_WORK_OBJECT(sweep->wo);
+
+    // Dispose sweep object
+    delete sweep;
+
+}
+
+static void SWEEP_PREFIX_SUMS(const double *inReal, int count, bool squares, std::vector<double> &high, std::vector<double> &low) {
+
+    // Compensated prefix sums, the rounding error of every addition is accumulated in the low part
+    double sumHigh = 0.0, sumLow = 0.0;
+    high.resize(count + 1);
+    low.resize(count + 1);
+    high[0] = 0.0;
+    low[0] = 0.0;
+    for (int i=0; i < count; i++) {
+        double value = squares ? inReal[i] * inReal[i] : inReal[i];
+        double sum = sumHigh + value;
+        if (fabs(sumHigh) >= fabs(value))
+            sumLow += (sumHigh - sum) + value;
+        else
+            sumLow += (value - sum) + sumHigh;
+        sumHigh = sum;
+        high[i + 1] = sumHigh;
+        low[i + 1] = sumLow;
+    }
+
+}
+
+static void SWEEP_WINDOW_COLUMNS(sweep_object *sweep) {
+
+    // Work object holding the range and the result matrices
+    work_object *wo = sweep->wo;
+
+    // The shared sums and squares start at the first value of the earliest window in use
+    int base = wo->endIdx + 1;
+    for (size_t j=0; j < sweep->values.size(); j++) {
+        if (sweep->nbElements[j] > 0 && sweep->begIndexes[j] - sweep->values[j].integer + 1 < base)
+            base = sweep->begIndexes[j] - sweep->values[j].integer + 1;
+    }
+    if (base > wo->endIdx)
+        return;
+
+    // Sums of the values shared by every SMA period
+    std::vector<double> sumHigh, sumLow, squares;
+    if (sweep->kernel == SWEEP_SMA)
+        SWEEP_PREFIX_SUMS(sweep->inReal + base, wo->endIdx - base + 1, false, sumHigh, sumLow);
+
+    // Squares of the values shared by every period of the deviation functions
+    if (sweep->kernel != SWEEP_SMA) {
+        squares.resize(wo->endIdx - base + 1);
+        for (int t=base; t <= wo->endIdx; t++)
+            squares[t - base] = sweep->inReal[t] * sweep->inReal[t];
+    }
+
+    // Deviation multipliers of STDDEV and BBANDS
+    double nbDevUp = sweep->kernel == SWEEP_STDDEV ? sweep->optValues[1].real : 1.0;
+    double nbDevDn = 1.0;
+    if (sweep->kernel == SWEEP_BBANDS) {
+        nbDevUp = sweep->optValues[1].real;
+        nbDevDn = sweep->optValues[2].real;
+    }
+
+    // Loop for all the columns
+    for (size_t j=0; j < sweep->values.size(); j++) {
+
+        // Nothing to compute in the range for this period
+        if (sweep->nbElements[j] == 0)
+            continue;
+
+        int period = sweep->values[j].integer;
+        size_t offset = j * sweep->rows + (sweep->begIndexes[j] - sweep->begIdx);
+        double *first = wo->outReal[0] + offset;
+        double *second = sweep->kernel == SWEEP_BBANDS ? wo->outReal[1] + offset : NULL;
+        double *third = sweep->kernel == SWEEP_BBANDS ? wo->outReal[2] + offset : NULL;
+
+        // Mean of the window ending at t from the prefix sums, a single value is its own mean
+        if (sweep->kernel == SWEEP_SMA) {
+            for (int i=0, t=sweep->begIndexes[j]; t <= wo->endIdx; i++, t++) {
+                int k = t - base + 1;
+                if (period == 1)
+                    first[i] = sweep->inReal[t];
+                else
+                    first[i] = ((sumHigh[k] - sumHigh[k - period]) + (sumLow[k] - sumLow[k - period])) / period;
+            }
+            continue;
+        }
+
+        // The variance cancels the large sums of the values and of their squares, so the rolling
+        // period totals are added and removed in the order of TA_INT_VAR, TA_INT_SMA and
+        // TA_INT_stddev_using_precalc_ma for the results to round as those of execute
+        const double *inReal = sweep->inReal;
+        const double *square = squares.data() - base;
+        int trailingIdx = sweep->begIndexes[j] - (period - 1);
+        double periodTotal1 = 0.0, periodTotal2 = 0.0;
+        for (int t=trailingIdx; t < sweep->begIndexes[j] && period > 1; t++) {
+            periodTotal1 += inReal[t];
+            periodTotal2 += square[t];
+        }
+
+        // Loop for all the results of the column
+        for (int i=0, t=sweep->begIndexes[j]; t <= wo->endIdx; i++, t++, trailingIdx++) {
+            periodTotal1 += inReal[t];
+            periodTotal2 += square[t];
+            double mean = periodTotal1 / period;
+            double meanSquare = periodTotal2 / period;
+            periodTotal1 -= inReal[trailingIdx];
+            periodTotal2 -= square[trailingIdx];
+
+            // Store the result of the function
+            double variance, deviation;
+            switch (sweep->kernel) {
+                case SWEEP_VAR:
+                    first[i] = meanSquare - mean * mean;
+                    break;
+                case SWEEP_STDDEV:
+                    variance = meanSquare - mean * mean;
+                    first[i] = variance < SWEEP_EPSILON ? 0.0 : sqrt(variance) * nbDevUp;
+                    break;
+                case SWEEP_BBANDS:
+                    variance = meanSquare - mean * mean;
+                    deviation = variance < SWEEP_EPSILON ? 0.0 : sqrt(variance);
+                    first[i] = mean + deviation * nbDevUp;
+                    second[i] = mean;
+                    third[i] = mean - deviation * nbDevDn;
+                    break;
+                default:
+                    break;
+            }
+
+        }
+
+    }
+
+}
+
+static void SWEEP_RSI_COLUMNS(sweep_object *sweep) {
+
+    // Work object holding the range and the result matrices
+    work_object *wo = sweep->wo;
+    const double *inReal = sweep->inReal;
+
+    // Settings the RSI is calculated with
+    int unstablePeriod = TA_GetUnstablePeriod(TA_FUNC_UNST_RSI);
+    bool metastock = TA_GetCompatibility() == TA_COMPATIBILITY_METASTOCK;
+
+    // The gains and losses start at the first price of the earliest seeding in use
+    int base = wo->endIdx + 1;
+    for (size_t j=0; j < sweep->values.size(); j++) {
+        if (sweep->nbElements[j] > 0 && sweep->begIndexes[j] - sweep->lookbacks[j] < base)
+            base = sweep->begIndexes[j] - sweep->lookbacks[j];
+    }
+    if (base > wo->endIdx)
+        return;
+
+    // Gain and loss of every price over the previous one, shared by every period
+    std::vector<double> gains(wo->endIdx - base + 1), losses(wo->endIdx - base + 1);
+    for (int t=base + 1; t <= wo->endIdx; t++) {
+        double change = inReal[t] - inReal[t - 1];
+        gains[t - base] = change < 0 ? 0.0 : change;
+        losses[t - base] = change < 0 ? -change : 0.0;
+    }
+
+    // Loop for all the columns, following the steps of TA_RSI so the results are identical
+    for (size_t j=0; j < sweep->values.size(); j++) {
+
+        // Nothing to compute in the range for this period
+        if (sweep->nbElements[j] == 0)
+            continue;
+
+        int period = sweep->values[j].integer;
+        int startIdx = sweep->begIndexes[j];
+        double *output = wo->outReal[0] + j * sweep->rows + (startIdx - sweep->begIdx);
+        int outIdx = 0;
+        double prevGain, prevLoss, total;
+        int today = startIdx - sweep->lookbacks[j];
+
+        // Metastock starts one bar earlier, assuming no change on the first bar
+        if (unstablePeriod == 0 && metastock) {
+            prevGain = inReal[today] - inReal[today];
+            prevLoss = 0.0;
+            for (int t=today + 1; t < today + period; t++) {
+                prevGain += gains[t - base];
+                prevLoss += losses[t - base];
+            }
+            prevLoss /= period;
+            prevGain /= period;
+            total = prevGain + prevLoss;
+            output[outIdx++] = (-SWEEP_EPSILON < total && total < SWEEP_EPSILON) ? 0.0 : 100 * (prevGain / total);
+            if (today + period > wo->endIdx)
+                continue;
+        }
+
+        // Average gain and loss of the first period
+        prevGain = 0.0;
+        prevLoss = 0.0;
+        for (int t=today + 1; t <= today + period; t++) {
+            prevGain += gains[t - base];
+            prevLoss += losses[t - base];
+        }
+        prevLoss /= period;
+        prevGain /= period;
+        today += period + 1;
+
+        // Output the first average, or smooth through the unstable period
+        if (today > startIdx) {
+            total = prevGain + prevLoss;
+            output[outIdx++] = (-SWEEP_EPSILON < total && total < SWEEP_EPSILON) ? 0.0 : 100.0 * (prevGain / total);
+        } else {
+            for (; today < startIdx; today++) {
+                prevLoss = (prevLoss * (period - 1) + losses[today - base]) / period;
+                prevGain = (prevGain * (period - 1) + gains[today - base]) / period;
+            }
+        }
+
+        // Smooth and output the remaining bars
+        for (; today <= wo->endIdx; today++) {
+            prevLoss = (prevLoss * (period - 1) + losses[today - base]) / period;
+            prevGain = (prevGain * (period - 1) + gains[today - base]) / period;
+            total = prevGain + prevLoss;
+            output[outIdx++] = (-SWEEP_EPSILON < total && total < SWEEP_EPSILON) ? 0.0 : 100.0 * (prevGain / total);
+        }
+
+    }
+
+}
+
+static void SWEEP_GENERIC_COLUMNS(sweep_object *sweep) {
+
+    // Work object holding the inputs and the result matrices
+    work_object *wo = sweep->wo;
+
+    // Loop for all the columns
+    for (size_t j=0; j < sweep->values.size(); j++) {
+
+        // Save the swept value
+        if (sweep->sweepInteger)
+            TA_SetOptInputParamInteger(wo->func_params, sweep->sweepIndex, sweep->values[j].integer);
+        else
+            TA_SetOptInputParamReal(wo->func_params, sweep->sweepIndex, sweep->values[j].real);
+
+        // Nothing to compute in the range for this value
+        if (sweep->nbElements[j] == 0)
+            continue;
+
+        // Write the results directly into the column
+        size_t offset = j * sweep->rows + (sweep->begIndexes[j] - sweep->begIdx);
+        for (int i=0; i < wo->nbOutput; i++) {
+            if (wo->outReal[i])
+                TA_SetOutputParamRealPtr(wo->func_params, i, wo->outReal[i] + offset);
+            else
+                TA_SetOutputParamIntegerPtr(wo->func_params, i, wo->outInt[i] + offset);
+        }
+
+        // Execute the function call for this value
+        if ((wo->retCode = TA_CallFunc((const TA_ParamHolder *)wo->func_params, wo->startIdx, wo->endIdx, &wo->outBegIdx, &wo->outNBElement)) != TA_SUCCESS)
+            return;
+        sweep->nbElements[j] = wo->outNBElement;
+
+    }
+
+}
+
+static void CALL_SWEEP_OBJECT(sweep_object *sweep) {
+
+    // Work object holding the inputs and the result matrices
+    work_object *wo = sweep->wo;
+
+    // Execute every column with the settings of the work object on this thread
+    TA_Context *previous = TA_GetThreadContext();
+    if (wo->context)
+        TA_SetThreadContext(wo->context);
+    wo->retCode = TA_SUCCESS;
+    switch (sweep->kernel) {
+        case SWEEP_SMA:
+        case SWEEP_VAR:
+        case SWEEP_STDDEV:
+        case SWEEP_BBANDS:
+            SWEEP_WINDOW_COLUMNS(sweep);
+            break;
+        case SWEEP_RSI:
+            SWEEP_RSI_COLUMNS(sweep);
+            break;
+        default:
+            SWEEP_GENERIC_COLUMNS(sweep);
+            break;
+    }
+    TA_SetThreadContext(previous);
+
+    // Pad every column before its first and after its last result
+    for (size_t j=0; j < sweep->values.size(); j++) {
+        size_t column = j * sweep->rows;
+        int first = sweep->nbElements[j] > 0 ? sweep->begIndexes[j] - sweep->begIdx : sweep->rows;
+        int last = sweep->nbElements[j] > 0 ? first + sweep->nbElements[j] : sweep->rows;
+        for (int i=0; i < wo->nbOutput; i++) {
+            for (int r=0; r < sweep->rows; r++) {
+                if (r == first)
+                    r = last;
+                if (r == sweep->rows)
+                    break;
+                if (wo->outReal[i])
+                    wo->outReal[i][column + r] = NAN;
+                else
+                    wo->outInt[i][column + r] = 0;
+            }
+        }
+    }
+
+}
+
+static bool BIND_SWEEP_VALUES(Local<Array> values, const func_layout *layout, sweep_object *sweep, std::string &error) {
+
+    // Work object holding the parameter holder
+    work_object *wo = sweep->wo;
+
+    // Return code
+    TA_RetCode retCode;
+
+    // Function lookback for a swept value
+    int lookback = 0;
+
+    // Loop for all the swept values
+    sweep->values.resize(values->Length());
+    for (unsigned int j=0; j < values->Length(); j++) {
+
+        // Get the swept value
+        Local<Value> value = Get(values, j).ToLocalChecked();
+        if (sweep->sweepInteger)
+            sweep->values[j].integer = value->IntegerValue(Nan::GetCurrentContext()).FromJust();
+        else
+            sweep->values[j].real = value->NumberValue(Nan::GetCurrentContext()).FromJust();
+
+        // Check the value is in the range of the optional input, the shared kernels do not call the function
+        if (!OPT_VALUE_IN_RANGE(layout->optInputs[sweep->sweepIndex], sweep->values[j])) {
+            error = (std::string)("Swept value ") + std::to_string(j) + (std::string)(": ") + TA_ERROR_STRING(TA_BAD_PARAM);
+            return false;
+        }
+
+        // Check the value together with the other optional inputs and get its lookback
+        sweep->optValues[sweep->sweepIndex] = sweep->values[j];
+        if (!BIND_OPT_INPUTS(layout, sweep->optValues, wo->func_params, error) ||
+            ((retCode = CONTEXT_LOOKBACK(wo->context, wo->func_params, &lookback)) != TA_SUCCESS && !(error = TA_ERROR_STRING(retCode)).empty())) {
+            error = (std::string)("Swept value ") + std::to_string(j) + (std::string)(": ") + error;
+            return false;
+        }
+        sweep->lookbacks.push_back(lookback);
+
+        // Results of the value start after its lookback
+        int begIdx = wo->startIdx > lookback ? wo->startIdx : lookback;
+        sweep->begIndexes.push_back(begIdx <= wo->endIdx ? begIdx : 0);
+        sweep->nbElements.push_back(begIdx <= wo->endIdx ? wo->endIdx - begIdx + 1 : 0);
+
+    }
+
+    // The rows of the matrix start at the earliest result of all the values
+    sweep->begIdx = wo->endIdx + 1;
+    for (size_t j=0; j < sweep->values.size(); j++) {
+        if (sweep->nbElements[j] > 0 && sweep->begIndexes[j] < sweep->begIdx)
+            sweep->begIdx = sweep->begIndexes[j];
+    }
+    sweep->rows = wo->endIdx - sweep->begIdx + 1;
+    if (sweep->rows == 0)
+        sweep->begIdx = 0;
+
+    return true;
+}
+
+static bool BIND_SWEEP_OUTPUTS(const func_layout *layout, const execute_options *options, sweep_object *sweep, Local<Array> pinned, std::string &error) {
+
+    // Work object holding the result matrices
+    work_object *wo = sweep->wo;
+
+    // One column major matrix per output, allocated or provided by the caller to be reused across sweeps
+    size_t length = sweep->values.size() * sweep->rows;
+    wo->callerOutput = options->callerOutput;
+    wo->outReal = new double*[wo->nbOutput]();
+    wo->outInt = new int*[wo->nbOutput]();
+    for (int i=0; i < wo->nbOutput; i++) {
+        if (options->callerOutput) {
+            void *output = GET_OUTPUT_ARRAY(options->outputs, layout->outputs[i], length, pinned, error);
+            if (output == NULL)
+                return false;
+            if (layout->outputs[i]->type == TA_Output_Real)
+                wo->outReal[i] = (double *)output;
+            else
+                wo->outInt[i] = (int *)output;
+        } else if (layout->outputs[i]->type == TA_Output_Real) {
+            wo->outReal[i] = new double[length];
+        } else {
+            wo->outInt[i] = new int[length];
+        }
+    }
+
+    return true;
+}
+
+static sweep_object *CREATE_SWEEP_OBJECT(Local<Object> parameter, bool snapshot, Local<Array> pinned, std::string &error) {
+
+    // Execution options
+    execute_options options;
+
+    // Function parameter layout
+    func_layout layout;
+
+    // Arrays converted once for the function and the shared kernels
+    input_cache cache;
+
+    // Return code
+    TA_RetCode retCode;
+
+    // Function parameter holder
+    TA_ParamHolder *func_params;
+
+    // Settings context
+    TA_Context *context = NULL;
+
+    // Swept values
+    Local<Array> values;
+    int sweepIndex = -1;
+
+    // Check the function name parameter
+    if (!HasOwnProperty(parameter, New<String>("name").ToLocalChecked()).FromJust()) {
+        error = "First argument must contain 'name' field";
+        return NULL;
+    }
+
+    // Retreive the execution options
+    if (!READ_EXECUTE_OPTIONS(parameter, &options, error))
+        return NULL;
+
+    // Retreive the function parameter layout
+    if (!LOAD_FUNCTION_LAYOUT(Get(parameter, New<String>("name").ToLocalChecked()).ToLocalChecked(), &layout, error))
+        return NULL;
+
+    // Find the optional input given as an Array of values
+    for (int i=0; i < (int)layout.optInputs.size(); i++) {
+        Local<String> key = New<String>(layout.optInputs[i]->paramName).ToLocalChecked();
+        if (!HasOwnProperty(parameter, key).FromJust() || !Get(parameter, key).ToLocalChecked()->IsArray())
+            continue;
+        if (sweepIndex >= 0) {
+            error = "Only one optional input can be swept";
+            return NULL;
+        }
+        values = Get(parameter, key).ToLocalChecked().As<Array>();
+        sweepIndex = i;
+    }
+    if (sweepIndex < 0 || values->Length() == 0) {
+        error = "One optional input must be an Array holding the values to sweep";
+        return NULL;
+    }
+
+    // Setup the sweep object
+    sweep_object *sweep = new sweep_object();
+    sweep->sweepIndex = sweepIndex;
+    sweep->sweepInteger = layout.optInputs[sweepIndex]->type == TA_OptInput_IntegerRange || layout.optInputs[sweepIndex]->type == TA_OptInput_IntegerList;
+    sweep->kernel = SWEEP_GENERIC;
+
+    // Retreive the other optional inputs and the settings context
+    if (!READ_OPT_INPUTS(parameter, &layout, sweep->optValues, error) ||
+        !READ_CONTEXT(parameter, snapshot, &context, error)) {
+        DISPOSE_SWEEP_OBJECT(sweep);
+        return NULL;
+    }
+
+    // Allocate parameter holder memory for function handle
+    if ((retCode = TA_ParamHolderAlloc(layout.func_handle, &func_params)) != TA_SUCCESS) {
+        TA_ContextFree(context);
+        DISPOSE_SWEEP_OBJECT(sweep);
+        error = TA_ERROR_STRING(retCode);
+        return NULL;
+    }
+
+    // Setup the work object
+    work_object *wo = new work_object();
+    wo->func_handle = (TA_FuncHandle *)layout.func_handle;
+    wo->startIdx = options.startIdx;
+    wo->endIdx = options.endIdx;
+    wo->func_params = func_params;
+    wo->inputCache = &cache;
+    wo->context = context;
+    wo->typedOutput = true;
+    wo->nbOutput = layout.outputs.size();
+    sweep->wo = wo;
+
+    // Functions swept over their period with a single input share the intermediates of every period
+    const char *name = layout.func_info->name;
+    if (sweepIndex == 0 && strcmp(layout.optInputs[0]->paramName, "optInTimePeriod") == 0 &&
+        layout.inputs.size() == 1 && layout.inputs[0]->type == TA_Input_Real) {
+        if (strcmp(name, "SMA") == 0)
+            sweep->kernel = SWEEP_SMA;
+        else if (strcmp(name, "VAR") == 0)
+            sweep->kernel = SWEEP_VAR;
+        else if (strcmp(name, "STDDEV") == 0)
+            sweep->kernel = SWEEP_STDDEV;
+        else if (strcmp(name, "RSI") == 0)
+            sweep->kernel = SWEEP_RSI;
+        else if (strcmp(name, "BBANDS") == 0 && sweep->optValues[3].integer == TA_MAType_SMA)
+            sweep->kernel = SWEEP_BBANDS;
+    }
+
+    // Bind the inputs, the swept values and the outputs, the kernels read the input directly
+    bool bound = BIND_INPUTS(parameter, &layout, wo, pinned, error) &&
+                 BIND_SWEEP_VALUES(values, &layout, sweep, error) &&
+                 BIND_SWEEP_OUTPUTS(&layout, &options, sweep, pinned, error) &&
+                 (sweep->kernel == SWEEP_GENERIC || (sweep->inReal = GET_INPUT_DOUBLE_ARRAY(parameter, layout.inputs[0]->paramName, wo, pinned, error)) != NULL);
+
+    // The work object owns the converted input arrays
+    wo->inputCache = NULL;
+    wo->garbage.insert(wo->garbage.end(), cache.arrays.begin(), cache.arrays.end());
+
+    // Check for error
+    if (!bound) {
+        DISPOSE_SWEEP_OBJECT(sweep);
+        return NULL;
+    }
+
+    return sweep;
+}
+
+static Local<Object> generateSweepResult(sweep_object *sweep) {
+
+    // Work object holding the result matrices
+    work_object *wo = sweep->wo;
+
+    // Sweep result object
+    Local<Object> result = New<Object>();
+
+    // Create the outputs object
+    Local<Object> outputArray = New<Object>();
+
+    // Swept values with the range of their results
+    Local<Array> values = New<Array>(sweep->values.size());
+    Local<Array> begIndexes = New<Array>(sweep->values.size());
+    Local<Array> nbElements = New<Array>(sweep->values.size());
+
+    // Function parameter information
+    const TA_OptInputParameterInfo *opt_paraminfo;
+    const TA_OutputParameterInfo *output_paraminfo;
+
+    // Check for execution error
+    if (wo->retCode != TA_SUCCESS) {
+        ThrowTypeError(TA_ERROR_STRING(wo->retCode).c_str());
+    }
+
+    // Set beginning index, number of rows and number of columns of the matrices
+    Set(result, New<String>("begIndex").ToLocalChecked(), New<Number>(sweep->begIdx));
+    Set(result, New<String>("nbElement").ToLocalChecked(), New<Number>(sweep->rows));
+    Set(result, New<String>("columns").ToLocalChecked(), New<Number>(sweep->values.size()));
+
+    // Set the swept values under the optional input name, with the range of every column
+    for (size_t j=0; j < sweep->values.size(); j++) {
+        Set(values, j, New<Number>(sweep->sweepInteger ? (double)sweep->values[j].integer : sweep->values[j].real));
+        Set(begIndexes, j, New<Number>(sweep->begIndexes[j]));
+        Set(nbElements, j, New<Number>(sweep->nbElements[j]));
+    }
+    TA_GetOptInputParameterInfo(wo->func_handle, sweep->sweepIndex, &opt_paraminfo);
+    Set(result, New<String>(opt_paraminfo->paramName).ToLocalChecked(), values);
+    Set(result, New<String>("begIndexes").ToLocalChecked(), begIndexes);
+    Set(result, New<String>("nbElements").ToLocalChecked(), nbElements);
+
+    // Results were written to the caller provided matrices
+    if (wo->callerOutput) {
+        return result;
+    }
+
+    // Loop for all the output parameters
+    for (int i=0; i < wo->nbOutput; i++) {
+
+        // Get the output parameter information
+        TA_GetOutputParameterInfo(wo->func_handle, i, &output_paraminfo);
+
+        // Set the matrix result, it now owns the output memory
+        if (wo->outReal[i]) {
+            Set(outputArray, New<String>(output_paraminfo->paramName).ToLocalChecked(), OUTPUT_TO_TYPED_ARRAY(wo->outReal[i], sweep->values.size() * sweep->rows, false));
+            wo->outReal[i] = NULL;
+        } else {
+            Set(outputArray, New<String>(output_paraminfo->paramName).ToLocalChecked(), OUTPUT_TO_TYPED_ARRAY(wo->outInt[i], sweep->values.size() * sweep->rows, true));
+            wo->outInt[i] = NULL;
+        }
+
+    }
+
+    // Set the outputs object
+    Set(result, New<String>("result").ToLocalChecked(), outputArray);
+    return result;
+}
+
+class SweepWorker : public AsyncWorker {
+ public:
+  SweepWorker(Callback *callback, sweep_object *sweep): AsyncWorker(callback), sweep(sweep) {}
+  ~SweepWorker() {
+
+    // Dispose the sweep object
+    DISPOSE_SWEEP_OBJECT(sweep);
+
+  }
+
+  void Execute () {
+
+    // Execute every column of the sweep on this thread
+    CALL_SWEEP_OBJECT(sweep);
+
+  }
+
+  void HandleOKCallback () {
+    HandleScope scope;
+
+    // Result info
+    Local<Value> argv[2];
+
+    // Return the sweep result
+    argv[0] = Nan::Null();
+    argv[1] = generateSweepResult(sweep);
+    callback->Call(2, argv);
+
+  };
+
+ private:
+  sweep_object *sweep;
+};
+
+NAN_METHOD(Sweep) {
+
+    // Callback function
+    Callback *cb = NULL;
+
+    // Input arrays referenced while the sweep is executed
+    Local<Array> pinned = New<Array>();
+
+    // Error message
+    std::string error;
+
+    // Check the sweep parameter
+    if (info.Length() < 1 || !info[0]->IsObject()) {
+        ThrowTypeError("First argument must be an Object with fields name, startIdx, endIdx, function input parameters and one optional input given as an Array");
+        return;
+    }
+
+    // Get the callback function
+    if (info[1]->IsFunction()) {
+        cb = new Callback(info[1].As<Function>());
+    }
+
+    // Setup the sweep object
+    sweep_object *sweep = CREATE_SWEEP_OBJECT(info[0].As<Object>(), cb != NULL, pinned, error);
+    if (sweep == NULL) {
+        REPORT_INTERNAL_ERROR(cb, error.c_str());
+        return;
+    }
+
+    // Execute synchronously and return the result
+    if (cb == NULL) {
+        CALL_SWEEP_OBJECT(sweep);
+        info.GetReturnValue().Set(generateSweepResult(sweep));
+        DISPOSE_SWEEP_OBJECT(sweep);
+        return;
+    }
+
+    // Queue the work, keeping the input arrays referenced until it completes
+    SweepWorker *worker = new SweepWorker(cb, sweep);
+    worker->SaveToPersistent("inputs", pinned);
+    AsyncQueueWorker(worker);
+}
+
+// Range of panel symbols owned by one participant, the other participants steal from its back
+struct panel_range {
+    std::mutex lock;
+    size_t begin;
+    size_t end;
+};
+
+// Panel job shared by the threads executing it
+struct panel_job {
+    std::vector<work_object *> items;
+    std::vector<panel_range> ranges;
+    int nextSlot;
+    int active;
+    std::condition_variable done;
+
+    panel_job(size_t slots): ranges(slots), nextSlot(1), active(0) {}
+};
+
+// Dedicated native thread pool executing panels
+class PanelPool {
+ public:
+  static PanelPool &Instance() {
+    static PanelPool pool;
+    return pool;
+  }
+
+  int Size() {
+    std::lock_guard<std::mutex> guard(lock);
+    Start();
+    return (int)threads.size();
+  }
+
+  void Resize(int size) {
+    std::lock_guard<std::mutex> resize(resizing);
+
+    // Stop the current threads, running panels complete on their calling thread
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (size_t i=0; i < threads.size(); i++) {
+        threads[i].join();
+    }
+
+    // Start the new threads
+    std::lock_guard<std::mutex> guard(lock);
+    threads.clear();
+    stopping = false;
+    started = false;
+    requested = size;
+    Start();
+
+  }
+
+  void Run(std::vector<work_object *> &items) {
+
+    // Split the symbols evenly between the calling thread and the pool threads
+    size_t slots = (size_t)Size() + 1;
+    panel_job job(slots);
+    job.items.swap(items);
+    for (size_t i=0; i < slots; i++) {
+        job.ranges[i].begin = job.items.size() * i / slots;
+        job.ranges[i].end = job.items.size() * (i + 1) / slots;
+    }
+
+    // Offer the job to the pool threads
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        jobs.push_back(&job);
+    }
+    wake.notify_all();
+
+    // The calling thread works on the first range
+    RUN_SLOT(&job, 0);
+
+    // Withdraw the job and wait for the pool threads still executing symbols
+    std::unique_lock<std::mutex> guard(lock);
+    for (size_t i=0; i < jobs.size(); i++) {
+        if (jobs[i] == &job) {
+            jobs.erase(jobs.begin() + i);
+            break;
+        }
+    }
+    job.done.wait(guard, [&job] { return job.active == 0; });
+    items.swap(job.items);
+
+  }
+
+ private:
+  PanelPool(): requested(0), started(false), stopping(false) {}
+  ~PanelPool() {
+
+    // Stop the threads at process exit
+    {
+        std::lock_guard<std::mutex> guard(lock);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (size_t i=0; i < threads.size(); i++) {
+        threads[i].join();
+    }
+
+  }
+
+  void Start() {
+
+    // Start the threads on first use, one per core less the calling thread by default
+    if (started)
+        return;
+    started = true;
+    int size = requested;
+    if (size <= 0) {
+        size = (int)std::thread::hardware_concurrency() - 1;
+        if (size < 1)
+            size = 1;
+    }
+    for (int i=0; i < size; i++) {
+        threads.push_back(std::thread(&PanelPool::Loop, this));
+    }
+
+  }
+
+  void Loop() {
+    std::unique_lock<std::mutex> guard(lock);
+    while (true) {
+
+        // Wait for a job with a free slot
+        wake.wait(guard, [this] { return stopping || !jobs.empty(); });
+        if (stopping)
+            return;
+
+        // Join the oldest job, or withdraw it when all its slots are taken
+        panel_job *job = jobs.front();
+        if (job->nextSlot >= (int)job->ranges.size()) {
+            jobs.pop_front();
+            continue;
+        }
+        int slot = job->nextSlot++;
+        job->active++;
+
+        // Execute the symbols without holding the pool lock
+        guard.unlock();
+        RUN_SLOT(job, slot);
+        guard.lock();
+
+        // Leave the job
+        if (--job->active == 0)
+            job->done.notify_all();
+
+    }
+  }
+
+  static bool TAKE(panel_range &range, size_t *index) {
+    std::lock_guard<std::mutex> guard(range.lock);
+    if (range.begin >= range.end)
+        return false;
+    *index = range.begin++;
+    return true;
+  }
+
+  static bool STEAL(panel_job *job, size_t slot, size_t *index) {
+    size_t slots = job->ranges.size();
+
+    // Take the back half of the first range found with remaining symbols
+    for (size_t i=1; i < slots; i++) {
+        panel_range &victim = job->ranges[(slot + i) % slots];
+        size_t begin, end;
+        {
+            std::lock_guard<std::mutex> guard(victim.lock);
+            if (victim.begin >= victim.end)
+                continue;
+            begin = victim.begin + (victim.end - victim.begin) / 2;
+            end = victim.end;
+            victim.end = begin;
+        }
+
+        // Keep the rest of the stolen symbols in the own range
+        std::lock_guard<std::mutex> guard(job->ranges[slot].lock);
+        job->ranges[slot].begin = begin + 1;
+        job->ranges[slot].end = end;
+        *index = begin;
+        return true;
+    }
+
+    return false;
+  }
+
+  static void RUN_SLOT(panel_job *job, size_t slot) {
+    size_t index;
+
+    // Execute the own symbols, then steal from the other participants
+    while (TAKE(job->ranges[slot], &index) || STEAL(job, slot, &index)) {
+        CALL_WORK_OBJECT(job->items[index]);
+    }
+  }
+
+  std::mutex resizing;
+  std::mutex lock;
+  std::condition_variable wake;
+  std::deque<panel_job *> jobs;
+  std::vector<std::thread> threads;
+  int requested;
+  bool started;
+  bool stopping;
+};
+
+class PanelWorker : public AsyncWorker {
+ public:
+  PanelWorker(Callback *callback, batch_object *batch): AsyncWorker(callback), batch(batch) {}
+  ~PanelWorker() {
+
+    // Dispose the batch object
+    DISPOSE_BATCH_OBJECT(batch);
+
+  }
+
+  void Execute () {
+
+    // Execute the symbols on the panel pool, this thread takes part
+    PanelPool::Instance().Run(batch->items);
+
+  }
+
+  void HandleOKCallback () {
+    HandleScope scope;
+
+    // Result info
+    Local<Value> argv[2];
+
+    // Return the execution results
+    argv[0] = Nan::Null();
+    argv[1] = generateBatchResult(batch);
+    callback->Call(2, argv);
+
+  };
+
+ private:
+  batch_object *batch;
+};
+
+static bool PANEL_SYMBOL_PARAMETERS(Local<Object> parameter, Local<Value> symbol, const func_layout *layout, Local<Object> &merged, std::string &error) {
+
+    // Symbol given as the object of its inputs
+    if (symbol->IsObject() && !symbol->IsArray() && !symbol->IsTypedArray() && !symbol->IsArrayBuffer()) {
+        merged = MERGE_PARAMETERS(parameter, symbol.As<Object>());
+        return true;
+    }
+
+    // Symbol given as a single array, only for functions with a single real input
+    if (layout->inputs.size() != 1 || layout->inputs[0]->type != TA_Input_Real) {
+        error = "Series must be Objects holding the function inputs";
+        return false;
+    }
+    if (symbol->IsArrayBuffer() && symbol.As<v8::ArrayBuffer>()->ByteLength() % sizeof(double) != 0) {
+        error = (std::string)("Field '") + (std::string)(layout->inputs[0]->paramName) + (std::string)("' must be an Array, Float64Array or ArrayBuffer");
+        return false;
+    }
+    merged = MERGE_PARAMETERS(parameter, New<Object>());
+    Set(merged, New<String>(layout->inputs[0]->paramName).ToLocalChecked(), symbol);
+
+    // The range defaults to the whole series
+    if (!HasOwnProperty(merged, New<String>("startIdx").ToLocalChecked()).FromJust())
+        Set(merged, New<String>("startIdx").ToLocalChecked(), New<Number>(0));
+    if (!HasOwnProperty(merged, New<String>("endIdx").ToLocalChecked()).FromJust()) {
+        double length = 0;
+        if (symbol->IsArrayBuffer())
+            length = symbol.As<v8::ArrayBuffer>()->ByteLength() / sizeof(double);
+        else if (symbol->IsObject())
+            length = Get(symbol.As<Object>(), New<String>("length").ToLocalChecked()).ToLocalChecked()->NumberValue(Nan::GetCurrentContext()).FromMaybe(0);
+        Set(merged, New<String>("endIdx").ToLocalChecked(), New<Number>(length - 1));
+    }
+
+    return true;
+}
+
+// Contiguous panel columns, every Float64Array parameter holds one column per symbol
+struct panel_columns {
+    Local<Object> parameter;
+    std::vector<Local<Value> > keys;
+    std::vector<Local<v8::Float64Array> > arrays;
+    size_t length;
+};
+
+static bool PANEL_COLUMNS(Local<Object> parameter, unsigned int symbols, panel_columns *columns, std::string &error) {
+
+    // Copy the parameters once, the column views are replaced for every symbol
+    columns->parameter = MERGE_PARAMETERS(parameter, New<Object>());
+    columns->length = 0;
+
+    // Find the column parameters
+    Local<Array> keys = Nan::GetOwnPropertyNames(parameter).ToLocalChecked();
+    for (unsigned int i=0; i < keys->Length(); i++) {
+        Local<Value> key = Get(keys, i).ToLocalChecked();
+        Local<Value> value = Get(parameter, key).ToLocalChecked();
+        if (!value->IsFloat64Array())
+            continue;
+
+        // Check the column layout
+        Local<v8::Float64Array> array = value.As<v8::Float64Array>();
+        if (array->Length() % symbols != 0 || (columns->length && array->Length() / symbols != columns->length)) {
+            error = (std::string)("Field '") + (std::string)(*Utf8String(key)) + (std::string)("' must hold the same number of values for every symbol");
+            return false;
+        }
+        columns->length = array->Length() / symbols;
+        columns->keys.push_back(key);
+        columns->arrays.push_back(array);
+    }
+
+    // The range defaults to the whole column
+    if (!HasOwnProperty(columns->parameter, New<String>("startIdx").ToLocalChecked()).FromJust())
+        Set(columns->parameter, New<String>("startIdx").ToLocalChecked(), New<Number>(0));
+    if (!HasOwnProperty(columns->parameter, New<String>("endIdx").ToLocalChecked()).FromJust() && columns->length > 0)
+        Set(columns->parameter, New<String>("endIdx").ToLocalChecked(), New<Number>((double)columns->length - 1));
+
+    return true;
+}
+
+static Local<Object> PANEL_COLUMN_PARAMETERS(panel_columns *columns, unsigned int symbol) {
+
+    // Use a view on the column of the symbol for every column parameter
+    for (size_t i=0; i < columns->keys.size(); i++) {
+        Local<v8::Float64Array> array = columns->arrays[i];
+        Set(columns->parameter, columns->keys[i], v8::Float64Array::New(array->Buffer(), array->ByteOffset() + symbol * columns->length * sizeof(double), columns->length));
+    }
+
+    return columns->parameter;
+}
+
+NAN_METHOD(ExecutePanel) {
+
+    // Panel parameter
+    Local<Object> panelParameter;
+
+    // Callback function
+    Callback *cb = NULL;
+
+    // Input and output arrays referenced while the panel is executed
+    Local<Array> pinned = New<Array>();
+
+    // Function parameter layout
+    func_layout layout;
+
+    // Per symbol series or contiguous columns
+    Local<Array> series;
+    panel_columns columns;
+    unsigned int symbols = 0;
+
+    // Error message
+    std::string error;
+
+    // Check the panel parameter
+    if (info.Length() < 1 || !info[0]->IsObject()) {
+        ThrowTypeError("First argument must be an Object with fields name, series or symbols and the function parameters");
+        return;
+    }
+    panelParameter = info[0].As<Object>();
+
+    // Get the callback function
+    if (info[1]->IsFunction()) {
+        cb = new Callback(info[1].As<Function>());
+    }
+
+    // Check the function name parameter
+    if (!HasOwnProperty(panelParameter, New<String>("name").ToLocalChecked()).FromJust()) {
+        REPORT_INTERNAL_ERROR(cb, "First argument must contain 'name' field");
+        return;
+    }
+
+    // Retreive the function parameter layout
+    if (!LOAD_FUNCTION_LAYOUT(Get(panelParameter, New<String>("name").ToLocalChecked()).ToLocalChecked(), &layout, error)) {
+        REPORT_INTERNAL_ERROR(cb, error.c_str());
+        return;
+    }
+
+    // Caller provided outputs are not split per symbol
+    if (HasOwnProperty(panelParameter, New<String>("outputs").ToLocalChecked()).FromJust()) {
+        REPORT_INTERNAL_ERROR(cb, "Field 'outputs' is not supported by executePanel");
+        return;
+    }
+
+    // Retreive the series list or the number of symbols in the columns
+    if (HasOwnProperty(panelParameter, New<String>("series").ToLocalChecked()).FromJust()) {
+        Local<Value> value = Get(panelParameter, New<String>("series").ToLocalChecked()).ToLocalChecked();
+        if (!value->IsArray()) {
+            REPORT_INTERNAL_ERROR(cb, "Field 'series' must be an Array with the inputs of every symbol");
+            return;
+        }
+        series = value.As<Array>();
+        symbols = series->Length();
+
+        // The series are not a parameter of the function
+        panelParameter = MERGE_PARAMETERS(panelParameter, New<Object>());
+        Nan::Delete(panelParameter, New<String>("series").ToLocalChecked()).FromJust();
+    } else if (HasOwnProperty(panelParameter, New<String>("symbols").ToLocalChecked()).FromJust()) {
+        symbols = Get(panelParameter, New<String>("symbols").ToLocalChecked()).ToLocalChecked()->Uint32Value(Nan::GetCurrentContext()).FromJust();
+        if (symbols == 0) {
+            REPORT_INTERNAL_ERROR(cb, "Field 'symbols' must be a positive number");
+            return;
+        }
+
+        // Find the columns, the number of symbols is not a parameter of the function
+        if (!PANEL_COLUMNS(panelParameter, symbols, &columns, error)) {
+            REPORT_INTERNAL_ERROR(cb, error.c_str());
+            return;
+        }
+        Nan::Delete(columns.parameter, New<String>("symbols").ToLocalChecked()).FromJust();
+    } else {
+        REPORT_INTERNAL_ERROR(cb, "First argument must contain 'series' or 'symbols' field");
+        return;
+    }
+
+    // Setup the batch object, every symbol gets its own work object and parameter holder
+    batch_object *batch = new batch_object();
+
+    // Retreive the settings context shared by the symbols
+    if (!READ_CONTEXT(panelParameter, cb != NULL, &batch->context, error)) {
+        DISPOSE_BATCH_OBJECT(batch);
+        REPORT_INTERNAL_ERROR(cb, error.c_str());
+        return;
+    }
+
+    for (unsigned int i=0; i < symbols; i++) {
+
+        // Get the parameters of the symbol
+        Local<Object> merged;
+        bool ok = true;
+        if (series.IsEmpty())
+            merged = PANEL_COLUMN_PARAMETERS(&columns, i);
+        else
+            ok = PANEL_SYMBOL_PARAMETERS(panelParameter, Get(series, i).ToLocalChecked(), &layout, merged, error);
+
+        // Setup the work object of the symbol
+        work_object *wo = ok ? CREATE_WORK_OBJECT(merged, NULL, batch->context, cb != NULL, pinned, error) : NULL;
+        if (wo == NULL) {
+            error = (std::string)("Symbol ") + std::to_string(i) + (std::string)(": ") + error;
+            break;
+        }
+        batch->items.push_back(wo);
+
+    }
+
+    // Check for error
+    if (!error.empty()) {
+        DISPOSE_BATCH_OBJECT(batch);
+        REPORT_INTERNAL_ERROR(cb, error.c_str());
+        return;
+    }
+
+    // Execute synchronously and return the results
+    if (cb == NULL) {
+        PanelPool::Instance().Run(batch->items);
+        info.GetReturnValue().Set(generateBatchResult(batch));
+        DISPOSE_BATCH_OBJECT(batch);
+        return;
+    }
+
+    // Queue the work, keeping the input and output arrays referenced until it completes
+    PanelWorker *worker = new PanelWorker(cb, batch);
+    worker->SaveToPersistent("inputs", pinned);
+    AsyncQueueWorker(worker);
+}
+
+NAN_METHOD(SetPanelThreads) {
+
+    // Check the thread count
+    if (info.Length() < 1 || !info[0]->IsNumber()) {
+        ThrowTypeError("One argument required - Number of panel threads");
+        return;
+    }
+
+    // Resize the panel pool, zero restores the default size
+    PanelPool::Instance().Resize(info[0]->Int32Value(Nan::GetCurrentContext()).FromJust());
+    info.GetReturnValue().Set(New<Number>(PanelPool::Instance().Size()));
+}
+
+// SIMD level names, indexed by TA_SimdLevel
+static const char *simd_levels[] = { "scalar", "sse2", "avx2", "avx512" };
+
+NAN_METHOD(SetSimdLevel) {
+
+    // Check the level name
+    int level = -1;
+    if (info.Length() > 0 && info[0]->IsString()) {
+        Utf8String name(info[0]);
+        for (int i=0; i < 4; i++)
+            if (strcmp(*name, simd_levels[i]) == 0)
+                level = i;
+    }
+    if (level < 0) {
+        ThrowTypeError("One argument required - SIMD level 'scalar', 'sse2', 'avx2' or 'avx512'");
+        return;
+    }
+
+    // Limit the kernels to the level, the CPU may support less
+    TA_SetSimdLevel((TA_SimdLevel)level);
+    info.GetReturnValue().Set(New<String>(simd_levels[TA_GetSimdLevel()]).ToLocalChecked());
+}
+
+NAN_METHOD(GetSimdLevel) {
+    info.GetReturnValue().Set(New<String>(simd_levels[TA_GetSimdLevel()]).ToLocalChecked());
+}
+
+// Prepared function object
+class PreparedFunction : public Nan::ObjectWrap {
+ public:
+  static NAN_METHOD(New);
+  static NAN_METHOD(Execute);
+
+ private:
+  PreparedFunction(): func_params(NULL), context(NULL), lookback(0) {}
+  ~PreparedFunction() {
+
+    // Clear parameter holder memory
+    if (func_params)
+        TA_ParamHolderFree(func_params);
+
+    // Clear the settings context
+    TA_ContextFree(context);
+
+  }
+
+  // Function parameter layout
+  func_layout layout;
+
+  // Optional input parameter values
+  std::vector<opt_value> optValues;
+
+  // Parameter holder reused by synchronous calls
+  TA_ParamHolder *func_params;
+
+  // Settings captured when the function was prepared
+  TA_Context *context;
+
+  // Function lookback
+  int lookback;
+};
+
+NAN_METHOD(PreparedFunction::New) {
+
+    // Function parameter
+    Local<Object> functionParameter;
+
+    // Error message
+    std::string error;
+
+    // Return code
+    TA_RetCode retCode;
+
+    // Function identifier
+    unsigned int func_id;
+
+    // Check the function parameter
+    if (info.Length() < 1 || !info[0]->IsObject()) {
+        ThrowTypeError("First argument must be an Object with field name and the function optional input parameters");
+        return;
+    }
+    functionParameter = info[0]->ToObject(Nan::GetCurrentContext()).FromMaybe(v8::Local<Object>());
+
+    // Check the function name parameter
+    if (!HasOwnProperty(functionParameter, Nan::New<String>("name").ToLocalChecked()).FromJust()) {
+        ThrowTypeError("First argument must contain 'name' field");
+        return;
+    }
+
+    // Create the prepared function
+    PreparedFunction *prepared = new PreparedFunction();
+    prepared->Wrap(info.This());
+
+    // Resolve the function, its optional input parameters and its settings once
+    if (!LOAD_FUNCTION_LAYOUT(Get(functionParameter, Nan::New<String>("name").ToLocalChecked()).ToLocalChecked(), &prepared->layout, error) ||
+        !READ_OPT_INPUTS(functionParameter, &prepared->layout, prepared->optValues, error) ||
+        !READ_CONTEXT(functionParameter, true, &prepared->context, error)) {
+        ThrowTypeError(error.c_str());
+        return;
+    }
+
+    // Allocate the reusable parameter holder
+    if ((retCode = TA_ParamHolderAlloc(prepared->layout.func_handle, &prepared->func_params)) != TA_SUCCESS) {
+        ThrowTypeError(TA_ERROR_STRING(retCode).c_str());
+        return;
+    }
+
+    // Bind the optional inputs and determine the lookback
+    if (!BIND_OPT_INPUTS(&prepared->layout, prepared->optValues, prepared->func_params, error)) {
+        ThrowTypeError(error.c_str());
+        return;
+    }
+    if ((retCode = CONTEXT_LOOKBACK(prepared->context, prepared->func_params, &prepared->lookback)) != TA_SUCCESS) {
+        ThrowTypeError(TA_ERROR_STRING(retCode).c_str());
+        return;
+    }
+
+    // Store the function information
+    Set(info.This(), Nan::New<String>("name").ToLocalChecked(), Nan::New<String>(prepared->layout.func_info->name).ToLocalChecked());
+    Set(info.This(), Nan::New<String>("lookback").ToLocalChecked(), Nan::New<Number>(prepared->lookback));
+    if (TA_GetFuncId(prepared->layout.func_handle, &func_id) == TA_SUCCESS)
+        Set(info.This(), Nan::New<String>("id").ToLocalChecked(), Nan::New<Number>(func_id));
+
+    info.GetReturnValue().Set(info.This());
+}
+
+NAN_METHOD(PreparedFunction::Execute) {
+
+    // Prepared function
+    PreparedFunction *prepared = ObjectWrap::Unwrap<PreparedFunction>(info.Holder());
+
+    // Execution parameter
+    Local<Object> executeParameter;
+
+    // Callback function
+    Callback *cb = NULL;
+
+    // Input and output arrays referenced while the function is executed
+    Local<Array> pinned = Nan::New<Array>();
+
+    // Execution options
+    execute_options options;
+
+    // Error message
+    std::string error;
+
+    // Return code
+    TA_RetCode retCode;
+
+    // Check the execution parameter
+    if (info.Length() < 1 || !info[0]->IsObject()) {
+        ThrowTypeError("First argument must be an Object with fields startIdx, endIdx and function input parameters");
+        return;
+    }
+    executeParameter = info[0]->ToObject(Nan::GetCurrentContext()).FromMaybe(v8::Local<Object>());
+
+    // Get the callback function
+    if (info[1]->IsFunction()) {
+        cb = new Callback(info[1].As<Function>());
+    }
+
+    // Retreive the execution options
+    if (!READ_EXECUTE_OPTIONS(executeParameter, &options, error)) {
+        REPORT_INTERNAL_ERROR(cb, error.c_str());
+        return;
+    }
+
+    // Setup the work object
+    work_object *wo = new work_object();
+    wo->func_handle = (TA_FuncHandle *)prepared->layout.func_handle;
+    wo->startIdx = options.startIdx;
+    wo->endIdx = options.endIdx;
+    wo->context = prepared->context;
+    wo->sharedContext = true;
+
+    // Synchronous calls reuse the prepared parameter holder, asynchronous calls get their own
+    if (cb == NULL) {
+        wo->func_params = prepared->func_params;
+        wo->sharedParams = true;
+    } else if ((retCode = TA_ParamHolderAlloc(prepared->layout.func_handle, &wo->func_params)) != TA_SUCCESS) {
+        DISPOSE_WORK_OBJECT(wo);
+        REPORT_INTERNAL_ERROR(cb, TA_ERROR_STRING(retCode).c_str());
+        return;
+    } else if (!BIND_OPT_INPUTS(&prepared->layout, prepared->optValues, wo->func_params, error)) {
+        DISPOSE_WORK_OBJECT(wo);
+        REPORT_INTERNAL_ERROR(cb, error.c_str());
+        return;
+    }
+
+    // Bind the inputs and the outputs
+    if (!BIND_INPUTS(executeParameter, &prepared->layout, wo, pinned, error) ||
+        !BIND_OUTPUTS(&prepared->layout, &options, prepared->lookback, wo, pinned, error)) {
+
+        // Clear the work object
+        DISPOSE_WORK_OBJECT(wo);
+
+        // Return internal error
+        REPORT_INTERNAL_ERROR(cb, error.c_str());
+        return;
+
+    }
+
+    // Keep the prepared function and its settings alive until an asynchronous call completes
+    Set(pinned, pinned->Length(), info.Holder());
+
+    // Execute the function
+    RUN_WORK_OBJECT(wo, cb, pinned, info.GetReturnValue());
+}
+
+NAN_METHOD(Prepare) {
+
+    // Create a prepared function with the constructor passed as data
+    Local<Value> argv[1] = { info[0] };
+    Local<Object> prepared;
+    if (Nan::NewInstance(info.Data().As<Function>(), 1, argv).ToLocal(&prepared)) {
+        info.GetReturnValue().Set(prepared);
+    }
+}
+
+// Functions carrying state from the first bar without an unstable period, a series recomputes them from the start
+static const char *series_restart_functions[] = {
+    "AD", "ADOSC", "DEMA", "MACD", "MACDFIX", "OBV", "SAR", "SAREXT", "TEMA", "TRIX"
+};
+
+// Series object keeping the inputs and outputs of a function as bars are appended
+class SeriesFunction : public Nan::ObjectWrap {
+ public:
+  static NAN_METHOD(New);
+  static NAN_METHOD(Append);
+  static NAN_METHOD(Result);
+
+ private:
+  SeriesFunction(): func_params(NULL), context(NULL), lookback(0), restart(false), length(0), outBegIdx(0), outNBElement(0) {}
+  ~SeriesFunction() {
+
+    // Clear parameter holder memory
+    if (func_params)
+        TA_ParamHolderFree(func_params);
+
+    // Clear the settings context
+    TA_ContextFree(context);
+
+  }
+
+  // Input field names, one per price field or real input in the order of the function inputs
+  std::vector<const char *> Fields();
+
+  // Point the parameter holder at the inputs kept so far
+  bool BindInputs(std::string &error);
+
+  // Function parameter layout
+  func_layout layout;
+
+  // Parameter holder bound to the kept inputs
+  TA_ParamHolder *func_params;
+
+  // Settings captured when the series was created
+  TA_Context *context;
+
+  // Function lookback
+  int lookback;
+
+  // Whether every append recomputes the series from its first bar
+  bool restart;
+
+  // Number of bars appended
+  int length;
+
+  // Input values of every bar, one column per input field
+  std::vector<std::vector<double> > columns;
+
+  // Output values from the first bar past the lookback
+  int outBegIdx;
+  int outNBElement;
+  std::vector<std::vector<double> > outReal;
+  std::vector<std::vector<int> > outInt;
+};
+
+std::vector<const char *> SeriesFunction::Fields() {
+
+    // Loop for all the input parameters
+    std::vector<const char *> names;
+    for (size_t i=0; i < layout.inputs.size(); i++) {
+        if (layout.inputs[i]->type == TA_Input_Real) {
+            names.push_back(layout.inputs[i]->paramName);
+            continue;
+        }
+        for (int p=0; p < 6; p++) {
+            if (layout.inputs[i]->flags & price_fields[p].flag)
+                names.push_back(price_fields[p].name);
+        }
+    }
+
+    return names;
+}
+
+bool SeriesFunction::BindInputs(std::string &error) {
+
+    // Return code
+    TA_RetCode retCode = TA_SUCCESS;
+
+    // The columns may have moved as they grew
+    size_t k = 0;
+    for (int i=0; i < (int)layout.inputs.size() && retCode == TA_SUCCESS; i++) {
+        if (layout.inputs[i]->type == TA_Input_Real) {
+            retCode = TA_SetInputParamRealPtr(func_params, i, columns[k++].data());
+            continue;
+        }
+        double *prices[6];
+        for (int p=0; p < 6; p++) {
+            prices[p] = (layout.inputs[i]->flags & price_fields[p].flag) ? columns[k++].data() : NULL;
+        }
+        retCode = TA_SetInputParamPricePtr(func_params, i, prices[0], prices[1], prices[2], prices[3], prices[4], prices[5]);
+    }
+    if (retCode != TA_SUCCESS) {
+        error = TA_ERROR_STRING(retCode);
+        return false;
+    }
+
+    return true;
+}
+
+NAN_METHOD(SeriesFunction::New) {
+
+    // Function parameter
+    Local<Object> functionParameter;
+
+    // Optional input parameter values
+    std::vector<opt_value> optValues;
+
+    // Error message
+    std::string error;
+
+    // Return code
+    TA_RetCode retCode;
+
+    // Function identifier
+    unsigned int func_id;
+
+    // Check the function parameter
+    if (info.Length() < 1 || !info[0]->IsObject()) {
+        ThrowTypeError("First argument must be an Object with field name and the function optional input parameters");
+        return;
+    }
+    functionParameter = info[0].As<Object>();
+
+    // Check the function name parameter
+    if (!HasOwnProperty(functionParameter, Nan::New<String>("name").ToLocalChecked()).FromJust()) {
+        ThrowTypeError("First argument must contain 'name' field");
+        return;
+    }
+
+    // Create the series
+    SeriesFunction *series = new SeriesFunction();
+    series->Wrap(info.This());
+
+    // Resolve the function, its optional input parameters and its settings once
+    if (!LOAD_FUNCTION_LAYOUT(Get(functionParameter, Nan::New<String>("name").ToLocalChecked()).ToLocalChecked(), &series->layout, error) ||
+        !READ_OPT_INPUTS(functionParameter, &series->layout, optValues, error) ||
+        !READ_CONTEXT(functionParameter, true, &series->context, error)) {
+        ThrowTypeError(error.c_str());
+        return;
+    }
+
+    // Integer inputs are not a series of values
+    for (size_t i=0; i < series->layout.inputs.size(); i++) {
+        if (series->layout.inputs[i]->type == TA_Input_Integer) {
+            ThrowTypeError((((std::string)("Input '") + series->layout.inputs[i]->paramName) + (std::string)("' can not be appended")).c_str());
+            return;
+        }
+    }
+
+    // Allocate the parameter holder, bind the optional inputs and determine the lookback
+    if ((retCode = TA_ParamHolderAlloc(series->layout.func_handle, &series->func_params)) != TA_SUCCESS) {
+        ThrowTypeError(TA_ERROR_STRING(retCode).c_str());
+        return;
+    }
+    if (!BIND_OPT_INPUTS(&series->layout, optValues, series->func_params, error)) {
+        ThrowTypeError(error.c_str());
+        return;
+    }
+    if ((retCode = CONTEXT_LOOKBACK(series->context, series->func_params, &series->lookback)) != TA_SUCCESS) {
+        ThrowTypeError(TA_ERROR_STRING(retCode).c_str());
+        return;
+    }
+
+    // Functions with an unstable period, a running total or a recursive moving average type can not
+    // restart from the first appended bar without changing their values
+    series->restart = (series->layout.func_info->flags & TA_FUNC_FLG_UNST_PER) != 0;
+    for (size_t i=0; i < sizeof(series_restart_functions) / sizeof(series_restart_functions[0]); i++) {
+        if (strcmp(series_restart_functions[i], series->layout.func_info->name) == 0)
+            series->restart = true;
+    }
+    for (size_t i=0; i < series->layout.optInputs.size(); i++) {
+        TA_MAType maType = (TA_MAType)optValues[i].integer;
+        if (strstr(series->layout.optInputs[i]->paramName, "MAType") != NULL &&
+            maType != TA_MAType_SMA && maType != TA_MAType_WMA && maType != TA_MAType_TRIMA)
+            series->restart = true;
+    }
+
+    // Empty inputs and outputs
+    series->columns.resize(series->Fields().size());
+    series->outReal.resize(series->layout.outputs.size());
+    series->outInt.resize(series->layout.outputs.size());
+
+    // Store the function information
+    Set(info.This(), Nan::New<String>("name").ToLocalChecked(), Nan::New<String>(series->layout.func_info->name).ToLocalChecked());
+    Set(info.This(), Nan::New<String>("lookback").ToLocalChecked(), Nan::New<Number>(series->lookback));
+    Set(info.This(), Nan::New<String>("length").ToLocalChecked(), Nan::New<Number>(0));
+    Set(info.This(), Nan::New<String>("incremental").ToLocalChecked(), Nan::New<v8::Boolean>(!series->restart));
+    if (TA_GetFuncId(series->layout.func_handle, &func_id) == TA_SUCCESS)
+        Set(info.This(), Nan::New<String>("id").ToLocalChecked(), Nan::New<Number>(func_id));
+
+    info.GetReturnValue().Set(info.This());
+}
+
+static bool READ_OUTPUT_MODE(Local<Value> parameter, bool *typedOutput, std::string &error) {
+
+    // Array results unless 'typed' is requested
+    *typedOutput = false;
+    if (!parameter->IsObject() || !HasOwnProperty(parameter.As<Object>(), New<String>("output").ToLocalChecked()).FromJust())
+        return true;
+    Utf8String output_mode( Get(parameter.As<Object>(), New<String>("output").ToLocalChecked()).ToLocalChecked()->ToString(Nan::GetCurrentContext()).FromMaybe(v8::Local<v8::String>()) );
+    if (strcmp(*output_mode, "typed") == 0) {
+        *typedOutput = true;
+    } else if (strcmp(*output_mode, "array") != 0) {
+        error = "Argument 'output' needs to be either 'array' or 'typed'";
+        return false;
+    }
+
+    return true;
+}
+
+NAN_METHOD(SeriesFunction::Append) {
+
+    // Series
+    SeriesFunction *series = ObjectWrap::Unwrap<SeriesFunction>(info.Holder());
+
+    // Input fields of the function
+    std::vector<const char *> fields = series->Fields();
+
+    // Execution options, the range covers the appended bars
+    execute_options options;
+    options.callerOutput = false;
+
+    // Error message
+    std::string error;
+
+    // Check the appended values
+    if (info.Length() < 1 || !info[0]->IsObject()) {
+        ThrowTypeError("First argument must be an Object with the input values of the appended bars");
+        return;
+    }
+    Local<Object> parameter = info[0].As<Object>();
+    if (!READ_OUTPUT_MODE(parameter, &options.typedOutput, error)) {
+        ThrowTypeError(error.c_str());
+        return;
+    }
+
+    // Work object of the tail, it owns the converted values and the new outputs
+    work_object *wo = new work_object();
+    wo->func_handle = (TA_FuncHandle *)series->layout.func_handle;
+    wo->func_params = series->func_params;
+    wo->sharedParams = true;
+    wo->context = series->context;
+    wo->sharedContext = true;
+    wo->endIdx = -1;
+
+    // Every field holds the same number of bars
+    std::vector<double *> values(fields.size());
+    int count = -1;
+    for (size_t k=0; k < fields.size(); k++) {
+        int length = 0;
+        if (!HasOwnProperty(parameter, Nan::New<String>(fields[k]).ToLocalChecked()).FromJust()) {
+            error = (std::string)("First argument must contain '") + (std::string)(fields[k]) + (std::string)("' field");
+            break;
+        }
+        values[k] = V8_INPUT_DOUBLE_ARRAY(Get(parameter, Nan::New<String>(fields[k]).ToLocalChecked()).ToLocalChecked(), &length, wo);
+        if (length < 0) {
+            error = (std::string)("Field '") + (std::string)(fields[k]) + (std::string)("' must be an Array, Float64Array or ArrayBuffer");
+            break;
+        }
+        if (count >= 0 && length != count) {
+            error = (std::string)("Field '") + (std::string)(fields[k]) + (std::string)("' must contain as many values as the other fields");
+            break;
+        }
+        count = length;
+    }
+    if (!error.empty()) {
+        DISPOSE_WORK_OBJECT(wo);
+        ThrowTypeError(error.c_str());
+        return;
+    }
+
+    // Keep the appended bars, the function reads back from the first new one as far as its lookback
+    int oldLength = series->length;
+    for (size_t k=0; k < fields.size(); k++) {
+        series->columns[k].insert(series->columns[k].end(), values[k], values[k] + count);
+    }
+    options.startIdx = series->restart ? 0 : oldLength;
+    options.endIdx = oldLength + count - 1;
+    wo->startIdx = options.startIdx;
+    wo->endIdx = options.endIdx;
+
+    // Compute the outputs of the new bars only, or of the whole series when it restarts
+    Local<Array> pinned = Nan::New<Array>();
+    if (!series->BindInputs(error) || !BIND_OUTPUTS(&series->layout, &options, series->lookback, wo, pinned, error)) {
+        for (size_t k=0; k < fields.size(); k++)
+            series->columns[k].resize(oldLength);
+        DISPOSE_WORK_OBJECT(wo);
+        ThrowTypeError(error.c_str());
+        return;
+    }
+    if (count > 0) {
+        CALL_WORK_OBJECT(wo);
+    } else {
+        wo->retCode = TA_SUCCESS;
+        wo->outBegIdx = 0;
+        wo->outNBElement = 0;
+    }
+    if (wo->retCode != TA_SUCCESS) {
+        for (size_t k=0; k < fields.size(); k++)
+            series->columns[k].resize(oldLength);
+        ThrowTypeError(TA_ERROR_STRING(wo->retCode).c_str());
+        DISPOSE_WORK_OBJECT(wo);
+        return;
+    }
+
+    // A series recomputed from its first bar replaces its outputs, and returns the ones of the new bars
+    series->length += count;
+    if (series->restart && count > 0) {
+        series->outBegIdx = wo->outBegIdx;
+        series->outNBElement = wo->outNBElement;
+        int skip = oldLength > wo->outBegIdx ? oldLength - wo->outBegIdx : 0;
+        if (skip > wo->outNBElement)
+            skip = wo->outNBElement;
+        for (int i=0; i < wo->nbOutput; i++) {
+            if (series->layout.outputs[i]->type == TA_Output_Integer) {
+                series->outInt[i].assign(wo->outInt[i], wo->outInt[i] + wo->outNBElement);
+                memmove(wo->outInt[i], wo->outInt[i] + skip, (wo->outNBElement - skip) * sizeof(int));
+            } else {
+                series->outReal[i].assign(wo->outReal[i], wo->outReal[i] + wo->outNBElement);
+                memmove(wo->outReal[i], wo->outReal[i] + skip, (wo->outNBElement - skip) * sizeof(double));
+            }
+        }
+        wo->outBegIdx += skip;
+        wo->outNBElement -= skip;
+        if (wo->outNBElement == 0)
+            wo->outBegIdx = 0;
+    }
+
+    // Keep the new outputs after the previous ones
+    else if (wo->outNBElement > 0) {
+        if (series->outNBElement == 0)
+            series->outBegIdx = wo->outBegIdx;
+        series->outNBElement += wo->outNBElement;
+        for (int i=0; i < wo->nbOutput; i++) {
+            if (series->layout.outputs[i]->type == TA_Output_Integer)
+                series->outInt[i].insert(series->outInt[i].end(), wo->outInt[i], wo->outInt[i] + wo->outNBElement);
+            else
+                series->outReal[i].insert(series->outReal[i].end(), wo->outReal[i], wo->outReal[i] + wo->outNBElement);
+        }
+    }
+    Set(info.Holder(), Nan::New<String>("length").ToLocalChecked(), Nan::New<Number>(series->length));
+
+    // Return the outputs of the appended bars
+    info.GetReturnValue().Set(generateResult(wo));
+    DISPOSE_WORK_OBJECT(wo);
+}
+
+NAN_METHOD(SeriesFunction::Result) {
+
+    // Series
+    SeriesFunction *series = ObjectWrap::Unwrap<SeriesFunction>(info.Holder());
+
+    // Output mode
+    bool typedOutput;
+    std::string error;
+    if (!READ_OUTPUT_MODE(info[0], &typedOutput, error)) {
+        ThrowTypeError(error.c_str());
+        return;
+    }
+
+    // Copy the outputs kept so far in a work object, as execute over the whole series returns them
+    work_object *wo = new work_object();
+    wo->func_handle = (TA_FuncHandle *)series->layout.func_handle;
+    wo->retCode = TA_SUCCESS;
+    wo->outBegIdx = series->outBegIdx;
+    wo->outNBElement = series->outNBElement;
+    wo->typedOutput = typedOutput;
+    wo->callerOutput = false;
+    wo->sharedParams = true;
+    wo->sharedContext = true;
+    wo->nbOutput = series->layout.outputs.size();
+    wo->outReal = new double*[wo->nbOutput]();
+    wo->outInt = new int*[wo->nbOutput]();
+    for (int i=0; i < wo->nbOutput; i++) {
+        if (series->layout.outputs[i]->type == TA_Output_Integer) {
+            wo->outInt[i] = new int[series->outNBElement];
+            std::copy(series->outInt[i].begin(), series->outInt[i].end(), wo->outInt[i]);
+        } else {
+            wo->outReal[i] = new double[series->outNBElement];
+            std::copy(series->outReal[i].begin(), series->outReal[i].end(), wo->outReal[i]);
+        }
+    }
+
+    info.GetReturnValue().Set(generateResult(wo));
+    DISPOSE_WORK_OBJECT(wo);
+}
+
+NAN_METHOD(Series) {
+
+    // Create a series with the constructor passed as data
+    Local<Value> argv[1] = { info[0] };
+    Local<Object> series;
+    if (Nan::NewInstance(info.Data().As<Function>(), 1, argv).ToLocal(&series)) {
+        info.GetReturnValue().Set(series);
+    }
+}
+
+// Functions with an incremental stream
+enum stream_kind {
+    STREAM_EMA,
+    STREAM_DEMA,
+    STREAM_TEMA,
+    STREAM_T3,
+    STREAM_TRIX,
+    STREAM_RSI,
+    STREAM_ATR,
+    STREAM_NATR,
+    STREAM_PLUS_DM,
+    STREAM_MINUS_DM,
+    STREAM_PLUS_DI,
+    STREAM_MINUS_DI,
+    STREAM_DX,
+    STREAM_ADX,
+    STREAM_ADXR,
+    STREAM_HT_DCPERIOD,
+    STREAM_HT_DCPHASE,
+    STREAM_HT_PHASOR,
+    STREAM_HT_SINE,
+    STREAM_HT_TRENDLINE,
+    STREAM_HT_TRENDMODE,
+    STREAM_MAMA,
+    STREAM_HILBERT,
+    STREAM_SAR,
+    STREAM_SAREXT,
+    STREAM_CANDLES
+};
+
+static const struct {
+    const char *name;
+    stream_kind kind;
+} stream_functions[] = {
+    { "EMA", STREAM_EMA },
+    { "DEMA", STREAM_DEMA },
+    { "TEMA", STREAM_TEMA },
+    { "T3", STREAM_T3 },
+    { "TRIX", STREAM_TRIX },
+    { "RSI", STREAM_RSI },
+    { "ATR", STREAM_ATR },
+    { "NATR", STREAM_NATR },
+    { "PLUS_DM", STREAM_PLUS_DM },
+    { "MINUS_DM", STREAM_MINUS_DM },
+    { "PLUS_DI", STREAM_PLUS_DI },
+    { "MINUS_DI", STREAM_MINUS_DI },
+    { "DX", STREAM_DX },
+    { "ADX", STREAM_ADX },
+    { "ADXR", STREAM_ADXR },
+    { "HT_DCPERIOD", STREAM_HT_DCPERIOD },
+    { "HT_DCPHASE", STREAM_HT_DCPHASE },
+    { "HT_PHASOR", STREAM_HT_PHASOR },
+    { "HT_SINE", STREAM_HT_SINE },
+    { "HT_TRENDLINE", STREAM_HT_TRENDLINE },
+    { "HT_TRENDMODE", STREAM_HT_TRENDMODE },
+    { "MAMA", STREAM_MAMA },
+    { "HILBERT", STREAM_HILBERT },
+    { "SAR", STREAM_SAR },
+    { "SAREXT", STREAM_SAREXT },
+    { "CANDLES", STREAM_CANDLES }
+};
+
+// Incremental moving average stage, fed with the values emitted by the previous stage
+struct stream_stage {
+    int period;
+    int lookback;
+    double k;
+    bool metastock;
+    bool cascade;
+    int count;
+    double sum;
+    double value;
+};
+
+// Incremental Wilder smoothing of the price changes, directional movements and true range
+struct stream_wilder {
+    int period;
+    int adxLookback;
+    bool metastock;
+    double high;
+    double low;
+    double close;
+    double gain;
+    double loss;
+    double plusDM;
+    double minusDM;
+    double range;
+    double sum;
+    double adx;
+    double dx;
+};
+
+// Hilbert transform functions sharing the engine, in the order of the lookbacks and outputs of the engine
+static const struct {
+    const char *name;
+    TA_FuncUnstId unstId;
+    int lookback;
+} hilbert_functions[] = {
+    { "HT_DCPERIOD", TA_FUNC_UNST_HT_DCPERIOD, 32 },
+    { "HT_DCPHASE", TA_FUNC_UNST_HT_DCPHASE, 63 },
+    { "HT_PHASOR", TA_FUNC_UNST_HT_PHASOR, 32 },
+    { "HT_SINE", TA_FUNC_UNST_HT_SINE, 63 },
+    { "HT_TRENDLINE", TA_FUNC_UNST_HT_TRENDLINE, 63 },
+    { "HT_TRENDMODE", TA_FUNC_UNST_HT_TRENDMODE, 63 },
+    { "MAMA", TA_FUNC_UNST_MAMA, 32 }
+};
+
+// Outputs of the Hilbert engine, with the function each one belongs to
+static const struct {
+    const char *name;
+    int function;
+} hilbert_outputs[] = {
+    { "dcPeriod", 0 },
+    { "dcPhase", 1 },
+    { "inPhase", 2 },
+    { "quadrature", 2 },
+    { "sine", 3 },
+    { "leadSine", 3 },
+    { "trendline", 4 },
+    { "trendMode", 5 },
+    { "mama", 6 },
+    { "fama", 6 }
+};
+
+#define HILBERT_PRICE_SIZE 50
+#define HILBERT_NB_OUTPUT 10
+
+// Detrender, Q1, jI and jQ pipeline of the Hilbert transform, with the cycle measures derived from it
+struct stream_hilbert_core {
+    bool active;
+    int start;
+    int hilbertIdx;
+    double odd[4][3];
+    double even[4][3];
+    double value[4];
+    double prevOdd[4];
+    double prevEven[4];
+    double prevInputOdd[4];
+    double prevInputEven[4];
+    double period;
+    double smoothPeriod;
+    double prevI2;
+    double prevQ2;
+    double re;
+    double im;
+    double I1ForOddPrev2;
+    double I1ForOddPrev3;
+    double I1ForEvenPrev2;
+    double I1ForEvenPrev3;
+    double inPhase;
+    double prevPhase;
+    double mama;
+    double fama;
+    double smoothPrice[HILBERT_PRICE_SIZE];
+    int smoothPriceIdx;
+    double dcPhase;
+    double sine;
+    double leadSine;
+    double iTrend[3];
+    double trendline;
+    int daysInTrend;
+    int trendMode;
+};
+
+// Price smoothing shared by the pipelines, the HT functions start the pipeline on bar 12 or 37 with lookback 32 or 63
+struct stream_hilbert {
+    double fastLimit;
+    double slowLimit;
+    double periodWMASub;
+    double periodWMASum;
+    double trailingWMAValue;
+    double prices[HILBERT_PRICE_SIZE];
+    int lookbacks[7];
+    stream_hilbert_core cores[2];
+};
+
+// Parabolic SAR position, with the SAREXT parameters SAR is a special case of
+struct stream_sar {
+    bool isLong;
+    bool signedShort;
+    double ep;
+    double sar;
+    double afLong;
+    double afShort;
+    double high;
+    double low;
+    double startValue;
+    double offsetOnReverse;
+    double initLong;
+    double accelerationLong;
+    double maxLong;
+    double initShort;
+    double accelerationShort;
+    double maxShort;
+};
+
+#define CANDLE_NB_PATTERN 61
+#define CANDLE_NB_SLOT 9
+#define CANDLE_MAX_TOTAL 152
+#define CANDLE_BAR_SIZE 7
+
+// Candlestick patterns of the engine, in the order of the table below
+enum candle_pattern {
+    CANDLE_2CROWS,
+    CANDLE_3BLACKCROWS,
+    CANDLE_3INSIDE,
+    CANDLE_3LINESTRIKE,
+    CANDLE_3OUTSIDE,
+    CANDLE_3STARSINSOUTH,
+    CANDLE_3WHITESOLDIERS,
+    CANDLE_ABANDONEDBABY,
+    CANDLE_ADVANCEBLOCK,
+    CANDLE_BELTHOLD,
+    CANDLE_BREAKAWAY,
+    CANDLE_CLOSINGMARUBOZU,
+    CANDLE_CONCEALBABYSWALL,
+    CANDLE_COUNTERATTACK,
+    CANDLE_DARKCLOUDCOVER,
+    CANDLE_DOJI,
+    CANDLE_DOJISTAR,
+    CANDLE_DRAGONFLYDOJI,
+    CANDLE_ENGULFING,
+    CANDLE_EVENINGDOJISTAR,
+    CANDLE_EVENINGSTAR,
+    CANDLE_GAPSIDESIDEWHITE,
+    CANDLE_GRAVESTONEDOJI,
+    CANDLE_HAMMER,
+    CANDLE_HANGINGMAN,
+    CANDLE_HARAMI,
+    CANDLE_HARAMICROSS,
+    CANDLE_HIGHWAVE,
+    CANDLE_HIKKAKE,
+    CANDLE_HIKKAKEMOD,
+    CANDLE_HOMINGPIGEON,
+    CANDLE_IDENTICAL3CROWS,
+    CANDLE_INNECK,
+    CANDLE_INVERTEDHAMMER,
+    CANDLE_KICKING,
+    CANDLE_KICKINGBYLENGTH,
+    CANDLE_LADDERBOTTOM,
+    CANDLE_LONGLEGGEDDOJI,
+    CANDLE_LONGLINE,
+    CANDLE_MARUBOZU,
+    CANDLE_MATCHINGLOW,
+    CANDLE_MATHOLD,
+    CANDLE_MORNINGDOJISTAR,
+    CANDLE_MORNINGSTAR,
+    CANDLE_ONNECK,
+    CANDLE_PIERCING,
+    CANDLE_RICKSHAWMAN,
+    CANDLE_RISEFALL3METHODS,
+    CANDLE_SEPARATINGLINES,
+    CANDLE_SHOOTINGSTAR,
+    CANDLE_SHORTLINE,
+    CANDLE_SPINNINGTOP,
+    CANDLE_STALLEDPATTERN,
+    CANDLE_STICKSANDWICH,
+    CANDLE_TAKURI,
+    CANDLE_TASUKIGAP,
+    CANDLE_THRUSTING,
+    CANDLE_TRISTAR,
+    CANDLE_UNIQUE3RIVER,
+    CANDLE_UPSIDEGAP2CROWS,
+    CANDLE_XSIDEGAP3METHODS
+};
+
+// Candlestick patterns with the candle setting and candle offset of every total they average, in the order they use them
+static const struct {
+    const char *name;
+    int nbTotal;
+    struct {
+        TA_CandleSettingType setting;
+        int offset;
+    } totals[CANDLE_NB_SLOT];
+} candle_patterns[] = {
+    { "CDL2CROWS", 1, { { TA_BodyLong, 2 } } },
+    { "CDL3BLACKCROWS", 3, { { TA_ShadowVeryShort, 2 }, { TA_ShadowVeryShort, 1 }, { TA_ShadowVeryShort, 0 } } },
+    { "CDL3INSIDE", 2, { { TA_BodyLong, 2 }, { TA_BodyShort, 1 } } },
+    { "CDL3LINESTRIKE", 2, { { TA_Near, 3 }, { TA_Near, 2 } } },
+    { "CDL3OUTSIDE", 0, { } },
+    { "CDL3STARSINSOUTH", 5, { { TA_BodyLong, 2 }, { TA_ShadowLong, 2 }, { TA_ShadowVeryShort, 1 }, { TA_BodyShort, 0 }, { TA_ShadowVeryShort, 0 } } },
+    { "CDL3WHITESOLDIERS", 8, { { TA_ShadowVeryShort, 2 }, { TA_ShadowVeryShort, 1 }, { TA_ShadowVeryShort, 0 }, { TA_Near, 2 }, { TA_Near, 1 }, { TA_Far, 2 }, { TA_Far, 1 }, { TA_BodyShort, 0 } } },
+    { "CDLABANDONEDBABY", 3, { { TA_BodyLong, 2 }, { TA_BodyDoji, 1 }, { TA_BodyShort, 0 } } },
+    { "CDLADVANCEBLOCK", 9, { { TA_Near, 2 }, { TA_Near, 1 }, { TA_BodyLong, 2 }, { TA_ShadowShort, 2 }, { TA_Far, 2 }, { TA_Far, 1 }, { TA_ShadowShort, 0 }, { TA_ShadowShort, 1 }, { TA_ShadowLong, 0 } } },
+    { "CDLBELTHOLD", 2, { { TA_BodyLong, 0 }, { TA_ShadowVeryShort, 0 } } },
+    { "CDLBREAKAWAY", 1, { { TA_BodyLong, 4 } } },
+    { "CDLCLOSINGMARUBOZU", 2, { { TA_BodyLong, 0 }, { TA_ShadowVeryShort, 0 } } },
+    { "CDLCONCEALBABYSWALL", 3, { { TA_ShadowVeryShort, 3 }, { TA_ShadowVeryShort, 2 }, { TA_ShadowVeryShort, 1 } } },
+    { "CDLCOUNTERATTACK", 3, { { TA_BodyLong, 1 }, { TA_BodyLong, 0 }, { TA_Equal, 1 } } },
+    { "CDLDARKCLOUDCOVER", 1, { { TA_BodyLong, 1 } } },
+    { "CDLDOJI", 1, { { TA_BodyDoji, 0 } } },
+    { "CDLDOJISTAR", 2, { { TA_BodyLong, 1 }, { TA_BodyDoji, 0 } } },
+    { "CDLDRAGONFLYDOJI", 2, { { TA_BodyDoji, 0 }, { TA_ShadowVeryShort, 0 } } },
+    { "CDLENGULFING", 0, { } },
+    { "CDLEVENINGDOJISTAR", 3, { { TA_BodyLong, 2 }, { TA_BodyDoji, 1 }, { TA_BodyShort, 0 } } },
+    { "CDLEVENINGSTAR", 3, { { TA_BodyLong, 2 }, { TA_BodyShort, 1 }, { TA_BodyShort, 0 } } },
+    { "CDLGAPSIDESIDEWHITE", 2, { { TA_Near, 1 }, { TA_Equal, 1 } } },
+    { "CDLGRAVESTONEDOJI", 2, { { TA_BodyDoji, 0 }, { TA_ShadowVeryShort, 0 } } },
+    { "CDLHAMMER", 4, { { TA_BodyShort, 0 }, { TA_ShadowLong, 0 }, { TA_ShadowVeryShort, 0 }, { TA_Near, 1 } } },
+    { "CDLHANGINGMAN", 4, { { TA_BodyShort, 0 }, { TA_ShadowLong, 0 }, { TA_ShadowVeryShort, 0 }, { TA_Near, 1 } } },
+    { "CDLHARAMI", 2, { { TA_BodyLong, 1 }, { TA_BodyShort, 0 } } },
+    { "CDLHARAMICROSS", 2, { { TA_BodyLong, 1 }, { TA_BodyDoji, 0 } } },
+    { "CDLHIGHWAVE", 2, { { TA_BodyShort, 0 }, { TA_ShadowVeryLong, 0 } } },
+    { "CDLHIKKAKE", 0, { } },
+    { "CDLHIKKAKEMOD", 1, { { TA_Near, 2 } } },
+    { "CDLHOMINGPIGEON", 2, { { TA_BodyLong, 1 }, { TA_BodyShort, 0 } } },
+    { "CDLIDENTICAL3CROWS", 5, { { TA_ShadowVeryShort, 2 }, { TA_ShadowVeryShort, 1 }, { TA_ShadowVeryShort, 0 }, { TA_Equal, 2 }, { TA_Equal, 1 } } },
+    { "CDLINNECK", 2, { { TA_BodyLong, 1 }, { TA_Equal, 1 } } },
+    { "CDLINVERTEDHAMMER", 3, { { TA_BodyShort, 0 }, { TA_ShadowLong, 0 }, { TA_ShadowVeryShort, 0 } } },
+    { "CDLKICKING", 4, { { TA_BodyLong, 1 }, { TA_ShadowVeryShort, 1 }, { TA_BodyLong, 0 }, { TA_ShadowVeryShort, 0 } } },
+    { "CDLKICKINGBYLENGTH", 4, { { TA_BodyLong, 1 }, { TA_ShadowVeryShort, 1 }, { TA_BodyLong, 0 }, { TA_ShadowVeryShort, 0 } } },
+    { "CDLLADDERBOTTOM", 1, { { TA_ShadowVeryShort, 1 } } },
+    { "CDLLONGLEGGEDDOJI", 2, { { TA_BodyDoji, 0 }, { TA_ShadowLong, 0 } } },
+    { "CDLLONGLINE", 2, { { TA_BodyLong, 0 }, { TA_ShadowShort, 0 } } },
+    { "CDLMARUBOZU", 2, { { TA_BodyLong, 0 }, { TA_ShadowVeryShort, 0 } } },
+    { "CDLMATCHINGLOW", 1, { { TA_Equal, 1 } } },
+    { "CDLMATHOLD", 4, { { TA_BodyLong, 4 }, { TA_BodyShort, 3 }, { TA_BodyShort, 2 }, { TA_BodyShort, 1 } } },
+    { "CDLMORNINGDOJISTAR", 3, { { TA_BodyLong, 2 }, { TA_BodyDoji, 1 }, { TA_BodyShort, 0 } } },
+    { "CDLMORNINGSTAR", 3, { { TA_BodyLong, 2 }, { TA_BodyShort, 1 }, { TA_BodyShort, 0 } } },
+    { "CDLONNECK", 2, { { TA_BodyLong, 1 }, { TA_Equal, 1 } } },
+    { "CDLPIERCING", 2, { { TA_BodyLong, 1 }, { TA_BodyLong, 0 } } },
+    { "CDLRICKSHAWMAN", 3, { { TA_BodyDoji, 0 }, { TA_ShadowLong, 0 }, { TA_Near, 0 } } },
+    { "CDLRISEFALL3METHODS", 5, { { TA_BodyLong, 4 }, { TA_BodyShort, 3 }, { TA_BodyShort, 2 }, { TA_BodyShort, 1 }, { TA_BodyLong, 0 } } },
+    { "CDLSEPARATINGLINES", 3, { { TA_Equal, 1 }, { TA_BodyLong, 0 }, { TA_ShadowVeryShort, 0 } } },
+    { "CDLSHOOTINGSTAR", 3, { { TA_BodyShort, 0 }, { TA_ShadowLong, 0 }, { TA_ShadowVeryShort, 0 } } },
+    { "CDLSHORTLINE", 2, { { TA_BodyShort, 0 }, { TA_ShadowShort, 0 } } },
+    { "CDLSPINNINGTOP", 1, { { TA_BodyShort, 0 } } },
+    { "CDLSTALLEDPATTERN", 6, { { TA_BodyLong, 2 }, { TA_BodyLong, 1 }, { TA_ShadowVeryShort, 1 }, { TA_Near, 2 }, { TA_BodyShort, 0 }, { TA_Near, 1 } } },
+    { "CDLSTICKSANDWICH", 1, { { TA_Equal, 2 } } },
+    { "CDLTAKURI", 3, { { TA_BodyDoji, 0 }, { TA_ShadowVeryShort, 0 }, { TA_ShadowVeryLong, 0 } } },
+    { "CDLTASUKIGAP", 1, { { TA_Near, 1 } } },
+    { "CDLTHRUSTING", 2, { { TA_BodyLong, 1 }, { TA_Equal, 1 } } },
+    { "CDLTRISTAR", 1, { { TA_BodyDoji, 2 } } },
+    { "CDLUNIQUE3RIVER", 2, { { TA_BodyLong, 2 }, { TA_BodyShort, 0 } } },
+    { "CDLUPSIDEGAP2CROWS", 2, { { TA_BodyLong, 2 }, { TA_BodyShort, 1 } } },
+    { "CDLXSIDEGAP3METHODS", 0, { } }
+};
+
+// Candle setting captured when the engine is created
+struct candle_setting {
+    int rangeType;
+    int avgPeriod;
+    double factor;
+};
+
+// Rolling total of the ranges of a candle setting, shared by the patterns averaging the same candle from the same bar
+struct candle_total {
+    int setting;
+    int offset;
+    int start;
+    double sum;
+};
+
+// Candlestick engine, the bars with their ranges are kept in a ring in the history
+struct stream_candles {
+    int nbPattern;
+    int nbTotal;
+    int mask;
+    int patterns[CANDLE_NB_PATTERN];
+    int lookbacks[CANDLE_NB_PATTERN];
+    double penetrations[CANDLE_NB_PATTERN];
+    unsigned char slots[CANDLE_NB_PATTERN][CANDLE_NB_SLOT];
+    int patternIdx[CANDLE_NB_PATTERN];
+    int patternResult[CANDLE_NB_PATTERN];
+    candle_setting settings[TA_AllCandleSettings];
+    candle_total totals[CANDLE_MAX_TOTAL];
+};
+
+// Stages of the moving average family
+struct stream_average {
+    stream_stage stages[6];
+    double coefficients[4];
+};
+
+// Incremental state of a streamed function, plain data so it can be copied as is
+struct stream_state {
+    stream_kind kind;
+    int lookback;
+    int count;
+    union {
+        stream_average average;
+        stream_wilder wilder;
+        stream_hilbert hilbert;
+        stream_sar sar;
+        stream_candles candles;
+    };
+};
+
+static void STREAM_STAGE_INIT(stream_stage *stage, int period, int lookback, bool metastock, bool cascade) {
+
+    // Setup the stage with the ratio of TA_INT_EMA, or of the T3 cascade
+    stage->period = period;
+    stage->lookback = lookback;
+    stage->k = (double)2.0 / ((double)(period + 1));
+    stage->metastock = metastock;
+    stage->cascade = cascade;
+    stage->count = 0;
+    stage->sum = 0.0;
+    stage->value = 0.0;
+
+}
+
+static bool STREAM_STAGE_UPDATE(stream_stage *stage, double value) {
+
+    // The Metastock EMA starts from the first value, the others from the average of the first period
+    if (stage->metastock && stage->count == 0) {
+        stage->value = value;
+    } else if (!stage->metastock && stage->count < stage->period) {
+        stage->sum = (stage->count == 0 && stage->cascade) ? value : stage->sum + value;
+        if (stage->count == stage->period - 1)
+            stage->value = stage->sum / stage->period;
+    } else if (stage->cascade) {
+        stage->value = (stage->k * value) + ((1.0 - stage->k) * stage->value);
+    } else {
+        stage->value = ((value - stage->value) * stage->k) + stage->value;
+    }
+
+    // The stage emits once its lookback is consumed
+    stage->count++;
+    return stage->count > stage->lookback;
+}
+
+static bool STREAM_INIT(const char *name, const std::vector<opt_value> &optValues, stream_state *state, std::vector<double> &history, std::string &error) {
+
+    // Find the stream of the function
+    size_t f = 0;
+    while (f < sizeof(stream_functions) / sizeof(stream_functions[0]) && strcmp(name, stream_functions[f].name) != 0)
+        f++;
+    if (f == sizeof(stream_functions) / sizeof(stream_functions[0])) {
+        error = (std::string)("Function ") + name + (std::string)(" has no stream");
+        return false;
+    }
+
+    // Settings of the calling thread
+    bool metastock = TA_GetCompatibility() == TA_COMPATIBILITY_METASTOCK;
+    int period = optValues.empty() ? 0 : optValues[0].integer;
+    int emaLookback = period - 1 + TA_GetUnstablePeriod(TA_FUNC_UNST_EMA);
+
+    memset(state, 0, sizeof(stream_state));
+    state->kind = stream_functions[f].kind;
+    state->count = 0;
+
+    // Setup the stages the way the batch functions chain them
+    switch (state->kind) {
+        case STREAM_EMA:
+        case STREAM_DEMA:
+        case STREAM_TEMA:
+        case STREAM_TRIX:
+            for (int i=0; i < 3; i++) {
+                STREAM_STAGE_INIT(&state->average.stages[i], period, emaLookback, metastock, false);
+            }
+            break;
+        case STREAM_T3: {
+            for (int i=0; i < 6; i++) {
+                STREAM_STAGE_INIT(&state->average.stages[i], period, period - 1, false, true);
+            }
+            double vFactor = optValues[1].real;
+            double square = vFactor * vFactor;
+            state->average.coefficients[0] = -(square * vFactor);
+            state->average.coefficients[1] = 3.0 * (square - state->average.coefficients[0]);
+            state->average.coefficients[2] = -6.0 * square - 3.0 * (vFactor - state->average.coefficients[0]);
+            state->average.coefficients[3] = 1.0 + 3.0 * vFactor - state->average.coefficients[0] + 3.0 * square;
+            break;
+        }
+        case STREAM_HT_DCPERIOD:
+        case STREAM_HT_DCPHASE:
+        case STREAM_HT_PHASOR:
+        case STREAM_HT_SINE:
+        case STREAM_HT_TRENDLINE:
+        case STREAM_HT_TRENDMODE:
+        case STREAM_MAMA:
+        case STREAM_HILBERT: {
+            // Lookback of every function with its unstable period
+            stream_hilbert *h = &state->hilbert;
+            for (int i=0; i < 7; i++) {
+                h->lookbacks[i] = hilbert_functions[i].lookback + TA_GetUnstablePeriod(hilbert_functions[i].unstId);
+            }
+
+            // Run the pipelines the requested functions start with
+            bool early = state->kind == STREAM_HT_DCPERIOD || state->kind == STREAM_HT_PHASOR || state->kind == STREAM_MAMA;
+            h->cores[0].active = early || state->kind == STREAM_HILBERT;
+            h->cores[0].start = 12;
+            h->cores[1].active = !early;
+            h->cores[1].start = 37;
+            if (state->kind == STREAM_MAMA || state->kind == STREAM_HILBERT) {
+                h->fastLimit = optValues[0].real;
+                h->slowLimit = optValues[1].real;
+            }
+            break;
+        }
+        case STREAM_SAR: {
+            // SAR is a SAREXT with the same acceleration both ways, both limited to the maximum
+            stream_sar *p = &state->sar;
+            double acceleration = optValues[0].real > optValues[1].real ? optValues[1].real : optValues[0].real;
+            p->initLong = p->initShort = p->accelerationLong = p->accelerationShort = acceleration;
+            p->maxLong = p->maxShort = optValues[1].real;
+            break;
+        }
+        case STREAM_SAREXT: {
+            // Limit the accelerations to their maximum, as TA_SAREXT does
+            stream_sar *p = &state->sar;
+            p->signedShort = true;
+            p->startValue = optValues[0].real;
+            p->offsetOnReverse = optValues[1].real;
+            p->maxLong = optValues[4].real;
+            p->initLong = optValues[2].real > p->maxLong ? p->maxLong : optValues[2].real;
+            p->accelerationLong = optValues[3].real > p->maxLong ? p->maxLong : optValues[3].real;
+            p->maxShort = optValues[7].real;
+            p->initShort = optValues[5].real > p->maxShort ? p->maxShort : optValues[5].real;
+            p->accelerationShort = optValues[6].real > p->maxShort ? p->maxShort : optValues[6].real;
+            break;
+        }
+        default:
+            // Wilder smoothed functions, the metastock seeding only applies to the RSI without unstable period
+            state->wilder.period = period;
+            state->wilder.metastock = metastock && TA_GetUnstablePeriod(TA_FUNC_UNST_RSI) == 0;
+            state->wilder.adxLookback = (2 * period) + TA_GetUnstablePeriod(TA_FUNC_UNST_ADX) - 1;
+
+            // The ADXR averages the ADX with the one of period - 1 bars ago
+            if (state->kind == STREAM_ADXR)
+                history.assign(period, 0.0);
+            break;
+    }
+
+    return true;
+}
+
+static bool STREAM_IS_ZERO(double value) {
+    return -SWEEP_EPSILON < value && value < SWEEP_EPSILON;
+}
+
+static double STREAM_RSI_UPDATE(stream_wilder *w, int t, const double *inputs) {
+
+    // Gain and loss over the previous price, none on the first bar
+    double change = inputs[0] - w->close;
+    w->close = inputs[0];
+    if (t == 0) {
+        w->sum = inputs[0] - inputs[0];
+        return NAN;
+    }
+
+    // Average of the first period, then smoothed the way TA_RSI does
+    if (t <= w->period) {
+        if (change < 0)
+            w->loss -= change;
+        else
+            w->gain += change;
+
+        // Metastock outputs one bar early, assuming no change on the first bar
+        if (t == w->period - 1 && w->metastock) {
+            double gain = (w->gain + w->sum) / w->period;
+            double total = gain + (w->loss / w->period);
+            return STREAM_IS_ZERO(total) ? 0.0 : 100 * (gain / total);
+        }
+        if (t < w->period)
+            return NAN;
+        w->loss /= w->period;
+        w->gain /= w->period;
+    } else {
+        w->loss = (w->loss * (w->period - 1) + (change < 0 ? -change : 0.0)) / w->period;
+        w->gain = (w->gain * (w->period - 1) + (change < 0 ? 0.0 : change)) / w->period;
+    }
+
+    double total = w->gain + w->loss;
+    return STREAM_IS_ZERO(total) ? 0.0 : 100.0 * (w->gain / total);
+}
+
+static double STREAM_ATR_UPDATE(stream_wilder *w, int t, const double *inputs, bool normalized) {
+
+    // True range against the previous close, none on the first bar
+    double range = inputs[0] - inputs[1];
+    double other = std::fabs(w->close - inputs[0]);
+    if (other > range)
+        range = other;
+    other = std::fabs(inputs[1] - w->close);
+    if (other > range)
+        range = other;
+    w->close = inputs[2];
+    if (t == 0)
+        return NAN;
+
+    // A period of one is the true range itself
+    if (w->period <= 1)
+        return range;
+
+    // Simple average of the first period, then smoothed
+    if (t <= w->period) {
+        w->sum += range;
+        if (t < w->period)
+            return NAN;
+        w->range = w->sum / w->period;
+    } else {
+        w->range *= w->period - 1;
+        w->range += range;
+        w->range /= w->period;
+    }
+
+    if (!normalized)
+        return w->range;
+    return !STREAM_IS_ZERO(inputs[2]) ? (w->range / inputs[2]) * 100.0 : 0.0;
+}
+
+static double STREAM_DIRECTIONAL_UPDATE(stream_state *state, int t, const double *inputs, double *history) {
+
+    // Settings and smoothed sums
+    stream_wilder *w = &state->wilder;
+    int period = w->period;
+    stream_kind kind = state->kind;
+    bool ranged = kind != STREAM_PLUS_DM && kind != STREAM_MINUS_DM;
+
+    // Directional movements of the bar, and its true range when there is a close
+    double diffP = inputs[0] - w->high;
+    double diffM = w->low - inputs[1];
+    double range = 0.0;
+    if (ranged) {
+        range = inputs[0] - inputs[1];
+        double other = std::fabs(inputs[0] - w->close);
+        if (other > range)
+            range = other;
+        other = std::fabs(inputs[1] - w->close);
+        if (other > range)
+            range = other;
+        w->close = inputs[2];
+    }
+    w->high = inputs[0];
+    w->low = inputs[1];
+    if (t == 0)
+        return NAN;
+    bool plus = (diffP > 0) && (diffP > diffM);
+    bool minus = (diffM > 0) && (diffP < diffM);
+
+    // A period of one outputs the movement of the bar, relative to its range for the indicators
+    if (period <= 1) {
+        bool moved = (kind == STREAM_PLUS_DM || kind == STREAM_PLUS_DI) ? plus : minus;
+        double diff = (kind == STREAM_PLUS_DM || kind == STREAM_PLUS_DI) ? diffP : diffM;
+        if (!moved)
+            return 0.0;
+        if (!ranged)
+            return diff;
+        return STREAM_IS_ZERO(range) ? 0.0 : diff / range;
+    }
+
+    // Sum of the first period - 1 bars, then smoothed
+    if (t < period) {
+        if (minus)
+            w->minusDM += diffM;
+        else if (plus)
+            w->plusDM += diffP;
+        w->range += range;
+    } else {
+        w->minusDM = minus ? w->minusDM - (w->minusDM / period) + diffM : w->minusDM - (w->minusDM / period);
+        w->plusDM = plus ? w->plusDM - (w->plusDM / period) + diffP : w->plusDM - (w->plusDM / period);
+        w->range = w->range - (w->range / period) + range;
+    }
+
+    // Directional movements and indicators
+    switch (kind) {
+        case STREAM_PLUS_DM:
+            return w->plusDM;
+        case STREAM_MINUS_DM:
+            return w->minusDM;
+        case STREAM_PLUS_DI:
+            return !STREAM_IS_ZERO(w->range) ? 100.0 * (w->plusDM / w->range) : 0.0;
+        case STREAM_MINUS_DI:
+            return !STREAM_IS_ZERO(w->range) ? 100.0 * (w->minusDM / w->range) : 0.0;
+        default:
+            break;
+    }
+    if (t < period)
+        return NAN;
+
+    // Directional index, left undefined when both indicators are zero
+    bool defined = false;
+    double dx = 0.0;
+    if (!STREAM_IS_ZERO(w->range)) {
+        double minusDI = 100.0 * (w->minusDM / w->range);
+        double plusDI = 100.0 * (w->plusDM / w->range);
+        double total = minusDI + plusDI;
+        if (!STREAM_IS_ZERO(total)) {
+            dx = 100.0 * (std::fabs(minusDI - plusDI) / total);
+            defined = true;
+        }
+    }
+
+    // The DX repeats its last output when undefined, starting from zero
+    if (kind == STREAM_DX) {
+        if (t >= state->lookback && defined)
+            w->dx = dx;
+        return w->dx;
+    }
+
+    // The ADX starts from the average DX of a period, then smoothes it
+    if (t < 2 * period) {
+        if (defined)
+            w->sum += dx;
+        if (t < 2 * period - 1)
+            return NAN;
+        w->adx = w->sum / period;
+    } else if (defined) {
+        w->adx = ((w->adx * (period - 1)) + dx) / period;
+    }
+    if (kind == STREAM_ADX || t < w->adxLookback)
+        return w->adx;
+
+    // The ADXR averages with the ADX of period - 1 bars ago, kept in a ring of the last period values
+    history[t % period] = w->adx;
+    if (t < w->adxLookback + period - 1)
+        return NAN;
+    return (w->adx + history[(t + 1) % period]) / 2.0;
+}
+
+// Sines and cosines of the dominant cycle phase sums, for every cycle period an HT function can measure
+struct hilbert_table {
+    double sine[HILBERT_PRICE_SIZE + 1][HILBERT_PRICE_SIZE];
+    double cosine[HILBERT_PRICE_SIZE + 1][HILBERT_PRICE_SIZE];
+    hilbert_table() {
+        double constDeg2RadBy360 = atan(1) * 8.0;
+        for (int n=1; n <= HILBERT_PRICE_SIZE; n++) {
+            for (int i=0; i < n; i++) {
+                double angle = ((double)i * constDeg2RadBy360) / (double)n;
+                sine[n][i] = sin(angle);
+                cosine[n][i] = cos(angle);
+            }
+        }
+    }
+};
+
+static void STREAM_HILBERT_TRANSFORM(stream_hilbert_core *core, int variable, double input, bool even, double adjustedPrevPeriod) {
+
+    // Odd or even delay line of the variable
+    double *delayed = even ? core->even[variable] : core->odd[variable];
+    double *prev = even ? &core->prevEven[variable] : &core->prevOdd[variable];
+    double *prevInput = even ? &core->prevInputEven[variable] : &core->prevInputOdd[variable];
+
+    // Same steps as DO_HILBERT_TRANSFORM
+    double hilbertTempReal = 0.0962 * input;
+    double value = -delayed[core->hilbertIdx];
+    delayed[core->hilbertIdx] = hilbertTempReal;
+    value += hilbertTempReal;
+    value -= *prev;
+    *prev = 0.5769 * *prevInput;
+    value += *prev;
+    *prevInput = input;
+    value *= adjustedPrevPeriod;
+    core->value[variable] = value;
+
+}
+
+static void STREAM_HILBERT_CORE_UPDATE(stream_hilbert *h, stream_hilbert_core *core, int t, double todayValue, double smoothedValue, bool late) {
+
+    // Conversions of the HT functions, the late ones compute them differently
+    static const double earlyRad2Deg = 180.0 / (4.0 * atan(1));
+    static const double lateRad2Deg = 45.0 / atan(1);
+    static const double deg2Rad = 1.0 / lateRad2Deg;
+    static const hilbert_table table;
+    double rad2Deg = late ? lateRad2Deg : earlyRad2Deg;
+
+    // Detrender, Q1, jI and jQ alternating between the odd and the even bars
+    double adjustedPrevPeriod = (0.075 * core->period) + 0.54;
+    double *value = core->value;
+    double Q2, I2;
+    if ((t % 2) == 0) {
+        STREAM_HILBERT_TRANSFORM(core, 0, smoothedValue, true, adjustedPrevPeriod);
+        STREAM_HILBERT_TRANSFORM(core, 1, value[0], true, adjustedPrevPeriod);
+        core->inPhase = core->I1ForEvenPrev3;
+        STREAM_HILBERT_TRANSFORM(core, 2, core->I1ForEvenPrev3, true, adjustedPrevPeriod);
+        STREAM_HILBERT_TRANSFORM(core, 3, value[1], true, adjustedPrevPeriod);
+        if (++core->hilbertIdx == 3)
+            core->hilbertIdx = 0;
+        Q2 = (0.2 * (value[1] + value[2])) + (0.8 * core->prevQ2);
+        I2 = (0.2 * (core->I1ForEvenPrev3 - value[3])) + (0.8 * core->prevI2);
+        core->I1ForOddPrev3 = core->I1ForOddPrev2;
+        core->I1ForOddPrev2 = value[0];
+    } else {
+        STREAM_HILBERT_TRANSFORM(core, 0, smoothedValue, false, adjustedPrevPeriod);
+        STREAM_HILBERT_TRANSFORM(core, 1, value[0], false, adjustedPrevPeriod);
+        core->inPhase = core->I1ForOddPrev3;
+        STREAM_HILBERT_TRANSFORM(core, 2, core->I1ForOddPrev3, false, adjustedPrevPeriod);
+        STREAM_HILBERT_TRANSFORM(core, 3, value[1], false, adjustedPrevPeriod);
+        Q2 = (0.2 * (value[1] + value[2])) + (0.8 * core->prevQ2);
+        I2 = (0.2 * (core->I1ForOddPrev3 - value[3])) + (0.8 * core->prevI2);
+        core->I1ForEvenPrev3 = core->I1ForEvenPrev2;
+        core->I1ForEvenPrev2 = value[0];
+    }
+
+    // MAMA adapts its ratio to the rate of change of the phase
+    if (!late) {
+        double phase = core->inPhase != 0.0 ? (atan(value[1] / core->inPhase) * rad2Deg) : 0.0;
+        double alpha = core->prevPhase - phase;
+        core->prevPhase = phase;
+        if (alpha < 1.0)
+            alpha = 1.0;
+        if (alpha > 1.0) {
+            alpha = h->fastLimit / alpha;
+            if (alpha < h->slowLimit)
+                alpha = h->slowLimit;
+        } else {
+            alpha = h->fastLimit;
+        }
+        core->mama = (alpha * todayValue) + ((1 - alpha) * core->mama);
+        alpha *= 0.5;
+        core->fama = (alpha * core->mama) + ((1 - alpha) * core->fama);
+    }
+
+    // Dominant cycle period, limited in its rate of change and range
+    core->re = (0.2 * ((I2 * core->prevI2) + (Q2 * core->prevQ2))) + (0.8 * core->re);
+    core->im = (0.2 * ((I2 * core->prevQ2) - (Q2 * core->prevI2))) + (0.8 * core->im);
+    core->prevQ2 = Q2;
+    core->prevI2 = I2;
+    double previous = core->period;
+    if ((core->im != 0.0) && (core->re != 0.0))
+        core->period = 360.0 / (atan(core->im / core->re) * rad2Deg);
+    if (core->period > 1.5 * previous)
+        core->period = 1.5 * previous;
+    if (core->period < 0.67 * previous)
+        core->period = 0.67 * previous;
+    if (core->period < 6)
+        core->period = 6;
+    else if (core->period > 50)
+        core->period = 50;
+    core->period = (0.2 * core->period) + (0.8 * previous);
+    core->smoothPeriod = (0.33 * core->period) + (0.67 * core->smoothPeriod);
+    if (!late)
+        return;
+
+    // Dominant cycle phase over the smoothed prices of one period
+    core->smoothPrice[core->smoothPriceIdx] = smoothedValue;
+    double prevDCPhase = core->dcPhase;
+    int DCPeriodInt = (int)(core->smoothPeriod + 0.5);
+    int nbPrice = DCPeriodInt > HILBERT_PRICE_SIZE ? HILBERT_PRICE_SIZE : DCPeriodInt;
+    double realPart = 0.0;
+    double imagPart = 0.0;
+    int idx = core->smoothPriceIdx;
+    for (int i=0; i < nbPrice; i++) {
+        realPart += table.sine[nbPrice][i] * core->smoothPrice[idx];
+        imagPart += table.cosine[nbPrice][i] * core->smoothPrice[idx];
+        idx = idx == 0 ? HILBERT_PRICE_SIZE - 1 : idx - 1;
+    }
+    if (std::fabs(imagPart) > 0.0) {
+        core->dcPhase = atan(realPart / imagPart) * rad2Deg;
+    } else if (std::fabs(imagPart) <= 0.01) {
+        if (realPart < 0.0)
+            core->dcPhase -= 90.0;
+        else if (realPart > 0.0)
+            core->dcPhase += 90.0;
+    }
+    core->dcPhase += 90.0;
+    core->dcPhase += 360.0 / core->smoothPeriod;
+    if (imagPart < 0.0)
+        core->dcPhase += 180.0;
+    if (core->dcPhase > 315.0)
+        core->dcPhase -= 360.0;
+
+    // Sine of the phase and the one leading by 45 degrees
+    double prevSine = core->sine;
+    double prevLeadSine = core->leadSine;
+    core->sine = sin(core->dcPhase * deg2Rad);
+    core->leadSine = sin((core->dcPhase + 45) * deg2Rad);
+
+    // Instantaneous trendline, the weighted average of the last period averages
+    double average = 0.0;
+    idx = t;
+    for (int i=0; i < nbPrice; i++) {
+        average += h->prices[(idx-- + HILBERT_PRICE_SIZE) % HILBERT_PRICE_SIZE];
+    }
+    if (DCPeriodInt > 0)
+        average = average / (double)DCPeriodInt;
+    core->trendline = (4.0 * average + 3.0 * core->iTrend[0] + 2.0 * core->iTrend[1] + core->iTrend[2]) / 10.0;
+    core->iTrend[2] = core->iTrend[1];
+    core->iTrend[1] = core->iTrend[0];
+    core->iTrend[0] = average;
+
+    // Trend unless the sines crossed within half a period, or the phase advances at the cycle rate
+    int trend = 1;
+    if (((core->sine > core->leadSine) && (prevSine <= prevLeadSine)) ||
+        ((core->sine < core->leadSine) && (prevSine >= prevLeadSine))) {
+        core->daysInTrend = 0;
+        trend = 0;
+    }
+    core->daysInTrend++;
+    if (core->daysInTrend < (0.5 * core->smoothPeriod))
+        trend = 0;
+    double advance = core->dcPhase - prevDCPhase;
+    if ((core->smoothPeriod != 0.0) &&
+        ((advance > (0.67 * 360.0 / core->smoothPeriod)) && (advance < (1.5 * 360.0 / core->smoothPeriod))))
+        trend = 0;
+    if ((core->trendline != 0.0) && (std::fabs((smoothedValue - core->trendline) / core->trendline) >= 0.015))
+        trend = 1;
+    core->trendMode = trend;
+    if (++core->smoothPriceIdx == HILBERT_PRICE_SIZE)
+        core->smoothPriceIdx = 0;
+
+}
+
+static void STREAM_HILBERT_UPDATE(stream_hilbert *h, int t, double value, double *outputs) {
+
+    // Weighted moving average of the last 4 prices, seeded by the first 3
+    double trailing = h->prices[(t + HILBERT_PRICE_SIZE - 3) % HILBERT_PRICE_SIZE];
+    h->prices[t % HILBERT_PRICE_SIZE] = value;
+    if (t < 3) {
+        h->periodWMASub = t == 0 ? value : h->periodWMASub + value;
+        h->periodWMASum = t == 0 ? value : h->periodWMASum + value * (double)(t + 1);
+        h->trailingWMAValue = 0.0;
+    } else {
+        h->periodWMASub += value;
+        h->periodWMASub -= h->trailingWMAValue;
+        h->periodWMASum += value * 4.0;
+        h->trailingWMAValue = trailing;
+        double smoothedValue = h->periodWMASum * 0.1;
+        h->periodWMASum -= h->periodWMASub;
+
+        // Advance the pipelines once they started
+        for (int i=0; i < 2; i++) {
+            if (h->cores[i].active && t >= h->cores[i].start)
+                STREAM_HILBERT_CORE_UPDATE(h, &h->cores[i], t, value, smoothedValue, i == 1);
+        }
+    }
+
+    // Outputs of the functions past their lookback, the phasor and MAMA from the early pipeline
+    const stream_hilbert_core *early = &h->cores[0];
+    const stream_hilbert_core *late = &h->cores[1];
+    double values[HILBERT_NB_OUTPUT] = { early->smoothPeriod, late->dcPhase, early->inPhase, early->value[1], late->sine, late->leadSine,
+                                         late->trendline, (double)late->trendMode, early->mama, early->fama };
+    for (int i=0; i < HILBERT_NB_OUTPUT; i++) {
+        outputs[i] = t >= h->lookbacks[hilbert_outputs[i].function] ? values[i] : NAN;
+    }
+
+}
+
+static bool STREAM_HILBERT_VALID(const stream_hilbert *h) {
+
+    // A saved engine must only index the delay lines and the ring of smoothed prices of its pipelines
+    for (int i=0; i < 2; i++) {
+        if (h->cores[i].hilbertIdx < 0 || h->cores[i].hilbertIdx >= 3 ||
+            h->cores[i].smoothPriceIdx < 0 || h->cores[i].smoothPriceIdx >= HILBERT_PRICE_SIZE)
+            return false;
+    }
+
+    return true;
+}
+
+static double STREAM_SAR_UPDATE(stream_sar *p, int t, const double *inputs) {
+
+    // Bar 0 only provides the previous high and low of bar 1
+    double newHigh = inputs[0];
+    double newLow = inputs[1];
+    double prevHigh = p->high;
+    double prevLow = p->low;
+    p->high = newHigh;
+    p->low = newLow;
+    if (t == 0)
+        return NAN;
+
+    // Bar 1 sets the position from its minus directional movement, or from the start value
+    if (t == 1) {
+        if (p->startValue == 0) {
+            double diffP = newHigh - prevHigh;
+            double diffM = prevLow - newLow;
+            p->isLong = !((diffM > 0) && (diffP < diffM));
+            p->sar = p->isLong ? prevLow : prevHigh;
+        } else {
+            p->isLong = p->startValue > 0;
+            p->sar = std::fabs(p->startValue);
+        }
+        p->ep = p->isLong ? newHigh : newLow;
+        p->afLong = p->initLong;
+        p->afShort = p->initShort;
+        prevHigh = newHigh;
+        prevLow = newLow;
+    }
+
+    // Reverse when the price crosses the stop, otherwise move the stop toward the extreme point
+    double result;
+    if (p->isLong) {
+        if (newLow <= p->sar) {
+            p->isLong = false;
+            p->sar = p->ep;
+            if (p->sar < prevHigh)
+                p->sar = prevHigh;
+            if (p->sar < newHigh)
+                p->sar = newHigh;
+            if (p->offsetOnReverse != 0.0)
+                p->sar += p->sar * p->offsetOnReverse;
+            result = p->signedShort ? -p->sar : p->sar;
+            p->afShort = p->initShort;
+            p->ep = newLow;
+            p->sar = p->sar + p->afShort * (p->ep - p->sar);
+            if (p->sar < prevHigh)
+                p->sar = prevHigh;
+            if (p->sar < newHigh)
+                p->sar = newHigh;
+        } else {
+            result = p->sar;
+            if (newHigh > p->ep) {
+                p->ep = newHigh;
+                p->afLong += p->accelerationLong;
+                if (p->afLong > p->maxLong)
+                    p->afLong = p->maxLong;
+            }
+            p->sar = p->sar + p->afLong * (p->ep - p->sar);
+            if (p->sar > prevLow)
+                p->sar = prevLow;
+            if (p->sar > newLow)
+                p->sar = newLow;
+        }
+    } else {
+        if (newHigh >= p->sar) {
+            p->isLong = true;
+            p->sar = p->ep;
+            if (p->sar > prevLow)
+                p->sar = prevLow;
+            if (p->sar > newLow)
+                p->sar = newLow;
+            if (p->offsetOnReverse != 0.0)
+                p->sar -= p->sar * p->offsetOnReverse;
+            result = p->sar;
+            p->afLong = p->initLong;
+            p->ep = newHigh;
+            p->sar = p->sar + p->afLong * (p->ep - p->sar);
+            if (p->sar > prevLow)
+                p->sar = prevLow;
+            if (p->sar > newLow)
+                p->sar = newLow;
+        } else {
+            result = p->signedShort ? -p->sar : p->sar;
+            if (newLow < p->ep) {
+                p->ep = newLow;
+                p->afShort += p->accelerationShort;
+                if (p->afShort > p->maxShort)
+                    p->afShort = p->maxShort;
+            }
+            p->sar = p->sar + p->afShort * (p->ep - p->sar);
+            if (p->sar < prevHigh)
+                p->sar = prevHigh;
+            if (p->sar < newHigh)
+                p->sar = newHigh;
+        }
+    }
+
+    return result;
+}
+
+// Values of the bar IDX and of its ranges, in the ring of bars
+#define CANDLE_BAR(IDX) (bars + ((IDX) & c->mask) * CANDLE_BAR_SIZE)
+#define CANDLE_OPEN(IDX) CANDLE_BAR(IDX)[0]
+#define CANDLE_HIGH(IDX) CANDLE_BAR(IDX)[1]
+#define CANDLE_LOW(IDX) CANDLE_BAR(IDX)[2]
+#define CANDLE_CLOSE(IDX) CANDLE_BAR(IDX)[3]
+#define CANDLE_REALBODY(IDX) CANDLE_BAR(IDX)[4 + TA_RangeType_RealBody]
+#define CANDLE_HIGHLOWRANGE(IDX) CANDLE_BAR(IDX)[4 + TA_RangeType_HighLow]
+#define CANDLE_UPPERSHADOW(IDX) (CANDLE_HIGH(IDX) - (CANDLE_CLOSE(IDX) >= CANDLE_OPEN(IDX) ? CANDLE_CLOSE(IDX) : CANDLE_OPEN(IDX)))
+#define CANDLE_LOWERSHADOW(IDX) ((CANDLE_CLOSE(IDX) >= CANDLE_OPEN(IDX) ? CANDLE_OPEN(IDX) : CANDLE_CLOSE(IDX)) - CANDLE_LOW(IDX))
+#define CANDLE_COLOR(IDX) (CANDLE_CLOSE(IDX) >= CANDLE_OPEN(IDX) ? 1 : -1)
+
+// Comparisons of the TA-Lib candle macros, which do not order NaN like std::max and std::min
+#define CANDLE_MAX(a, b) (((a) > (b)) ? (a) : (b))
+#define CANDLE_MIN(a, b) (((a) < (b)) ? (a) : (b))
+#define CANDLE_REALBODYGAPUP(IDX2, IDX1) (CANDLE_MIN(CANDLE_OPEN(IDX2), CANDLE_CLOSE(IDX2)) > CANDLE_MAX(CANDLE_OPEN(IDX1), CANDLE_CLOSE(IDX1)))
+#define CANDLE_REALBODYGAPDOWN(IDX2, IDX1) (CANDLE_MAX(CANDLE_OPEN(IDX2), CANDLE_CLOSE(IDX2)) < CANDLE_MIN(CANDLE_OPEN(IDX1), CANDLE_CLOSE(IDX1)))
+#define CANDLE_GAPUP(IDX2, IDX1) (CANDLE_LOW(IDX2) > CANDLE_HIGH(IDX1))
+#define CANDLE_GAPDOWN(IDX2, IDX1) (CANDLE_HIGH(IDX2) < CANDLE_LOW(IDX1))
+
+// Average of the total in the slot of the pattern, or the range of the candle itself without average period
+#define CANDLE_AVERAGE(SLOT, IDX) CANDLE_AVERAGE_OF(c, &c->totals[c->slots[j][SLOT]], CANDLE_BAR(IDX))
+
+static double CANDLE_AVERAGE_OF(const stream_candles *c, const candle_total *total, const double *bar) {
+    const candle_setting *setting = &c->settings[total->setting];
+    return setting->factor * (setting->avgPeriod != 0.0 ? total->sum / setting->avgPeriod : bar[4 + setting->rangeType]) /
+           (setting->rangeType == TA_RangeType_Shadows ? 2.0 : 1.0);
+}
+
+static bool STREAM_CANDLES_INIT(Local<Object> parameter, stream_state *state, std::vector<double> &history, std::string &error) {
+
+    // Engine state
+    stream_candles *c = &state->candles;
+    memset(state, 0, sizeof(stream_state));
+    state->kind = STREAM_CANDLES;
+
+    // Patterns given by function name, all of them by default
+    Local<String> patternsKey = New<String>("patterns").ToLocalChecked();
+    if (HasOwnProperty(parameter, patternsKey).FromJust()) {
+        Local<Value> value = Get(parameter, patternsKey).ToLocalChecked();
+        if (!value->IsArray() || value.As<Array>()->Length() == 0) {
+            error = "'patterns' must be an Array of candlestick function names";
+            return false;
+        }
+        Local<Array> names = value.As<Array>();
+        for (uint32_t i=0; i < names->Length(); i++) {
+            Nan::Utf8String name(Get(names, i).ToLocalChecked());
+            int p = 0;
+            while (p < CANDLE_NB_PATTERN && (*name == NULL || strcmp(*name, candle_patterns[p].name) != 0))
+                p++;
+            if (p == CANDLE_NB_PATTERN) {
+                error = (std::string)("Function ") + (*name ? *name : "") + (std::string)(" is not a candlestick pattern");
+                return false;
+            }
+            for (int j=0; j < c->nbPattern; j++) {
+                if (c->patterns[j] == p) {
+                    error = (std::string)("Pattern ") + *name + (std::string)(" is given twice");
+                    return false;
+                }
+            }
+            c->patterns[c->nbPattern++] = p;
+        }
+    } else {
+        for (int p=0; p < CANDLE_NB_PATTERN; p++) {
+            c->patterns[c->nbPattern++] = p;
+        }
+    }
+
+    // Penetration of the patterns having one, their own default otherwise
+    Local<String> penetrationKey = New<String>("optInPenetration").ToLocalChecked();
+    bool hasPenetration = HasOwnProperty(parameter, penetrationKey).FromJust();
+    opt_value penetration;
+    penetration.real = hasPenetration ? Get(parameter, penetrationKey).ToLocalChecked()->NumberValue(Nan::GetCurrentContext()).FromJust() : 0.0;
+
+    // Candle settings of the calling thread, the ring keeps the bars back to the longest average
+    int maxAvgPeriod = 0;
+    for (int s=0; s < TA_AllCandleSettings; s++) {
+        TA_RangeType rangeType;
+        TA_GetCandleSettings((TA_CandleSettingType)s, &rangeType, &c->settings[s].avgPeriod, &c->settings[s].factor);
+        c->settings[s].rangeType = rangeType;
+        if (c->settings[s].avgPeriod > maxAvgPeriod)
+            maxAvgPeriod = c->settings[s].avgPeriod;
+    }
+    int size = 8;
+    while (size < maxAvgPeriod + 5)
+        size <<= 1;
+    c->mask = size - 1;
+    history.assign(size * CANDLE_BAR_SIZE, 0.0);
+
+    for (int j=0; j < c->nbPattern; j++) {
+        int p = c->patterns[j];
+
+        // Lookback of the pattern with its penetration
+        TA_RetCode retCode;
+        const TA_FuncHandle *func_handle;
+        const TA_FuncInfo *func_info;
+        TA_ParamHolder *func_params;
+        if ((retCode = TA_GetFuncHandle(candle_patterns[p].name, &func_handle)) != TA_SUCCESS ||
+            (retCode = TA_GetFuncInfo(func_handle, &func_info)) != TA_SUCCESS ||
+            (retCode = TA_ParamHolderAlloc(func_handle, &func_params)) != TA_SUCCESS) {
+            error = TA_ERROR_STRING(retCode);
+            return false;
+        }
+        if (func_info->nbOptInput == 1) {
+            const TA_OptInputParameterInfo *opt_paraminfo;
+            TA_GetOptInputParameterInfo(func_handle, 0, &opt_paraminfo);
+            opt_value value = penetration;
+            if (!hasPenetration)
+                value.real = opt_paraminfo->defaultValue;
+            if (!OPT_VALUE_IN_RANGE(opt_paraminfo, value)) {
+                TA_ParamHolderFree(func_params);
+                error = (std::string)("Optional input '") + opt_paraminfo->paramName + (std::string)("': ") + TA_ERROR_STRING(TA_BAD_PARAM);
+                return false;
+            }
+            TA_SetOptInputParamReal(func_params, 0, value.real);
+            c->penetrations[j] = value.real;
+        }
+        retCode = TA_GetLookback(func_params, &c->lookbacks[j]);
+        TA_ParamHolderFree(func_params);
+        if (retCode != TA_SUCCESS) {
+            error = TA_ERROR_STRING(retCode);
+            return false;
+        }
+
+        // Share the totals of the patterns averaging the same candle from the same bar, the modified hikkake starts 3 bars early
+        int start = c->lookbacks[j] - (p == CANDLE_HIKKAKEMOD ? 3 : 0);
+        for (int n=0; n < candle_patterns[p].nbTotal; n++) {
+            int setting = candle_patterns[p].totals[n].setting;
+            int offset = candle_patterns[p].totals[n].offset;
+            int t = 0;
+            while (t < c->nbTotal && (c->totals[t].setting != setting || c->totals[t].offset != offset || c->totals[t].start != start))
+                t++;
+            if (t == c->nbTotal) {
+                c->totals[t].setting = setting;
+                c->totals[t].offset = offset;
+                c->totals[t].start = start;
+                c->nbTotal++;
+            }
+            c->slots[j][n] = t;
+        }
+    }
+
+    return true;
+}
+
+static bool STREAM_CANDLES_VALID(const stream_candles *c, size_t historySize) {
+
+    // A saved engine must only index its patterns, totals and ring of bars
+    if (c->nbPattern < 1 || c->nbPattern > CANDLE_NB_PATTERN || c->nbTotal < 0 || c->nbTotal > CANDLE_MAX_TOTAL ||
+        c->mask < 7 || c->mask > (1 << 24) || (c->mask & (c->mask + 1)) != 0 || historySize != (size_t)(c->mask + 1) * CANDLE_BAR_SIZE)
+        return false;
+    for (int s=0; s < TA_AllCandleSettings; s++) {
+        if (c->settings[s].rangeType < TA_RangeType_RealBody || c->settings[s].rangeType > TA_RangeType_Shadows ||
+            c->settings[s].avgPeriod < 0 || c->settings[s].avgPeriod + 5 > c->mask + 1)
+            return false;
+    }
+    for (int j=0; j < c->nbPattern; j++) {
+        if (c->patterns[j] < 0 || c->patterns[j] >= CANDLE_NB_PATTERN)
+            return false;
+        for (int n=0; n < candle_patterns[c->patterns[j]].nbTotal; n++) {
+            if (c->slots[j][n] >= c->nbTotal)
+                return false;
+        }
+    }
+    for (int t=0; t < c->nbTotal; t++) {
+        if (c->totals[t].setting < 0 || c->totals[t].setting >= TA_AllCandleSettings || c->totals[t].offset < 0 || c->totals[t].offset > 4)
+            return false;
+    }
+
+    return true;
+}
+
+static int STREAM_CANDLE_PATTERN(stream_candles *c, int j, int i, const double *bars) {
+
+    // Conditions of the TA-Lib functions on the bar i, the totals being the ones of the bar
+    double penetration = c->penetrations[j];
+    switch (c->patterns[j]) {
+        case CANDLE_2CROWS:
+            if (CANDLE_COLOR(i-2) == 1 &&
+                CANDLE_REALBODY(i-2) > CANDLE_AVERAGE(0, i-2) &&
+                CANDLE_COLOR(i-1) == -1 &&
+                CANDLE_REALBODYGAPUP(i-1,i-2) &&
+                CANDLE_COLOR(i) == -1 &&
+                CANDLE_OPEN(i) < CANDLE_OPEN(i-1) && CANDLE_OPEN(i) > CANDLE_CLOSE(i-1) &&
+                CANDLE_CLOSE(i) > CANDLE_OPEN(i-2) && CANDLE_CLOSE(i) < CANDLE_CLOSE(i-2)
+              )
+                return -100;
+            return 0;
+        case CANDLE_3BLACKCROWS:
+            if (CANDLE_COLOR(i-3) == 1 &&
+                CANDLE_COLOR(i-2) == -1 &&
+                CANDLE_LOWERSHADOW(i-2) < CANDLE_AVERAGE(0, i-2) &&
+                CANDLE_COLOR(i-1) == -1 &&
+                CANDLE_LOWERSHADOW(i-1) < CANDLE_AVERAGE(1, i-1) &&
+                CANDLE_COLOR(i) == -1 &&
+                CANDLE_LOWERSHADOW(i) < CANDLE_AVERAGE(2, i) &&
+                CANDLE_OPEN(i-1) < CANDLE_OPEN(i-2) && CANDLE_OPEN(i-1) > CANDLE_CLOSE(i-2) &&
+                CANDLE_OPEN(i) < CANDLE_OPEN(i-1) && CANDLE_OPEN(i) > CANDLE_CLOSE(i-1) &&
+                CANDLE_HIGH(i-3) > CANDLE_CLOSE(i-2) &&
+                CANDLE_CLOSE(i-2) > CANDLE_CLOSE(i-1) &&
+                CANDLE_CLOSE(i-1) > CANDLE_CLOSE(i)
+              )
+                return -100;
+            return 0;
+        case CANDLE_3INSIDE:
+            if (CANDLE_REALBODY(i-2) > CANDLE_AVERAGE(0, i-2) &&
+                CANDLE_REALBODY(i-1) <= CANDLE_AVERAGE(1, i-1) &&
+                CANDLE_MAX( CANDLE_CLOSE(i-1), CANDLE_OPEN(i-1) ) < CANDLE_MAX( CANDLE_CLOSE(i-2), CANDLE_OPEN(i-2) ) &&
+                CANDLE_MIN( CANDLE_CLOSE(i-1), CANDLE_OPEN(i-1) ) > CANDLE_MIN( CANDLE_CLOSE(i-2), CANDLE_OPEN(i-2) ) &&
+                ( ( CANDLE_COLOR(i-2) == 1 && CANDLE_COLOR(i) == -1 && CANDLE_CLOSE(i) < CANDLE_OPEN(i-2) )
+                  ||
+                  ( CANDLE_COLOR(i-2) == -1 && CANDLE_COLOR(i) == 1 && CANDLE_CLOSE(i) > CANDLE_OPEN(i-2) )
+                )
+              )
+                return -CANDLE_COLOR(i-2) * 100;
+            return 0;
+        case CANDLE_3LINESTRIKE:
+            if (CANDLE_COLOR(i-3) == CANDLE_COLOR(i-2) &&
+                CANDLE_COLOR(i-2) == CANDLE_COLOR(i-1) &&
+                CANDLE_COLOR(i) == -CANDLE_COLOR(i-1) &&
+                CANDLE_OPEN(i-2) >= CANDLE_MIN( CANDLE_OPEN(i-3), CANDLE_CLOSE(i-3) ) - CANDLE_AVERAGE(0, i-3) &&
+                CANDLE_OPEN(i-2) <= CANDLE_MAX( CANDLE_OPEN(i-3), CANDLE_CLOSE(i-3) ) + CANDLE_AVERAGE(0, i-3) &&
+                CANDLE_OPEN(i-1) >= CANDLE_MIN( CANDLE_OPEN(i-2), CANDLE_CLOSE(i-2) ) - CANDLE_AVERAGE(1, i-2) &&
+                CANDLE_OPEN(i-1) <= CANDLE_MAX( CANDLE_OPEN(i-2), CANDLE_CLOSE(i-2) ) + CANDLE_AVERAGE(1, i-2) &&
+                (
+                    (
+                        CANDLE_COLOR(i-1) == 1 &&
+                        CANDLE_CLOSE(i-1) > CANDLE_CLOSE(i-2) && CANDLE_CLOSE(i-2) > CANDLE_CLOSE(i-3) &&
+                        CANDLE_OPEN(i) > CANDLE_CLOSE(i-1) &&
+                        CANDLE_CLOSE(i) < CANDLE_OPEN(i-3)
+                    ) ||
+                    (
+                        CANDLE_COLOR(i-1) == -1 &&
+                        CANDLE_CLOSE(i-1) < CANDLE_CLOSE(i-2) && CANDLE_CLOSE(i-2) < CANDLE_CLOSE(i-3) &&
+                        CANDLE_OPEN(i) < CANDLE_CLOSE(i-1) &&
+                        CANDLE_CLOSE(i) > CANDLE_OPEN(i-3)
+                    )
+                )
+              )
+                return CANDLE_COLOR(i-1) * 100;
+            return 0;
+        case CANDLE_3OUTSIDE:
+            if (( CANDLE_COLOR(i-1) == 1 && CANDLE_COLOR(i-2) == -1 &&
+                  CANDLE_CLOSE(i-1) > CANDLE_OPEN(i-2) && CANDLE_OPEN(i-1) < CANDLE_CLOSE(i-2) &&
+                  CANDLE_CLOSE(i) > CANDLE_CLOSE(i-1)
+                )
+                ||
+                ( CANDLE_COLOR(i-1) == -1 && CANDLE_COLOR(i-2) == 1 &&
+                  CANDLE_OPEN(i-1) > CANDLE_CLOSE(i-2) && CANDLE_CLOSE(i-1) < CANDLE_OPEN(i-2) &&
+                  CANDLE_CLOSE(i) < CANDLE_CLOSE(i-1)
+                )
+              )
+                return CANDLE_COLOR(i-1) * 100;
+            return 0;
+        case CANDLE_3STARSINSOUTH:
+            if (CANDLE_COLOR(i-2) == -1 &&
+                CANDLE_COLOR(i-1) == -1 &&
+                CANDLE_COLOR(i) == -1 &&
+                CANDLE_REALBODY(i-2) > CANDLE_AVERAGE(0, i-2) &&
+                CANDLE_LOWERSHADOW(i-2) > CANDLE_AVERAGE(1, i-2) &&
+                CANDLE_REALBODY(i-1) < CANDLE_REALBODY(i-2) &&
+                CANDLE_OPEN(i-1) > CANDLE_CLOSE(i-2) && CANDLE_OPEN(i-1) <= CANDLE_HIGH(i-2) &&
+                CANDLE_LOW(i-1) < CANDLE_CLOSE(i-2) &&
+                CANDLE_LOW(i-1) >= CANDLE_LOW(i-2) &&
+                CANDLE_LOWERSHADOW(i-1) > CANDLE_AVERAGE(2, i-1) &&
+                CANDLE_REALBODY(i) < CANDLE_AVERAGE(3, i) &&
+                CANDLE_LOWERSHADOW(i) < CANDLE_AVERAGE(4, i) &&
+                CANDLE_UPPERSHADOW(i) < CANDLE_AVERAGE(4, i) &&
+                CANDLE_LOW(i) > CANDLE_LOW(i-1) && CANDLE_HIGH(i) < CANDLE_HIGH(i-1)
+              )
+                return 100;
+            return 0;
+        case CANDLE_3WHITESOLDIERS:
+            if (CANDLE_COLOR(i-2) == 1 &&
+                CANDLE_UPPERSHADOW(i-2) < CANDLE_AVERAGE(0, i-2) &&
+                CANDLE_COLOR(i-1) == 1 &&
+                CANDLE_UPPERSHADOW(i-1) < CANDLE_AVERAGE(1, i-1) &&
+                CANDLE_COLOR(i) == 1 &&
+                CANDLE_UPPERSHADOW(i) < CANDLE_AVERAGE(2, i) &&
+                CANDLE_CLOSE(i) > CANDLE_CLOSE(i-1) && CANDLE_CLOSE(i-1) > CANDLE_CLOSE(i-2) &&
+                CANDLE_OPEN(i-1) > CANDLE_OPEN(i-2) &&
+                CANDLE_OPEN(i-1) <= CANDLE_CLOSE(i-2) + CANDLE_AVERAGE(3, i-2) &&
+                CANDLE_OPEN(i) > CANDLE_OPEN(i-1) &&
+                CANDLE_OPEN(i) <= CANDLE_CLOSE(i-1) + CANDLE_AVERAGE(4, i-1) &&
+                CANDLE_REALBODY(i-1) > CANDLE_REALBODY(i-2) - CANDLE_AVERAGE(5, i-2) &&
+                CANDLE_REALBODY(i) > CANDLE_REALBODY(i-1) - CANDLE_AVERAGE(6, i-1) &&
+                CANDLE_REALBODY(i) > CANDLE_AVERAGE(7, i)
+              )
+                return 100;
+            return 0;
+        case CANDLE_ABANDONEDBABY:
+            if (CANDLE_REALBODY(i-2) > CANDLE_AVERAGE(0, i-2) &&
+                CANDLE_REALBODY(i-1) <= CANDLE_AVERAGE(1, i-1) &&
+                CANDLE_REALBODY(i) > CANDLE_AVERAGE(2, i) &&
+                ( ( CANDLE_COLOR(i-2) == 1 &&
+                    CANDLE_COLOR(i) == -1 &&
+                    CANDLE_CLOSE(i) < CANDLE_CLOSE(i-2) - CANDLE_REALBODY(i-2) * penetration &&
+                    CANDLE_GAPUP(i-1,i-2) &&
+                    CANDLE_GAPDOWN(i,i-1)
+                  )
+                  ||
+                  (
+                    CANDLE_COLOR(i-2) == -1 &&
+                    CANDLE_COLOR(i) == 1 &&
+                    CANDLE_CLOSE(i) > CANDLE_CLOSE(i-2) + CANDLE_REALBODY(i-2) * penetration &&
+                    CANDLE_GAPDOWN(i-1,i-2) &&
+                    CANDLE_GAPUP(i,i-1)
+                  )
+                )
+              )
+                return CANDLE_COLOR(i) * 100;
+            return 0;
+        case CANDLE_ADVANCEBLOCK:
+            if (CANDLE_COLOR(i-2) == 1 &&
+                CANDLE_COLOR(i-1) == 1 &&
+                CANDLE_COLOR(i) == 1 &&
+                CANDLE_CLOSE(i) > CANDLE_CLOSE(i-1) && CANDLE_CLOSE(i-1) > CANDLE_CLOSE(i-2) &&
+                CANDLE_OPEN(i-1) > CANDLE_OPEN(i-2) &&
+                CANDLE_OPEN(i-1) <= CANDLE_CLOSE(i-2) + CANDLE_AVERAGE(0, i-2) &&
+                CANDLE_OPEN(i) > CANDLE_OPEN(i-1) &&
+                CANDLE_OPEN(i) <= CANDLE_CLOSE(i-1) + CANDLE_AVERAGE(1, i-1) &&
+                CANDLE_REALBODY(i-2) > CANDLE_AVERAGE(2, i-2) &&
+                CANDLE_UPPERSHADOW(i-2) < CANDLE_AVERAGE(3, i-2) &&
+                (
+                    (
+                        CANDLE_REALBODY(i-1) < CANDLE_REALBODY(i-2) - CANDLE_AVERAGE(4, i-2) &&
+                        CANDLE_REALBODY(i) < CANDLE_REALBODY(i-1) + CANDLE_AVERAGE(1, i-1)
+                    ) ||
+                    (
+                        CANDLE_REALBODY(i) < CANDLE_REALBODY(i-1) - CANDLE_AVERAGE(5, i-1)
+                    ) ||
+                    (
+                        CANDLE_REALBODY(i) < CANDLE_REALBODY(i-1) &&
+                        CANDLE_REALBODY(i-1) < CANDLE_REALBODY(i-2) &&
+                        (
+                            CANDLE_UPPERSHADOW(i) > CANDLE_AVERAGE(6, i) ||
+                            CANDLE_UPPERSHADOW(i-1) > CANDLE_AVERAGE(7, i-1)
+                        )
+                    ) ||
+                    (
+                        CANDLE_REALBODY(i) < CANDLE_REALBODY(i-1) &&
+                        CANDLE_UPPERSHADOW(i) > CANDLE_AVERAGE(8, i)
+                    )
+                )
+              )
+                return -100;
+            return 0;
+        case CANDLE_BELTHOLD:
+            if (CANDLE_REALBODY(i) > CANDLE_AVERAGE(0, i) &&
+                (
+                  (
+                    CANDLE_COLOR(i) == 1 &&
+                    CANDLE_LOWERSHADOW(i) < CANDLE_AVERAGE(1, i)
+                  ) ||
+                  (
+                    CANDLE_COLOR(i) == -1 &&
+                    CANDLE_UPPERSHADOW(i) < CANDLE_AVERAGE(1, i)
+                  )
+                ) )
+                return CANDLE_COLOR(i) * 100;
+            return 0;
+        case CANDLE_BREAKAWAY:
+            if (CANDLE_REALBODY(i-4) > CANDLE_AVERAGE(0, i-4) &&
+                CANDLE_COLOR(i-4) == CANDLE_COLOR(i-3) &&
+                CANDLE_COLOR(i-3) == CANDLE_COLOR(i-1) &&
+                CANDLE_COLOR(i-1) == -CANDLE_COLOR(i) &&
+                (
+                  ( CANDLE_COLOR(i-4) == -1 &&
+                    CANDLE_REALBODYGAPDOWN(i-3,i-4) &&
+                    CANDLE_HIGH(i-2) < CANDLE_HIGH(i-3) && CANDLE_LOW(i-2) < CANDLE_LOW(i-3) &&
+                    CANDLE_HIGH(i-1) < CANDLE_HIGH(i-2) && CANDLE_LOW(i-1) < CANDLE_LOW(i-2) &&
+                    CANDLE_CLOSE(i) > CANDLE_OPEN(i-3) && CANDLE_CLOSE(i) < CANDLE_CLOSE(i-4)
+                  )
+                  ||
+                  ( CANDLE_COLOR(i-4) == 1 &&
+                    CANDLE_REALBODYGAPUP(i-3,i-4) &&
+                    CANDLE_HIGH(i-2) > CANDLE_HIGH(i-3) && CANDLE_LOW(i-2) > CANDLE_LOW(i-3) &&
+                    CANDLE_HIGH(i-1) > CANDLE_HIGH(i-2) && CANDLE_LOW(i-1) > CANDLE_LOW(i-2) &&
+                    CANDLE_CLOSE(i) < CANDLE_OPEN(i-3) && CANDLE_CLOSE(i) > CANDLE_CLOSE(i-4)
+                  )
+                )
+              )
+                return CANDLE_COLOR(i) * 100;
+            return 0;
+        case CANDLE_CLOSINGMARUBOZU:
+            if (CANDLE_REALBODY(i) > CANDLE_AVERAGE(0, i) &&
+                (
+                  (
+                    CANDLE_COLOR(i) == 1 &&
+                    CANDLE_UPPERSHADOW(i) < CANDLE_AVERAGE(1, i)
+                  ) ||
+                  (
+                    CANDLE_COLOR(i) == -1 &&
+                    CANDLE_LOWERSHADOW(i) < CANDLE_AVERAGE(1, i)
+                  )
+                ) )
+                return CANDLE_COLOR(i) * 100;
+            return 0;
+        case CANDLE_CONCEALBABYSWALL:
+            if (CANDLE_COLOR(i-3) == -1 &&
+                CANDLE_COLOR(i-2) == -1 &&
+                CANDLE_COLOR(i-1) == -1 &&
+                CANDLE_COLOR(i) == -1 &&
+                CANDLE_LOWERSHADOW(i-3) < CANDLE_AVERAGE(0, i-3) &&
+                CANDLE_UPPERSHADOW(i-3) < CANDLE_AVERAGE(0, i-3) &&
+                CANDLE_LOWERSHADOW(i-2) < CANDLE_AVERAGE(1, i-2) &&
+                CANDLE_UPPERSHADOW(i-2) < CANDLE_AVERAGE(1, i-2) &&
+                CANDLE_REALBODYGAPDOWN(i-1,i-2) &&
+                CANDLE_UPPERSHADOW(i-1) > CANDLE_AVERAGE(2, i-1) &&
+                CANDLE_HIGH(i-1) > CANDLE_CLOSE(i-2) &&
+                CANDLE_HIGH(i) > CANDLE_HIGH(i-1) && CANDLE_LOW(i) < CANDLE_LOW(i-1)
+              )
+                return 100;
+            return 0;
+        case CANDLE_COUNTERATTACK:
+            if (CANDLE_COLOR(i-1) == -CANDLE_COLOR(i) &&
+                CANDLE_REALBODY(i-1) > CANDLE_AVERAGE(0, i-1) &&
+                CANDLE_REALBODY(i) > CANDLE_AVERAGE(1, i) &&
+                CANDLE_CLOSE(i) <= CANDLE_CLOSE(i-1) + CANDLE_AVERAGE(2, i-1) &&
+                CANDLE_CLOSE(i) >= CANDLE_CLOSE(i-1) - CANDLE_AVERAGE(2, i-1)
+              )
+                return CANDLE_COLOR(i) * 100;
+            return 0;
+        case CANDLE_DARKCLOUDCOVER:
+            if (CANDLE_COLOR(i-1) == 1 &&
+                CANDLE_REALBODY(i-1) > CANDLE_AVERAGE(0, i-1) &&
+                CANDLE_COLOR(i) == -1 &&
+                CANDLE_OPEN(i) > CANDLE_HIGH(i-1) &&
+                CANDLE_CLOSE(i) > CANDLE_OPEN(i-1) &&
+                CANDLE_CLOSE(i) < CANDLE_CLOSE(i-1) - CANDLE_REALBODY(i-1) * penetration
+              )
+                return -100;
+            return 0;
+        case CANDLE_DOJI:
+            if (CANDLE_REALBODY(i) <= CANDLE_AVERAGE(0, i) )
+                return 100;
+            return 0;
+        case CANDLE_DOJISTAR:
+            if (CANDLE_REALBODY(i-1) > CANDLE_AVERAGE(0, i-1) &&
+                CANDLE_REALBODY(i) <= CANDLE_AVERAGE(1, i) &&
+                ( ( CANDLE_COLOR(i-1) == 1 && CANDLE_REALBODYGAPUP(i,i-1) )
+                    ||
+                  ( CANDLE_COLOR(i-1) == -1 && CANDLE_REALBODYGAPDOWN(i,i-1) )
+                ) )
+                return -CANDLE_COLOR(i-1) * 100;
+            return 0;
+        case CANDLE_DRAGONFLYDOJI:
+            if (CANDLE_REALBODY(i) <= CANDLE_AVERAGE(0, i) &&
+                CANDLE_UPPERSHADOW(i) < CANDLE_AVERAGE(1, i) &&
+                CANDLE_LOWERSHADOW(i) > CANDLE_AVERAGE(1, i)
+              )
+                return 100;
+            return 0;
+        case CANDLE_ENGULFING:
+            if (( CANDLE_COLOR(i) == 1 && CANDLE_COLOR(i-1) == -1 &&
+                  ( ( CANDLE_CLOSE(i) >= CANDLE_OPEN(i-1) && CANDLE_OPEN(i) < CANDLE_CLOSE(i-1) ) ||
+                    ( CANDLE_CLOSE(i) > CANDLE_OPEN(i-1) && CANDLE_OPEN(i) <= CANDLE_CLOSE(i-1) )
+                  )
+                )
+                ||
+                ( CANDLE_COLOR(i) == -1 && CANDLE_COLOR(i-1) == 1 &&
+                  ( ( CANDLE_OPEN(i) >= CANDLE_CLOSE(i-1) && CANDLE_CLOSE(i) < CANDLE_OPEN(i-1) ) ||
+                    ( CANDLE_OPEN(i) > CANDLE_CLOSE(i-1) && CANDLE_CLOSE(i) <= CANDLE_OPEN(i-1) )
+                  )
+                )
+              )
+                return CANDLE_COLOR(i) * ( CANDLE_OPEN(i) != CANDLE_CLOSE(i-1) && CANDLE_CLOSE(i) != CANDLE_OPEN(i-1) ? 100 : 80 );
+            return 0;
+        case CANDLE_EVENINGDOJISTAR:
+            if (CANDLE_REALBODY(i-2) > CANDLE_AVERAGE(0, i-2) &&
+                CANDLE_COLOR(i-2) == 1 &&
+                CANDLE_REALBODY(i-1) <= CANDLE_AVERAGE(1, i-1) &&
+                CANDLE_REALBODYGAPUP(i-1,i-2) &&
+                CANDLE_REALBODY(i) > CANDLE_AVERAGE(2, i) &&
+                CANDLE_COLOR(i) == -1 &&
+                CANDLE_CLOSE(i) < CANDLE_CLOSE(i-2) - CANDLE_REALBODY(i-2) * penetration
+              )
+                return -100;
+            return 0;
+        case CANDLE_EVENINGSTAR:
+            if (CANDLE_REALBODY(i-2) > CANDLE_AVERAGE(0, i-2) &&
+                CANDLE_COLOR(i-2) == 1 &&
+                CANDLE_REALBODY(i-1) <= CANDLE_AVERAGE(1, i-1) &&
+                CANDLE_REALBODYGAPUP(i-1,i-2) &&
+                CANDLE_REALBODY(i) > CANDLE_AVERAGE(2, i) &&
+                CANDLE_COLOR(i) == -1 &&
+                CANDLE_CLOSE(i) < CANDLE_CLOSE(i-2) - CANDLE_REALBODY(i-2) * penetration
+              )
+                return -100;
+            return 0;
+        case CANDLE_GAPSIDESIDEWHITE:
+            if (
+                (
+                  ( CANDLE_REALBODYGAPUP(i-1,i-2) && CANDLE_REALBODYGAPUP(i,i-2) )
+                  ||
+                  ( CANDLE_REALBODYGAPDOWN(i-1,i-2) && CANDLE_REALBODYGAPDOWN(i,i-2) )
+                ) &&
+                CANDLE_COLOR(i-1) == 1 &&
+                CANDLE_COLOR(i) == 1 &&
+                CANDLE_REALBODY(i) >= CANDLE_REALBODY(i-1) - CANDLE_AVERAGE(0, i-1) &&
+                CANDLE_REALBODY(i) <= CANDLE_REALBODY(i-1) + CANDLE_AVERAGE(0, i-1) &&
+                CANDLE_OPEN(i) >= CANDLE_OPEN(i-1) - CANDLE_AVERAGE(1, i-1) &&
+                CANDLE_OPEN(i) <= CANDLE_OPEN(i-1) + CANDLE_AVERAGE(1, i-1)
+              )
+                return ( CANDLE_REALBODYGAPUP(i-1,i-2) ? 100 : -100 );
+            return 0;
+        case CANDLE_GRAVESTONEDOJI:
+            if (CANDLE_REALBODY(i) <= CANDLE_AVERAGE(0, i) &&
+                CANDLE_LOWERSHADOW(i) < CANDLE_AVERAGE(1, i) &&
+                CANDLE_UPPERSHADOW(i) > CANDLE_AVERAGE(1, i)
+              )
+                return 100;
+            return 0;
+        case CANDLE_HAMMER:
+            if (CANDLE_REALBODY(i) < CANDLE_AVERAGE(0, i) &&
+                CANDLE_LOWERSHADOW(i) > CANDLE_AVERAGE(1, i) &&
+                CANDLE_UPPERSHADOW(i) < CANDLE_AVERAGE(2, i) &&
+                CANDLE_MIN( CANDLE_CLOSE(i), CANDLE_OPEN(i) ) <= CANDLE_LOW(i-1) + CANDLE_AVERAGE(3, i-1)
+              )
+                return 100;
+            return 0;
+        case CANDLE_HANGINGMAN:
+            if (CANDLE_REALBODY(i) < CANDLE_AVERAGE(0, i) &&
+                CANDLE_LOWERSHADOW(i) > CANDLE_AVERAGE(1, i) &&
+                CANDLE_UPPERSHADOW(i) < CANDLE_AVERAGE(2, i) &&
+                CANDLE_MIN( CANDLE_CLOSE(i), CANDLE_OPEN(i) ) >= CANDLE_HIGH(i-1) - CANDLE_AVERAGE(3, i-1)
+              )
+                return -100;
+            return 0;
+        case CANDLE_HARAMI:
+            if (CANDLE_REALBODY(i-1) > CANDLE_AVERAGE(0, i-1) &&
+                CANDLE_REALBODY(i) <= CANDLE_AVERAGE(1, i) ) {
+                if (CANDLE_MAX( CANDLE_CLOSE(i), CANDLE_OPEN(i) ) < CANDLE_MAX( CANDLE_CLOSE(i-1), CANDLE_OPEN(i-1) ) &&
+                     CANDLE_MIN( CANDLE_CLOSE(i), CANDLE_OPEN(i) ) > CANDLE_MIN( CANDLE_CLOSE(i-1), CANDLE_OPEN(i-1) )
+                   )
+                    return -CANDLE_COLOR(i-1) * 100;
+                if (CANDLE_MAX( CANDLE_CLOSE(i), CANDLE_OPEN(i) ) <= CANDLE_MAX( CANDLE_CLOSE(i-1), CANDLE_OPEN(i-1) ) &&
+                     CANDLE_MIN( CANDLE_CLOSE(i), CANDLE_OPEN(i) ) >= CANDLE_MIN( CANDLE_CLOSE(i-1), CANDLE_OPEN(i-1) )
+                   )
+                    return -CANDLE_COLOR(i-1) * 80;
+            }
+            return 0;
+        case CANDLE_HARAMICROSS:
+            if (CANDLE_REALBODY(i-1) > CANDLE_AVERAGE(0, i-1) &&
+                CANDLE_REALBODY(i) <= CANDLE_AVERAGE(1, i) ) {
+                if (CANDLE_MAX( CANDLE_CLOSE(i), CANDLE_OPEN(i) ) < CANDLE_MAX( CANDLE_CLOSE(i-1), CANDLE_OPEN(i-1) ) &&
+                     CANDLE_MIN( CANDLE_CLOSE(i), CANDLE_OPEN(i) ) > CANDLE_MIN( CANDLE_CLOSE(i-1), CANDLE_OPEN(i-1) )
+                   )
+                    return -CANDLE_COLOR(i-1) * 100;
+                if (CANDLE_MAX( CANDLE_CLOSE(i), CANDLE_OPEN(i) ) <= CANDLE_MAX( CANDLE_CLOSE(i-1), CANDLE_OPEN(i-1) ) &&
+                     CANDLE_MIN( CANDLE_CLOSE(i), CANDLE_OPEN(i) ) >= CANDLE_MIN( CANDLE_CLOSE(i-1), CANDLE_OPEN(i-1) )
+                   )
+                    return -CANDLE_COLOR(i-1) * 80;
+            }
+            return 0;
+        case CANDLE_HIGHWAVE:
+            if (CANDLE_REALBODY(i) < CANDLE_AVERAGE(0, i) &&
+                CANDLE_UPPERSHADOW(i) > CANDLE_AVERAGE(1, i) &&
+                CANDLE_LOWERSHADOW(i) > CANDLE_AVERAGE(1, i) )
+                return CANDLE_COLOR(i) * 100;
+            return 0;
+        case CANDLE_HIKKAKE: {
+            // The pattern is confirmed by a close beyond the 2nd candle up to 3 bars later
+            int &patternIdx = c->patternIdx[j];
+            int &patternResult = c->patternResult[j];
+            if (CANDLE_HIGH(i-1) < CANDLE_HIGH(i-2) && CANDLE_LOW(i-1) > CANDLE_LOW(i-2) &&
+                ( ( CANDLE_HIGH(i) < CANDLE_HIGH(i-1) && CANDLE_LOW(i) < CANDLE_LOW(i-1) )
+                  ||
+                  ( CANDLE_HIGH(i) > CANDLE_HIGH(i-1) && CANDLE_LOW(i) > CANDLE_LOW(i-1) )
+                )
+            ) {
+                patternResult = 100 * ( CANDLE_HIGH(i) < CANDLE_HIGH(i-1) ? 1 : -1 );
+                patternIdx = i;
+                return patternResult;
+            } else
+                if (i <= patternIdx+3 &&
+                    ( ( patternResult > 0 && CANDLE_CLOSE(i) > CANDLE_HIGH(patternIdx-1) )
+                      ||
+                      ( patternResult < 0 && CANDLE_CLOSE(i) < CANDLE_LOW(patternIdx-1) )
+                    )
+                ) {
+                    patternIdx = 0;
+                    return patternResult + 100 * ( patternResult > 0 ? 1 : -1 );
+                } else
+                    return 0;
+        }
+        case CANDLE_HIKKAKEMOD: {
+            // The pattern is confirmed by a close beyond the 3rd candle up to 3 bars later
+            int &patternIdx = c->patternIdx[j];
+            int &patternResult = c->patternResult[j];
+            if (CANDLE_HIGH(i-2) < CANDLE_HIGH(i-3) && CANDLE_LOW(i-2) > CANDLE_LOW(i-3) &&
+                CANDLE_HIGH(i-1) < CANDLE_HIGH(i-2) && CANDLE_LOW(i-1) > CANDLE_LOW(i-2) &&
+                ( ( CANDLE_HIGH(i) < CANDLE_HIGH(i-1) && CANDLE_LOW(i) < CANDLE_LOW(i-1) &&
+                    CANDLE_CLOSE(i-2) <= CANDLE_LOW(i-2) + CANDLE_AVERAGE(0, i-2)
+                  )
+                  ||
+                  ( CANDLE_HIGH(i) > CANDLE_HIGH(i-1) && CANDLE_LOW(i) > CANDLE_LOW(i-1) &&
+                    CANDLE_CLOSE(i-2) >= CANDLE_HIGH(i-2) - CANDLE_AVERAGE(0, i-2)
+                  )
+                )
+            ) {
+                patternResult = 100 * ( CANDLE_HIGH(i) < CANDLE_HIGH(i-1) ? 1 : -1 );
+                patternIdx = i;
+                return patternResult;
+            } else
+                if (i <= patternIdx+3 &&
+                    ( ( patternResult > 0 && CANDLE_CLOSE(i) > CANDLE_HIGH(patternIdx-1) )
+                      ||
+                      ( patternResult < 0 && CANDLE_CLOSE(i) < CANDLE_LOW(patternIdx-1) )
+                    )
+                ) {
+                    patternIdx = 0;
+                    return patternResult + 100 * ( patternResult > 0 ? 1 : -1 );
+                } else
+                    return 0;
+        }
+        case CANDLE_HOMINGPIGEON:
+            if (CANDLE_COLOR(i-1) == -1 &&
+                CANDLE_COLOR(i) == -1 &&
+                CANDLE_REALBODY(i-1) > CANDLE_AVERAGE(0, i-1) &&
+                CANDLE_REALBODY(i) <= CANDLE_AVERAGE(1, i) &&
+                CANDLE_OPEN(i) < CANDLE_OPEN(i-1) &&
+                CANDLE_CLOSE(i) > CANDLE_CLOSE(i-1)
+              )
+                return 100;
+            return 0;
+        case CANDLE_IDENTICAL3CROWS:
+            if (CANDLE_COLOR(i-2) == -1 &&
+                CANDLE_LOWERSHADOW(i-2) < CANDLE_AVERAGE(0, i-2) &&
+                CANDLE_COLOR(i-1) == -1 &&
+                CANDLE_LOWERSHADOW(i-1) < CANDLE_AVERAGE(1, i-1) &&
+                CANDLE_COLOR(i) == -1 &&
+                CANDLE_LOWERSHADOW(i) < CANDLE_AVERAGE(2, i) &&
+                CANDLE_CLOSE(i-2) > CANDLE_CLOSE(i-1) &&
+                CANDLE_CLOSE(i-1) > CANDLE_CLOSE(i) &&
+                CANDLE_OPEN(i-1) <= CANDLE_CLOSE(i-2) + CANDLE_AVERAGE(3, i-2) &&
+                CANDLE_OPEN(i-1) >= CANDLE_CLOSE(i-2) - CANDLE_AVERAGE(3, i-2) &&
+                CANDLE_OPEN(i) <= CANDLE_CLOSE(i-1) + CANDLE_AVERAGE(4, i-1) &&
+                CANDLE_OPEN(i) >= CANDLE_CLOSE(i-1) - CANDLE_AVERAGE(4, i-1)
+              )
+                return -100;
+            return 0;
+        case CANDLE_INNECK:
+            if (CANDLE_COLOR(i-1) == -1 &&
+                CANDLE_REALBODY(i-1) > CANDLE_AVERAGE(0, i-1) &&
+                CANDLE_COLOR(i) == 1 &&
+                CANDLE_OPEN(i) < CANDLE_LOW(i-1) &&
+                CANDLE_CLOSE(i) <= CANDLE_CLOSE(i-1) + CANDLE_AVERAGE(1, i-1) &&
+                CANDLE_CLOSE(i) >= CANDLE_CLOSE(i-1)
+              )
+                return -100;
+            return 0;
+        case CANDLE_INVERTEDHAMMER:
+            if (CANDLE_REALBODY(i) < CANDLE_AVERAGE(0, i) &&
+                CANDLE_UPPERSHADOW(i) > CANDLE_AVERAGE(1, i) &&
+                CANDLE_LOWERSHADOW(i) < CANDLE_AVERAGE(2, i) &&
+                CANDLE_REALBODYGAPDOWN(i, i-1) )
+                return 100;
+            return 0;
+        case CANDLE_KICKING:
+            if (CANDLE_COLOR(i-1) == -CANDLE_COLOR(i) &&
+                CANDLE_REALBODY(i-1) > CANDLE_AVERAGE(0, i-1) &&
+                CANDLE_UPPERSHADOW(i-1) < CANDLE_AVERAGE(1, i-1) &&
+                CANDLE_LOWERSHADOW(i-1) < CANDLE_AVERAGE(1, i-1) &&
+                CANDLE_REALBODY(i) > CANDLE_AVERAGE(2, i) &&
+                CANDLE_UPPERSHADOW(i) < CANDLE_AVERAGE(3, i) &&
+                CANDLE_LOWERSHADOW(i) < CANDLE_AVERAGE(3, i) &&
+                (
+                  ( CANDLE_COLOR(i-1) == -1 && CANDLE_GAPUP(i,i-1) )
+                  ||
+                  ( CANDLE_COLOR(i-1) == 1 && CANDLE_GAPDOWN(i,i-1) )
+                )
+              )
+                return CANDLE_COLOR(i) * 100;
+            return 0;
+        case CANDLE_KICKINGBYLENGTH:
+            if (CANDLE_COLOR(i-1) == -CANDLE_COLOR(i) &&
+                CANDLE_REALBODY(i-1) > CANDLE_AVERAGE(0, i-1) &&
+                CANDLE_UPPERSHADOW(i-1) < CANDLE_AVERAGE(1, i-1) &&
+                CANDLE_LOWERSHADOW(i-1) < CANDLE_AVERAGE(1, i-1) &&
+                CANDLE_REALBODY(i) > CANDLE_AVERAGE(2, i) &&
+                CANDLE_UPPERSHADOW(i) < CANDLE_AVERAGE(3, i) &&
+                CANDLE_LOWERSHADOW(i) < CANDLE_AVERAGE(3, i) &&
+                (
+                  ( CANDLE_COLOR(i-1) == -1 && CANDLE_GAPUP(i,i-1) )
+                  ||
+                  ( CANDLE_COLOR(i-1) == 1 && CANDLE_GAPDOWN(i,i-1) )
+                )
+              )
+                return CANDLE_COLOR( ( CANDLE_REALBODY(i) > CANDLE_REALBODY(i-1) ? i : i-1 ) ) * 100;
+            return 0;
+        case CANDLE_LADDERBOTTOM:
+            if (
+                CANDLE_COLOR(i-4) == -1 && CANDLE_COLOR(i-3) == -1 && CANDLE_COLOR(i-2) == -1 &&
+                CANDLE_OPEN(i-4) > CANDLE_OPEN(i-3) && CANDLE_OPEN(i-3) > CANDLE_OPEN(i-2) &&
+                CANDLE_CLOSE(i-4) > CANDLE_CLOSE(i-3) && CANDLE_CLOSE(i-3) > CANDLE_CLOSE(i-2) &&
+                CANDLE_COLOR(i-1) == -1 &&
+                CANDLE_UPPERSHADOW(i-1) > CANDLE_AVERAGE(0, i-1) &&
+                CANDLE_COLOR(i) == 1 &&
+                CANDLE_OPEN(i) > CANDLE_OPEN(i-1) &&
+                CANDLE_CLOSE(i) > CANDLE_HIGH(i-1)
+              )
+                return 100;
+            return 0;
+        case CANDLE_LONGLEGGEDDOJI:
+            if (CANDLE_REALBODY(i) <= CANDLE_AVERAGE(0, i) &&
+                ( CANDLE_LOWERSHADOW(i) > CANDLE_AVERAGE(1, i)
+                  ||
+                  CANDLE_UPPERSHADOW(i) > CANDLE_AVERAGE(1, i)
+                )
+              )
+                return 100;
+            return 0;
+        case CANDLE_LONGLINE:
+            if (CANDLE_REALBODY(i) > CANDLE_AVERAGE(0, i) &&
+                CANDLE_UPPERSHADOW(i) < CANDLE_AVERAGE(1, i) &&
+                CANDLE_LOWERSHADOW(i) < CANDLE_AVERAGE(1, i) )
+                return CANDLE_COLOR(i) * 100;
+            return 0;
+        case CANDLE_MARUBOZU:
+            if (CANDLE_REALBODY(i) > CANDLE_AVERAGE(0, i) &&
+                CANDLE_UPPERSHADOW(i) < CANDLE_AVERAGE(1, i) &&
+                CANDLE_LOWERSHADOW(i) < CANDLE_AVERAGE(1, i) )
+                return CANDLE_COLOR(i) * 100;
+            return 0;
+        case CANDLE_MATCHINGLOW:
+            if (CANDLE_COLOR(i-1) == -1 &&
+                CANDLE_COLOR(i) == -1 &&
+                CANDLE_CLOSE(i) <= CANDLE_CLOSE(i-1) + CANDLE_AVERAGE(0, i-1) &&
+                CANDLE_CLOSE(i) >= CANDLE_CLOSE(i-1) - CANDLE_AVERAGE(0, i-1)
+              )
+                return 100;
+            return 0;
+        case CANDLE_MATHOLD:
+            if (
+                CANDLE_REALBODY(i-4) > CANDLE_AVERAGE(0, i-4) &&
+                CANDLE_REALBODY(i-3) < CANDLE_AVERAGE(1, i-3) &&
+                CANDLE_REALBODY(i-2) < CANDLE_AVERAGE(2, i-2) &&
+                CANDLE_REALBODY(i-1) < CANDLE_AVERAGE(3, i-1) &&
+                CANDLE_COLOR(i-4) == 1 &&
+                CANDLE_COLOR(i-3) == -1 &&
+                CANDLE_COLOR(i) == 1 &&
+                CANDLE_REALBODYGAPUP(i-3,i-4) &&
+                CANDLE_MIN(CANDLE_OPEN(i-2), CANDLE_CLOSE(i-2)) < CANDLE_CLOSE(i-4) &&
+                CANDLE_MIN(CANDLE_OPEN(i-1), CANDLE_CLOSE(i-1)) < CANDLE_CLOSE(i-4) &&
+                CANDLE_MIN(CANDLE_OPEN(i-2), CANDLE_CLOSE(i-2)) > CANDLE_CLOSE(i-4) - CANDLE_REALBODY(i-4) * penetration &&
+                CANDLE_MIN(CANDLE_OPEN(i-1), CANDLE_CLOSE(i-1)) > CANDLE_CLOSE(i-4) - CANDLE_REALBODY(i-4) * penetration &&
+                CANDLE_MAX(CANDLE_CLOSE(i-2), CANDLE_OPEN(i-2)) < CANDLE_OPEN(i-3) &&
+                CANDLE_MAX(CANDLE_CLOSE(i-1), CANDLE_OPEN(i-1)) < CANDLE_MAX(CANDLE_CLOSE(i-2), CANDLE_OPEN(i-2)) &&
+                CANDLE_OPEN(i) > CANDLE_CLOSE(i-1) &&
+                CANDLE_CLOSE(i) > CANDLE_MAX(CANDLE_MAX(CANDLE_HIGH(i-3), CANDLE_HIGH(i-2)), CANDLE_HIGH(i-1))
+              )
+                return 100;
+            return 0;
+        case CANDLE_MORNINGDOJISTAR:
+            if (CANDLE_REALBODY(i-2) > CANDLE_AVERAGE(0, i-2) &&
+                CANDLE_COLOR(i-2) == -1 &&
+                CANDLE_REALBODY(i-1) <= CANDLE_AVERAGE(1, i-1) &&
+                CANDLE_REALBODYGAPDOWN(i-1,i-2) &&
+                CANDLE_REALBODY(i) > CANDLE_AVERAGE(2, i) &&
+                CANDLE_COLOR(i) == 1 &&
+                CANDLE_CLOSE(i) > CANDLE_CLOSE(i-2) + CANDLE_REALBODY(i-2) * penetration
+              )
+                return 100;
+            return 0;
+        case CANDLE_MORNINGSTAR:
+            if (CANDLE_REALBODY(i-2) > CANDLE_AVERAGE(0, i-2) &&
+                CANDLE_COLOR(i-2) == -1 &&
+                CANDLE_REALBODY(i-1) <= CANDLE_AVERAGE(1, i-1) &&
+                CANDLE_REALBODYGAPDOWN(i-1,i-2) &&
+                CANDLE_REALBODY(i) > CANDLE_AVERAGE(2, i) &&
+                CANDLE_COLOR(i) == 1 &&
+                CANDLE_CLOSE(i) > CANDLE_CLOSE(i-2) + CANDLE_REALBODY(i-2) * penetration
+              )
+                return 100;
+            return 0;
+        case CANDLE_ONNECK:
+            if (CANDLE_COLOR(i-1) == -1 &&
+                CANDLE_REALBODY(i-1) > CANDLE_AVERAGE(0, i-1) &&
+                CANDLE_COLOR(i) == 1 &&
+                CANDLE_OPEN(i) < CANDLE_LOW(i-1) &&
+                CANDLE_CLOSE(i) <= CANDLE_LOW(i-1) + CANDLE_AVERAGE(1, i-1) &&
+                CANDLE_CLOSE(i) >= CANDLE_LOW(i-1) - CANDLE_AVERAGE(1, i-1)
+              )
+                return -100;
+            return 0;
+        case CANDLE_PIERCING:
+            if (CANDLE_COLOR(i-1) == -1 &&
+                CANDLE_REALBODY(i-1) > CANDLE_AVERAGE(0, i-1) &&
+                CANDLE_COLOR(i) == 1 &&
+                CANDLE_REALBODY(i) > CANDLE_AVERAGE(1, i) &&
+                CANDLE_OPEN(i) < CANDLE_LOW(i-1) &&
+                CANDLE_CLOSE(i) < CANDLE_OPEN(i-1) &&
+                CANDLE_CLOSE(i) > CANDLE_CLOSE(i-1) + CANDLE_REALBODY(i-1) * 0.5
+              )
+                return 100;
+            return 0;
+        case CANDLE_RICKSHAWMAN:
+            if (CANDLE_REALBODY(i) <= CANDLE_AVERAGE(0, i) &&
+                CANDLE_LOWERSHADOW(i) > CANDLE_AVERAGE(1, i) &&
+                CANDLE_UPPERSHADOW(i) > CANDLE_AVERAGE(1, i) &&
+                (
+                    CANDLE_MIN( CANDLE_OPEN(i), CANDLE_CLOSE(i) )
+                        <= CANDLE_LOW(i) + CANDLE_HIGHLOWRANGE(i) / 2 + CANDLE_AVERAGE(2, i)
+                    &&
+                    CANDLE_MAX( CANDLE_OPEN(i), CANDLE_CLOSE(i) )
+                        >= CANDLE_LOW(i) + CANDLE_HIGHLOWRANGE(i) / 2 - CANDLE_AVERAGE(2, i)
+                )
+              )
+                return 100;
+            return 0;
+        case CANDLE_RISEFALL3METHODS:
+            if (
+                CANDLE_REALBODY(i-4) > CANDLE_AVERAGE(0, i-4) &&
+                CANDLE_REALBODY(i-3) < CANDLE_AVERAGE(1, i-3) &&
+                CANDLE_REALBODY(i-2) < CANDLE_AVERAGE(2, i-2) &&
+                CANDLE_REALBODY(i-1) < CANDLE_AVERAGE(3, i-1) &&
+                CANDLE_REALBODY(i)   > CANDLE_AVERAGE(4, i) &&
+                CANDLE_COLOR(i-4) == -CANDLE_COLOR(i-3) &&
+                CANDLE_COLOR(i-3) ==  CANDLE_COLOR(i-2) &&
+                CANDLE_COLOR(i-2) ==  CANDLE_COLOR(i-1) &&
+                CANDLE_COLOR(i-1) == -CANDLE_COLOR(i) &&
+                CANDLE_MIN(CANDLE_OPEN(i-3), CANDLE_CLOSE(i-3)) < CANDLE_HIGH(i-4) && CANDLE_MAX(CANDLE_OPEN(i-3), CANDLE_CLOSE(i-3)) > CANDLE_LOW(i-4) &&
+                CANDLE_MIN(CANDLE_OPEN(i-2), CANDLE_CLOSE(i-2)) < CANDLE_HIGH(i-4) && CANDLE_MAX(CANDLE_OPEN(i-2), CANDLE_CLOSE(i-2)) > CANDLE_LOW(i-4) &&
+                CANDLE_MIN(CANDLE_OPEN(i-1), CANDLE_CLOSE(i-1)) < CANDLE_HIGH(i-4) && CANDLE_MAX(CANDLE_OPEN(i-1), CANDLE_CLOSE(i-1)) > CANDLE_LOW(i-4) &&
+                CANDLE_CLOSE(i-2) * CANDLE_COLOR(i-4) < CANDLE_CLOSE(i-3) * CANDLE_COLOR(i-4) &&
+                CANDLE_CLOSE(i-1) * CANDLE_COLOR(i-4) < CANDLE_CLOSE(i-2) * CANDLE_COLOR(i-4) &&
+                CANDLE_OPEN(i) * CANDLE_COLOR(i-4) > CANDLE_CLOSE(i-1) * CANDLE_COLOR(i-4) &&
+                CANDLE_CLOSE(i) * CANDLE_COLOR(i-4) > CANDLE_CLOSE(i-4) * CANDLE_COLOR(i-4)
+              )
+                return 100 * CANDLE_COLOR(i-4);
+            return 0;
+        case CANDLE_SEPARATINGLINES:
+            if (CANDLE_COLOR(i-1) == -CANDLE_COLOR(i) &&
+                CANDLE_OPEN(i) <= CANDLE_OPEN(i-1) + CANDLE_AVERAGE(0, i-1) &&
+                CANDLE_OPEN(i) >= CANDLE_OPEN(i-1) - CANDLE_AVERAGE(0, i-1) &&
+                CANDLE_REALBODY(i) > CANDLE_AVERAGE(1, i) &&
+                (
+                  ( CANDLE_COLOR(i) == 1 &&
+                    CANDLE_LOWERSHADOW(i) < CANDLE_AVERAGE(2, i)
+                  )
+                  ||
+                  ( CANDLE_COLOR(i) == -1 &&
+                    CANDLE_UPPERSHADOW(i) < CANDLE_AVERAGE(2, i)
+                  )
+                )
+              )
+                return CANDLE_COLOR(i) * 100;
+            return 0;
+        case CANDLE_SHOOTINGSTAR:
+            if (CANDLE_REALBODY(i) < CANDLE_AVERAGE(0, i) &&
+                CANDLE_UPPERSHADOW(i) > CANDLE_AVERAGE(1, i) &&
+                CANDLE_LOWERSHADOW(i) < CANDLE_AVERAGE(2, i) &&
+                CANDLE_REALBODYGAPUP(i, i-1) )
+                return -100;
+            return 0;
+        case CANDLE_SHORTLINE:
+            if (CANDLE_REALBODY(i) < CANDLE_AVERAGE(0, i) &&
+                CANDLE_UPPERSHADOW(i) < CANDLE_AVERAGE(1, i) &&
+                CANDLE_LOWERSHADOW(i) < CANDLE_AVERAGE(1, i) )
+                return CANDLE_COLOR(i) * 100;
+            return 0;
+        case CANDLE_SPINNINGTOP:
+            if (CANDLE_REALBODY(i) < CANDLE_AVERAGE(0, i) &&
+                CANDLE_UPPERSHADOW(i) > CANDLE_REALBODY(i) &&
+                CANDLE_LOWERSHADOW(i) > CANDLE_REALBODY(i)
+              )
+                return CANDLE_COLOR(i) * 100;
+            return 0;
+        case CANDLE_STALLEDPATTERN:
+            if (CANDLE_COLOR(i-2) == 1 &&
+                CANDLE_COLOR(i-1) == 1 &&
+                CANDLE_COLOR(i) == 1 &&
+                CANDLE_CLOSE(i) > CANDLE_CLOSE(i-1) && CANDLE_CLOSE(i-1) > CANDLE_CLOSE(i-2) &&
+                CANDLE_REALBODY(i-2) > CANDLE_AVERAGE(0, i-2) &&
+                CANDLE_REALBODY(i-1) > CANDLE_AVERAGE(1, i-1) &&
+                CANDLE_UPPERSHADOW(i-1) < CANDLE_AVERAGE(2, i-1) &&
+                CANDLE_OPEN(i-1) > CANDLE_OPEN(i-2) &&
+                CANDLE_OPEN(i-1) <= CANDLE_CLOSE(i-2) + CANDLE_AVERAGE(3, i-2) &&
+                CANDLE_REALBODY(i) < CANDLE_AVERAGE(4, i) &&
+                CANDLE_OPEN(i) >= CANDLE_CLOSE(i-1) - CANDLE_REALBODY(i) - CANDLE_AVERAGE(5, i-1)
+              )
+                return -100;
+            return 0;
+        case CANDLE_STICKSANDWICH:
+            if (CANDLE_COLOR(i-2) == -1 &&
+                CANDLE_COLOR(i-1) == 1 &&
+                CANDLE_COLOR(i) == -1 &&
+                CANDLE_LOW(i-1) > CANDLE_CLOSE(i-2) &&
+                CANDLE_CLOSE(i) <= CANDLE_CLOSE(i-2) + CANDLE_AVERAGE(0, i-2) &&
+                CANDLE_CLOSE(i) >= CANDLE_CLOSE(i-2) - CANDLE_AVERAGE(0, i-2)
+              )
+                return 100;
+            return 0;
+        case CANDLE_TAKURI:
+            if (CANDLE_REALBODY(i) <= CANDLE_AVERAGE(0, i) &&
+                CANDLE_UPPERSHADOW(i) < CANDLE_AVERAGE(1, i) &&
+                CANDLE_LOWERSHADOW(i) > CANDLE_AVERAGE(2, i)
+              )
+                return 100;
+            return 0;
+        case CANDLE_TASUKIGAP:
+            if (
+                (
+                    CANDLE_REALBODYGAPUP(i-1,i-2) &&
+                    CANDLE_COLOR(i-1) == 1 &&
+                    CANDLE_COLOR(i) == -1 &&
+                    CANDLE_OPEN(i) < CANDLE_CLOSE(i-1) && CANDLE_OPEN(i) > CANDLE_OPEN(i-1) &&
+                    CANDLE_CLOSE(i) < CANDLE_OPEN(i-1) &&
+                    CANDLE_CLOSE(i) > CANDLE_MAX(CANDLE_CLOSE(i-2), CANDLE_OPEN(i-2)) &&
+                    fabs(CANDLE_REALBODY(i-1) - CANDLE_REALBODY(i)) < CANDLE_AVERAGE(0, i-1)
+                ) ||
+                (
+                    CANDLE_REALBODYGAPDOWN(i-1,i-2) &&
+                    CANDLE_COLOR(i-1) == -1 &&
+                    CANDLE_COLOR(i) == 1 &&
+                    CANDLE_OPEN(i) < CANDLE_OPEN(i-1) && CANDLE_OPEN(i) > CANDLE_CLOSE(i-1) &&
+                    CANDLE_CLOSE(i) > CANDLE_OPEN(i-1) &&
+                    CANDLE_CLOSE(i) < CANDLE_MIN(CANDLE_CLOSE(i-2), CANDLE_OPEN(i-2)) &&
+                    fabs(CANDLE_REALBODY(i-1) - CANDLE_REALBODY(i)) < CANDLE_AVERAGE(0, i-1)
+                )
+            )
+                return CANDLE_COLOR(i-1) * 100;
+            return 0;
+        case CANDLE_THRUSTING:
+            if (CANDLE_COLOR(i-1) == -1 &&
+                CANDLE_REALBODY(i-1) > CANDLE_AVERAGE(0, i-1) &&
+                CANDLE_COLOR(i) == 1 &&
+                CANDLE_OPEN(i) < CANDLE_LOW(i-1) &&
+                CANDLE_CLOSE(i) > CANDLE_CLOSE(i-1) + CANDLE_AVERAGE(1, i-1) &&
+                CANDLE_CLOSE(i) <= CANDLE_CLOSE(i-1) + CANDLE_REALBODY(i-1) * 0.5
+              )
+                return -100;
+            return 0;
+        case CANDLE_TRISTAR:
+            if (CANDLE_REALBODY(i-2) <= CANDLE_AVERAGE(0, i-2) &&
+                CANDLE_REALBODY(i-1) <= CANDLE_AVERAGE(0, i-2) &&
+                CANDLE_REALBODY(i) <= CANDLE_AVERAGE(0, i-2) ) {
+                if (CANDLE_REALBODYGAPUP(i-1,i-2)
+                     &&
+                     CANDLE_MAX(CANDLE_OPEN(i),CANDLE_CLOSE(i)) < CANDLE_MAX(CANDLE_OPEN(i-1),CANDLE_CLOSE(i-1))
+                   )
+                    return -100;
+                if (CANDLE_REALBODYGAPDOWN(i-1,i-2)
+                     &&
+                     CANDLE_MIN(CANDLE_OPEN(i),CANDLE_CLOSE(i)) > CANDLE_MIN(CANDLE_OPEN(i-1),CANDLE_CLOSE(i-1))
+                   )
+                    return +100;
+            }
+            return 0;
+        case CANDLE_UNIQUE3RIVER:
+            if (CANDLE_REALBODY(i-2) > CANDLE_AVERAGE(0, i-2) &&
+                CANDLE_COLOR(i-2) == -1 &&
+                CANDLE_COLOR(i-1) == -1 &&
+                CANDLE_CLOSE(i-1) > CANDLE_CLOSE(i-2) && CANDLE_OPEN(i-1) <= CANDLE_OPEN(i-2) &&
+                CANDLE_LOW(i-1) < CANDLE_LOW(i-2) &&
+                CANDLE_REALBODY(i) < CANDLE_AVERAGE(1, i) &&
+                CANDLE_COLOR(i) == 1 &&
+                CANDLE_OPEN(i) > CANDLE_LOW(i-1)
+              )
+                return 100;
+            return 0;
+        case CANDLE_UPSIDEGAP2CROWS:
+            if (CANDLE_COLOR(i-2) == 1 &&
+                CANDLE_REALBODY(i-2) > CANDLE_AVERAGE(0, i-2) &&
+                CANDLE_COLOR(i-1) == -1 &&
+                CANDLE_REALBODY(i-1) <= CANDLE_AVERAGE(1, i-1) &&
+                CANDLE_REALBODYGAPUP(i-1,i-2) &&
+                CANDLE_COLOR(i) == -1 &&
+                CANDLE_OPEN(i) > CANDLE_OPEN(i-1) && CANDLE_CLOSE(i) < CANDLE_CLOSE(i-1) &&
+                CANDLE_CLOSE(i) > CANDLE_CLOSE(i-2)
+              )
+                return -100;
+            return 0;
+        case CANDLE_XSIDEGAP3METHODS:
+            if (CANDLE_COLOR(i-2) == CANDLE_COLOR(i-1) &&
+                CANDLE_COLOR(i-1) == -CANDLE_COLOR(i) &&
+                CANDLE_OPEN(i) < CANDLE_MAX(CANDLE_CLOSE(i-1), CANDLE_OPEN(i-1)) &&
+                CANDLE_OPEN(i) > CANDLE_MIN(CANDLE_CLOSE(i-1), CANDLE_OPEN(i-1)) &&
+                CANDLE_CLOSE(i) < CANDLE_MAX(CANDLE_CLOSE(i-2), CANDLE_OPEN(i-2)) &&
+                CANDLE_CLOSE(i) > CANDLE_MIN(CANDLE_CLOSE(i-2), CANDLE_OPEN(i-2)) &&
+                ( (
+                    CANDLE_COLOR(i-2) == 1 &&
+                    CANDLE_REALBODYGAPUP(i-1,i-2)
+                  ) ||
+                  (
+                    CANDLE_COLOR(i-2) == -1 &&
+                    CANDLE_REALBODYGAPDOWN(i-1,i-2)
+                  )
+                )
+            )
+                return CANDLE_COLOR(i-2) * 100;
+            return 0;
+    }
+
+    return 0;
+}
+
+static void STREAM_CANDLES_UPDATE(stream_candles *c, int t, const double *inputs, double *outputs, double *bars) {
+
+    // Store the bar with its ranges, computed once for all the patterns
+    double *bar = CANDLE_BAR(t);
+    memcpy(bar, inputs, 4 * sizeof(double));
+    bar[4 + TA_RangeType_RealBody] = fabs(inputs[3] - inputs[0]);
+    bar[4 + TA_RangeType_HighLow] = inputs[1] - inputs[2];
+    bar[4 + TA_RangeType_Shadows] = CANDLE_UPPERSHADOW(t) + CANDLE_LOWERSHADOW(t);
+
+    // Recognize the patterns past their lookback, the hikkakes follow their pattern from 3 bars before
+    for (int j=0; j < c->nbPattern; j++) {
+        int warmup = (c->patterns[j] == CANDLE_HIKKAKE || c->patterns[j] == CANDLE_HIKKAKEMOD) ? 3 : 0;
+        outputs[j] = NAN;
+        if (t >= c->lookbacks[j] - warmup) {
+            int result = STREAM_CANDLE_PATTERN(c, j, t, bars);
+            if (t >= c->lookbacks[j])
+                outputs[j] = result;
+        }
+    }
+
+    // Sum the ranges of the bars before the start of every total, then roll it the way the functions do
+    for (int n=0; n < c->nbTotal; n++) {
+        candle_total *total = &c->totals[n];
+        const candle_setting *setting = &c->settings[total->setting];
+        int range = 4 + setting->rangeType;
+        if (t >= total->start)
+            total->sum += CANDLE_BAR(t - total->offset)[range] - CANDLE_BAR(t - setting->avgPeriod - total->offset)[range];
+        else if (t >= total->start - setting->avgPeriod - total->offset && t < total->start - total->offset)
+            total->sum += bar[range];
+    }
+
+}
+
+static void STREAM_UPDATE(stream_state *state, const double *inputs, double *outputs, double *history) {
+
+    // Stages of the function
+    stream_stage *s = state->average.stages;
+    double result = NAN;
+
+    // The candlestick engine outputs every pattern it recognizes
+    if (state->kind == STREAM_CANDLES) {
+        STREAM_CANDLES_UPDATE(&state->candles, state->count++, inputs, outputs, history);
+        return;
+    }
+
+    // The Hilbert transform functions pick their outputs among the ones of the engine
+    if (state->kind >= STREAM_HT_DCPERIOD && state->kind <= STREAM_HILBERT) {
+        double values[HILBERT_NB_OUTPUT];
+        STREAM_HILBERT_UPDATE(&state->hilbert, state->count++, inputs[0], values);
+        int first = 0;
+        int nbOutput = 1;
+        switch (state->kind) {
+            case STREAM_HT_DCPHASE: first = 1; break;
+            case STREAM_HT_PHASOR: first = 2; nbOutput = 2; break;
+            case STREAM_HT_SINE: first = 4; nbOutput = 2; break;
+            case STREAM_HT_TRENDLINE: first = 6; break;
+            case STREAM_HT_TRENDMODE: first = 7; break;
+            case STREAM_MAMA: first = 8; nbOutput = 2; break;
+            case STREAM_HILBERT: nbOutput = HILBERT_NB_OUTPUT; break;
+            default: break;
+        }
+        memcpy(outputs, values + first, nbOutput * sizeof(double));
+        return;
+    }
+
+    // Feed every stage with the values emitted by the previous one
+    switch (state->kind) {
+        case STREAM_EMA:
+            if (STREAM_STAGE_UPDATE(&s[0], inputs[0]))
+                result = s[0].value;
+            break;
+        case STREAM_DEMA:
+            if (STREAM_STAGE_UPDATE(&s[0], inputs[0]) && STREAM_STAGE_UPDATE(&s[1], s[0].value))
+                result = (2.0 * s[0].value) - s[1].value;
+            break;
+        case STREAM_TEMA:
+            if (STREAM_STAGE_UPDATE(&s[0], inputs[0]) && STREAM_STAGE_UPDATE(&s[1], s[0].value) && STREAM_STAGE_UPDATE(&s[2], s[1].value))
+                result = s[2].value + ((3.0 * s[0].value) - (3.0 * s[1].value));
+            break;
+        case STREAM_TRIX: {
+            // One period rate of change of the triple EMA
+            double previous = s[2].value;
+            if (STREAM_STAGE_UPDATE(&s[0], inputs[0]) && STREAM_STAGE_UPDATE(&s[1], s[0].value) && STREAM_STAGE_UPDATE(&s[2], s[1].value) &&
+                s[2].count > s[2].lookback + 1)
+                result = previous != 0.0 ? ((s[2].value / previous) - 1.0) * 100.0 : 0.0;
+            break;
+        }
+        case STREAM_T3: {
+            bool ready = STREAM_STAGE_UPDATE(&s[0], inputs[0]);
+            for (int i=1; i < 6 && ready; i++) {
+                ready = STREAM_STAGE_UPDATE(&s[i], s[i - 1].value);
+            }
+            if (ready)
+                result = state->average.coefficients[0] * s[5].value + state->average.coefficients[1] * s[4].value + state->average.coefficients[2] * s[3].value + state->average.coefficients[3] * s[2].value;
+            break;
+        }
+        case STREAM_RSI:
+            result = STREAM_RSI_UPDATE(&state->wilder, state->count, inputs);
+            break;
+        case STREAM_ATR:
+        case STREAM_NATR:
+            result = STREAM_ATR_UPDATE(&state->wilder, state->count, inputs, state->kind == STREAM_NATR);
+            break;
+        case STREAM_SAR:
+        case STREAM_SAREXT:
+            result = STREAM_SAR_UPDATE(&state->sar, state->count, inputs);
+            break;
+        default:
+            result = STREAM_DIRECTIONAL_UPDATE(state, state->count, inputs, history);
+            break;
+    }
+
+    // Values before the lookback of the function are not defined
+    state->count++;
+    outputs[0] = state->count > state->lookback ? result : NAN;
+
+}
+
+// Header of a saved stream, followed by the state and the history values
+struct stream_header {
+    char magic[4];
+    unsigned int version;
+    unsigned int stateSize;
+    unsigned int historySize;
+    char name[32];
+};
+
+static const char STREAM_MAGIC[4] = { 'T', 'A', 'S', 'T' };
+static const unsigned int STREAM_VERSION = 2;
+
+static size_t STREAM_STATE_SIZE(stream_kind kind) {
+
+    // The state is saved up to the end of the member of its kind, the union is as large as the candlestick engine
+    size_t size = offsetof(stream_state, average);
+    if (kind <= STREAM_TRIX)
+        return size + sizeof(stream_average);
+    if (kind <= STREAM_ADXR)
+        return size + sizeof(stream_wilder);
+    if (kind <= STREAM_HILBERT)
+        return size + sizeof(stream_hilbert);
+    if (kind <= STREAM_SAREXT)
+        return size + sizeof(stream_sar);
+    return size + sizeof(stream_candles);
+}
+
+static bool STREAM_READ(Local<Value> buffer, std::string &name, stream_state *state, std::vector<double> &history, std::string &error) {
+
+    // Check the saved stream
+    if (!node::Buffer::HasInstance(buffer)) {
+        error = "Saved stream must be a Buffer";
+        return false;
+    }
+    const char *data = node::Buffer::Data(buffer);
+    size_t length = node::Buffer::Length(buffer);
+    stream_header header;
+    if (length < sizeof(stream_header)) {
+        error = "Saved stream is truncated";
+        return false;
+    }
+    memcpy(&header, data, sizeof(stream_header));
+    if (memcmp(header.magic, STREAM_MAGIC, sizeof(STREAM_MAGIC)) != 0 || header.version != STREAM_VERSION || header.name[sizeof(header.name) - 1] != 0) {
+        error = "Saved stream was not created by this version";
+        return false;
+    }
+
+    // The state has the size of the kind of the function it was saved under
+    size_t f = 0;
+    while (f < sizeof(stream_functions) / sizeof(stream_functions[0]) && strcmp(header.name, stream_functions[f].name) != 0)
+        f++;
+    if (f == sizeof(stream_functions) / sizeof(stream_functions[0])) {
+        error = "Saved stream is corrupted";
+        return false;
+    }
+    if (header.stateSize != STREAM_STATE_SIZE(stream_functions[f].kind)) {
+        error = "Saved stream was not created by this version";
+        return false;
+    }
+    if (length != sizeof(stream_header) + header.stateSize + header.historySize * sizeof(double)) {
+        error = "Saved stream is truncated";
+        return false;
+    }
+
+    // Retreive the state, which must match the stream of the function
+    stream_state saved;
+    memset(&saved, 0, sizeof(stream_state));
+    memcpy(&saved, data + sizeof(stream_header), header.stateSize);
+
+    // The bar count and the members indexing an array are checked, the update functions trust them
+    bool valid = saved.kind == stream_functions[f].kind && saved.count >= 0;
+    if (valid && saved.kind <= STREAM_TRIX) {
+        for (int i=0; i < (saved.kind == STREAM_T3 ? 6 : 3); i++) {
+            valid = valid && saved.average.stages[i].count >= 0 && saved.average.stages[i].period >= 1;
+        }
+    } else if (valid && saved.kind <= STREAM_ADXR) {
+        valid = saved.wilder.period >= 1;
+    } else if (valid && saved.kind <= STREAM_HILBERT) {
+        valid = STREAM_HILBERT_VALID(&saved.hilbert);
+    }
+    if (valid && saved.kind == STREAM_ADXR)
+        valid = header.historySize == (unsigned int)saved.wilder.period;
+    else if (valid && saved.kind == STREAM_CANDLES)
+        valid = STREAM_CANDLES_VALID(&saved.candles, header.historySize);
+    else
+        valid = valid && header.historySize == 0;
+    if (!valid) {
+        error = "Saved stream is corrupted";
+        return false;
+    }
+    name = header.name;
+    *state = saved;
+    history.assign((const double *)(data + sizeof(stream_header) + header.stateSize), (const double *)(data + length));
+
+    return true;
+}
+
+class StreamFunction : public Nan::ObjectWrap {
+ public:
+  static NAN_METHOD(New);
+  static NAN_METHOD(Update);
+  static NAN_METHOD(Save);
+  static NAN_METHOD(Restore);
+
+ private:
+  StreamFunction(): nbValue(0) {}
+  ~StreamFunction() {}
+
+  // Count the values of an update and store the function information
+  void Describe(Local<Object> object);
+
+  // Name the stream is saved under
+  const char *Name();
+
+  // Function parameter layout
+  func_layout layout;
+
+  // Number of input values of an update
+  int nbValue;
+
+  // Incremental state
+  stream_state state;
+
+  // Past values some functions look back to
+  std::vector<double> history;
+};
+
+const char *StreamFunction::Name() {
+
+    // Engines are saved under their own name, the other streams under the one of their function
+    if (state.kind == STREAM_HILBERT)
+        return "HILBERT";
+    if (state.kind == STREAM_CANDLES)
+        return "CANDLES";
+    return layout.func_info->name;
+}
+
+void StreamFunction::Describe(Local<Object> object) {
+
+    // Function identifier
+    unsigned int func_id;
+
+    // Count the values of an update, one per price field or real input
+    nbValue = 0;
+    for (size_t i=0; i < layout.inputs.size(); i++) {
+        if (layout.inputs[i]->type != TA_Input_Price) {
+            nbValue++;
+            continue;
+        }
+        for (int p=0; p < 6; p++) {
+            if (layout.inputs[i]->flags & price_fields[p].flag)
+                nbValue++;
+        }
+    }
+
+    // The Hilbert engine describes the lookback of every function it outputs
+    if (state.kind == STREAM_HILBERT) {
+        Local<Object> lookbacks = Nan::New<Object>();
+        for (int i=0; i < 7; i++) {
+            Set(lookbacks, Nan::New<String>(hilbert_functions[i].name).ToLocalChecked(), Nan::New<Number>(state.hilbert.lookbacks[i]));
+        }
+        Set(object, Nan::New<String>("name").ToLocalChecked(), Nan::New<String>("HILBERT").ToLocalChecked());
+        Set(object, Nan::New<String>("lookback").ToLocalChecked(), Nan::New<Number>(state.lookback));
+        Set(object, Nan::New<String>("lookbacks").ToLocalChecked(), lookbacks);
+        return;
+    }
+
+    // The candlestick engine describes its patterns, in the order of the outputs, with their lookback
+    if (state.kind == STREAM_CANDLES) {
+        Local<Object> lookbacks = Nan::New<Object>();
+        Local<Array> patterns = Nan::New<Array>(state.candles.nbPattern);
+        for (int j=0; j < state.candles.nbPattern; j++) {
+            Local<String> name = Nan::New<String>(candle_patterns[state.candles.patterns[j]].name).ToLocalChecked();
+            Set(patterns, j, name);
+            Set(lookbacks, name, Nan::New<Number>(state.candles.lookbacks[j]));
+        }
+        Set(object, Nan::New<String>("name").ToLocalChecked(), Nan::New<String>("CANDLES").ToLocalChecked());
+        Set(object, Nan::New<String>("lookback").ToLocalChecked(), Nan::New<Number>(state.lookback));
+        Set(object, Nan::New<String>("lookbacks").ToLocalChecked(), lookbacks);
+        Set(object, Nan::New<String>("patterns").ToLocalChecked(), patterns);
+        return;
+    }
+
+    // Store the function information
+    Set(object, Nan::New<String>("name").ToLocalChecked(), Nan::New<String>(layout.func_info->name).ToLocalChecked());
+    Set(object, Nan::New<String>("lookback").ToLocalChecked(), Nan::New<Number>(state.lookback));
+    if (TA_GetFuncId(layout.func_handle, &func_id) == TA_SUCCESS)
+        Set(object, Nan::New<String>("id").ToLocalChecked(), Nan::New<Number>(func_id));
+
+}
+
+NAN_METHOD(StreamFunction::New) {
+
+    // Function parameter
+    Local<Object> functionParameter;
+
+    // Optional input parameter values
+    std::vector<opt_value> optValues;
+
+    // Settings context
+    TA_Context *context = NULL;
+
+    // Function lookback
+    int lookback = 0;
+
+    // Error message
+    std::string error;
+
+    // Return code
+    TA_RetCode retCode;
+
+    // Function parameter holder
+    TA_ParamHolder *func_params;
+
+    // Engine sharing its state between functions, given by name
+    std::string engine = info.Length() >= 3 && info[2]->IsString() ? *Nan::Utf8String(info[2]) : "";
+
+    // A saved stream resumes where it was saved, the engines with the layout of one of their functions
+    if (info.Length() >= 1 && node::Buffer::HasInstance(info[0])) {
+        StreamFunction *stream = new StreamFunction();
+        stream->Wrap(info.This());
+        std::string name;
+        const char *layoutName = name.c_str();
+        if (STREAM_READ(info[0], name, &stream->state, stream->history, error))
+            layoutName = stream->state.kind == STREAM_HILBERT ? "MAMA" : stream->state.kind == STREAM_CANDLES ? "CDLDOJI" : name.c_str();
+        if (!error.empty() || !LOAD_FUNCTION_LAYOUT(Nan::New<String>(layoutName).ToLocalChecked(), &stream->layout, error)) {
+            ThrowTypeError(error.c_str());
+            return;
+        }
+        if (!engine.empty() && engine != name) {
+            ThrowTypeError(((std::string)("Saved stream is one of ") + name).c_str());
+            return;
+        }
+        stream->Describe(info.This());
+        info.GetReturnValue().Set(info.This());
+        return;
+    }
+
+    // The function name is given either first or as field of the parameter object
+    if (info.Length() >= 1 && (info[0]->IsString() || info[0]->IsNumber())) {
+        Local<Object> name = Nan::New<Object>();
+        Set(name, Nan::New<String>("name").ToLocalChecked(), info[0]);
+        functionParameter = MERGE_PARAMETERS(info[1]->IsObject() ? info[1].As<Object>() : Nan::New<Object>(), name);
+    } else if (info.Length() >= 1 && info[0]->IsObject()) {
+        functionParameter = info[0].As<Object>();
+    } else {
+        ThrowTypeError("First argument must be the function name, or an Object with field name and the function optional input parameters");
+        return;
+    }
+
+    // Check the function name parameter
+    if (!HasOwnProperty(functionParameter, Nan::New<String>("name").ToLocalChecked()).FromJust()) {
+        ThrowTypeError("First argument must contain 'name' field");
+        return;
+    }
+
+    // Create the stream
+    StreamFunction *stream = new StreamFunction();
+    stream->Wrap(info.This());
+
+    // Resolve the function, its optional input parameters and its settings
+    if (!LOAD_FUNCTION_LAYOUT(Get(functionParameter, Nan::New<String>("name").ToLocalChecked()).ToLocalChecked(), &stream->layout, error) ||
+        !READ_OPT_INPUTS(functionParameter, &stream->layout, optValues, error) ||
+        !READ_CONTEXT(functionParameter, true, &context, error)) {
+        ThrowTypeError(error.c_str());
+        return;
+    }
+
+    // Check the optional inputs, the stream never calls the function
+    for (size_t i=0; i < optValues.size(); i++) {
+        if (!OPT_VALUE_IN_RANGE(stream->layout.optInputs[i], optValues[i])) {
+            TA_ContextFree(context);
+            error = (std::string)("Optional input '") + stream->layout.optInputs[i]->paramName + (std::string)("': ") + TA_ERROR_STRING(TA_BAD_PARAM);
+            ThrowTypeError(error.c_str());
+            return;
+        }
+    }
+
+    // Determine the lookback of the function with its settings
+    if ((retCode = TA_ParamHolderAlloc(stream->layout.func_handle, &func_params)) != TA_SUCCESS) {
+        TA_ContextFree(context);
+        ThrowTypeError(TA_ERROR_STRING(retCode).c_str());
+        return;
+    }
+    if (BIND_OPT_INPUTS(&stream->layout, optValues, func_params, error) &&
+        (retCode = CONTEXT_LOOKBACK(context, func_params, &lookback)) != TA_SUCCESS)
+        error = TA_ERROR_STRING(retCode);
+    TA_ParamHolderFree(func_params);
+
+    // Setup the incremental state with the settings captured now, the Hilbert engine with the MAMA parameters
+    TA_Context *previous = TA_GetThreadContext();
+    TA_SetThreadContext(context);
+    if (error.empty() && engine == "CANDLES")
+        STREAM_CANDLES_INIT(functionParameter, &stream->state, stream->history, error);
+    else if (error.empty())
+        STREAM_INIT(engine.empty() ? stream->layout.func_info->name : engine.c_str(), optValues, &stream->state, stream->history, error);
+    TA_SetThreadContext(previous);
+    TA_ContextFree(context);
+    if (!error.empty()) {
+        ThrowTypeError(error.c_str());
+        return;
+    }
+    stream->state.lookback = engine == "CANDLES" ? 0 : lookback;
+
+    // Every output of an engine is defined past the longest lookback
+    for (int i=0; engine == "HILBERT" && i < 7; i++) {
+        if (stream->state.hilbert.lookbacks[i] > stream->state.lookback)
+            stream->state.lookback = stream->state.hilbert.lookbacks[i];
+    }
+    for (int j=0; engine == "CANDLES" && j < stream->state.candles.nbPattern; j++) {
+        if (stream->state.candles.lookbacks[j] > stream->state.lookback)
+            stream->state.lookback = stream->state.candles.lookbacks[j];
+    }
+
+    // Store the function information
+    stream->Describe(info.This());
+
+    info.GetReturnValue().Set(info.This());
+}
+
+NAN_METHOD(StreamFunction::Update) {
+
+    // Stream
+    StreamFunction *stream = ObjectWrap::Unwrap<StreamFunction>(info.Holder());
+
+    // Input and output values of the bar
+    double inputs[8];
+    double outputs[CANDLE_NB_PATTERN];
+
+    // Check the input values
+    if (info.Length() < stream->nbValue) {
+        ThrowTypeError((std::to_string(stream->nbValue) + (std::string)(" input values required")).c_str());
+        return;
+    }
+    for (int i=0; i < stream->nbValue; i++) {
+        if (!info[i]->IsNumber()) {
+            ThrowTypeError("Input values must be Numbers");
+            return;
+        }
+        inputs[i] = info[i]->NumberValue(Nan::GetCurrentContext()).FromJust();
+    }
+
+    // Advance the state by one bar
+    STREAM_UPDATE(&stream->state, inputs, outputs, stream->history.data());
+
+    // Write the outputs in the Float64Array given after the input values
+    size_t nbOutput = stream->state.kind == STREAM_HILBERT ? HILBERT_NB_OUTPUT :
+                      stream->state.kind == STREAM_CANDLES ? stream->state.candles.nbPattern : stream->layout.outputs.size();
+    if (info.Length() > stream->nbValue && info[stream->nbValue]->IsFloat64Array()) {
+        Nan::TypedArrayContents<double> contents(info[stream->nbValue]);
+        if (contents.length() < nbOutput) {
+            ThrowTypeError((std::to_string(nbOutput) + (std::string)(" output values required")).c_str());
+            return;
+        }
+        memcpy(*contents, outputs, nbOutput * sizeof(double));
+        info.GetReturnValue().Set(info[stream->nbValue]);
+        return;
+    }
+
+    // Return the value of a single output function, or an Object keyed by output name
+    if (stream->state.kind == STREAM_HILBERT) {
+        Local<Object> result = Nan::New<Object>();
+        for (int i=0; i < HILBERT_NB_OUTPUT; i++) {
+            Set(result, Nan::New<String>(hilbert_outputs[i].name).ToLocalChecked(), Nan::New<Number>(outputs[i]));
+        }
+        info.GetReturnValue().Set(result);
+        return;
+    }
+    if (stream->state.kind == STREAM_CANDLES) {
+        Local<Object> result = Nan::New<Object>();
+        for (int j=0; j < stream->state.candles.nbPattern; j++) {
+            Set(result, Nan::New<String>(candle_patterns[stream->state.candles.patterns[j]].name).ToLocalChecked(), Nan::New<Number>(outputs[j]));
+        }
+        info.GetReturnValue().Set(result);
+        return;
+    }
+    if (stream->layout.outputs.size() == 1) {
+        info.GetReturnValue().Set(outputs[0]);
+        return;
+    }
+    Local<Object> result = Nan::New<Object>();
+    for (size_t i=0; i < stream->layout.outputs.size(); i++) {
+        Set(result, Nan::New<String>(stream->layout.outputs[i]->paramName).ToLocalChecked(), Nan::New<Number>(outputs[i]));
+    }
+    info.GetReturnValue().Set(result);
+}
+
+NAN_METHOD(StreamFunction::Save) {
+
+    // Stream
+    StreamFunction *stream = ObjectWrap::Unwrap<StreamFunction>(info.Holder());
+
+    // Header identifying the function and the layout of the state
+    stream_header header;
+    memset(&header, 0, sizeof(stream_header));
+    memcpy(header.magic, STREAM_MAGIC, sizeof(STREAM_MAGIC));
+    header.version = STREAM_VERSION;
+    header.stateSize = STREAM_STATE_SIZE(stream->state.kind);
+    header.historySize = stream->history.size();
+    strncpy(header.name, stream->Name(), sizeof(header.name) - 1);
+
+    // Copy the header, the state of the kind and the history in a single Buffer
+    std::vector<char> data(sizeof(stream_header) + header.stateSize + stream->history.size() * sizeof(double));
+    memcpy(data.data(), &header, sizeof(stream_header));
+    memcpy(data.data() + sizeof(stream_header), &stream->state, header.stateSize);
+    if (!stream->history.empty())
+        memcpy(data.data() + sizeof(stream_header) + header.stateSize, stream->history.data(), stream->history.size() * sizeof(double));
+    Local<Object> buffer;
+    if (Nan::CopyBuffer(data.data(), data.size()).ToLocal(&buffer))
+        info.GetReturnValue().Set(buffer);
+}
+
+NAN_METHOD(StreamFunction::Restore) {
+
+    // Stream
+    StreamFunction *stream = ObjectWrap::Unwrap<StreamFunction>(info.Holder());
+
+    // Saved state
+    stream_state state;
+    std::vector<double> history;
+    std::string name;
+    std::string error;
+
+    // Read the saved stream, which must be one of the same function
+    if (!STREAM_READ(info[0], name, &state, history, error)) {
+        ThrowTypeError(error.c_str());
+        return;
+    }
+    if (name != stream->Name()) {
+        ThrowTypeError(((std::string)("Saved stream is one of ") + name).c_str());
+        return;
+    }
+
+    // Rewind the stream, the lookbacks and the patterns may differ with the settings it was saved with
+    stream->state = state;
+    stream->history.swap(history);
+    stream->Describe(info.Holder());
+
+    info.GetReturnValue().Set(info.Holder());
+}
+
+NAN_METHOD(Stream) {
+
+    // Create a stream with the constructor passed as data
+    Local<Value> argv[2] = { info[0], info[1] };
+    Local<Object> stream;
+    if (Nan::NewInstance(info.Data().As<Function>(), 2, argv).ToLocal(&stream)) {
+        info.GetReturnValue().Set(stream);
+    }
+}
+
+NAN_METHOD(Hilbert) {
+
+    // Create the engine from a saved one, or from the MAMA parameters defaulting to the ones of TA-Lib and the context
+    Local<Value> argv[3] = { info[0], Nan::Undefined(), Nan::New<String>("HILBERT").ToLocalChecked() };
+    if (!node::Buffer::HasInstance(info[0])) {
+        Local<Object> defaults = Nan::New<Object>();
+        Set(defaults, Nan::New<String>("optInFastLimit").ToLocalChecked(), Nan::New<Number>(0.5));
+        Set(defaults, Nan::New<String>("optInSlowLimit").ToLocalChecked(), Nan::New<Number>(0.05));
+        Local<Object> name = Nan::New<Object>();
+        Set(name, Nan::New<String>("name").ToLocalChecked(), Nan::New<String>("MAMA").ToLocalChecked());
+        argv[0] = MERGE_PARAMETERS(MERGE_PARAMETERS(defaults, info[0]->IsObject() ? info[0].As<Object>() : Nan::New<Object>()), name);
+    }
+    Local<Object> engine;
+    if (Nan::NewInstance(info.Data().As<Function>(), 3, argv).ToLocal(&engine)) {
+        info.GetReturnValue().Set(engine);
+    }
+}
+
+NAN_METHOD(Candles) {
+
+    // Create the engine from a saved one, or from the patterns and penetration given with the layout of the candlestick functions
+    Local<Value> argv[3] = { info[0], Nan::Undefined(), Nan::New<String>("CANDLES").ToLocalChecked() };
+    if (!node::Buffer::HasInstance(info[0])) {
+        Local<Object> name = Nan::New<Object>();
+        Set(name, Nan::New<String>("name").ToLocalChecked(), Nan::New<String>("CDLDOJI").ToLocalChecked());
+        argv[0] = MERGE_PARAMETERS(info[0]->IsObject() ? info[0].As<Object>() : Nan::New<Object>(), name);
+    }
+    Local<Object> engine;
+    if (Nan::NewInstance(info.Data().As<Function>(), 3, argv).ToLocal(&engine)) {
+        info.GetReturnValue().Set(engine);
+    }
+}
+
+void Init(Local<Object> exports, Local<Context> context) {
+
+    // Initialize the engine
+    TA_Initialize();
+
+    // Define fields
+    Set(exports, New<String>("version").ToLocalChecked(), New<String>("1.1.6").ToLocalChecked());
+
+    // Define accessors
+    SetAccessor(exports, New<String>("functions").ToLocalChecked(), Functions);
+    SetAccessor(exports, New<String>("functionsByName").ToLocalChecked(), FunctionsByName);
+    SetAccessor(exports, New<String>("functionUnstIds").ToLocalChecked(), FunctionUnstIds);
+
+    // Define functions
+    Set(exports, New<String>("explain").ToLocalChecked(), GetFunction(New<FunctionTemplate>(Explain)).ToLocalChecked());
+    Set(exports, New<String>("execute").ToLocalChecked(), GetFunction(New<FunctionTemplate>(Execute)).ToLocalChecked());
+    Set(exports, New<String>("executeBatch").ToLocalChecked(), GetFunction(New<FunctionTemplate>(ExecuteBatch)).ToLocalChecked());
+    Set(exports, New<String>("executeGraph").ToLocalChecked(), GetFunction(New<FunctionTemplate>(ExecuteGraph)).ToLocalChecked());
+    Set(exports, New<String>("executePanel").ToLocalChecked(), GetFunction(New<FunctionTemplate>(ExecutePanel)).ToLocalChecked());
+    Set(exports, New<String>("sweep").ToLocalChecked(), GetFunction(New<FunctionTemplate>(Sweep)).ToLocalChecked());
+    Set(exports, New<String>("setPanelThreads").ToLocalChecked(), GetFunction(New<FunctionTemplate>(SetPanelThreads)).ToLocalChecked());
+    Set(exports, New<String>("setSimdLevel").ToLocalChecked(), GetFunction(New<FunctionTemplate>(SetSimdLevel)).ToLocalChecked());
+    Set(exports, New<String>("getSimdLevel").ToLocalChecked(), GetFunction(New<FunctionTemplate>(GetSimdLevel)).ToLocalChecked());
+    Set(exports, New<String>("setUnstablePeriod").ToLocalChecked(), GetFunction(New<FunctionTemplate>(SetUnstablePeriod)).ToLocalChecked());
+
+    // Define the prepared function class
+    Local<FunctionTemplate> prepared_template = New<FunctionTemplate>(PreparedFunction::New);
+    prepared_template->SetClassName(New<String>("PreparedFunction").ToLocalChecked());
+    prepared_template->InstanceTemplate()->SetInternalFieldCount(1);
+    Nan::SetPrototypeMethod(prepared_template, "execute", PreparedFunction::Execute);
+    Set(exports, New<String>("prepare").ToLocalChecked(), GetFunction(New<FunctionTemplate>(Prepare, GetFunction(prepared_template).ToLocalChecked())).ToLocalChecked());
+
+    // Define the series class
+    Local<FunctionTemplate> series_template = New<FunctionTemplate>(SeriesFunction::New);
+    series_template->SetClassName(New<String>("Series").ToLocalChecked());
+    series_template->InstanceTemplate()->SetInternalFieldCount(1);
+    Nan::SetPrototypeMethod(series_template, "append", SeriesFunction::Append);
+    Nan::SetPrototypeMethod(series_template, "result", SeriesFunction::Result);
+    Set(exports, New<String>("series").ToLocalChecked(), GetFunction(New<FunctionTemplate>(Series, GetFunction(series_template).ToLocalChecked())).ToLocalChecked());
+
+    // Define the stream class
+    Local<FunctionTemplate> stream_template = New<FunctionTemplate>(StreamFunction::New);
+    stream_template->SetClassName(New<String>("Stream").ToLocalChecked());
+    stream_template->InstanceTemplate()->SetInternalFieldCount(1);
+    Nan::SetPrototypeMethod(stream_template, "update", StreamFunction::Update);
+    Nan::SetPrototypeMethod(stream_template, "save", StreamFunction::Save);
+    Nan::SetPrototypeMethod(stream_template, "restore", StreamFunction::Restore);
+    Set(exports, New<String>("stream").ToLocalChecked(), GetFunction(New<FunctionTemplate>(Stream, GetFunction(stream_template).ToLocalChecked())).ToLocalChecked());
+    Set(exports, New<String>("hilbert").ToLocalChecked(), GetFunction(New<FunctionTemplate>(Hilbert, GetFunction(stream_template).ToLocalChecked())).ToLocalChecked());
+    Set(exports, New<String>("candles").ToLocalChecked(), GetFunction(New<FunctionTemplate>(Candles, GetFunction(stream_template).ToLocalChecked())).ToLocalChecked());
 }
 
 // https://github.com/schroffl/node-lzo/pull/11/files
@@ -18,6 +18,18 @@ describe('TALib Module', () => {
     assert.ok(talib.functions.length > 0);
   });
 
+  test('should serve functions from a frozen snapshot', () => {
+    assert.strictEqual(talib.functions, talib.functions);
+    assert.ok(Object.isFrozen(talib.functions));
+    assert.ok(Object.isFrozen(talib.functions[0].inputs));
+  });
+
+  test('should export functions keyed by name', () => {
+    const sma = talib.functionsByName.SMA;
+    assert.strictEqual(sma, talib.functions.find((func) => func.name === 'SMA'));
+    assert.strictEqual(Object.keys(talib.functionsByName).length, talib.functions.length);
+  });
+
   test('should export functionUnstIds', () => {
     assert.ok(talib.functionUnstIds);
     assert.strictEqual(typeof talib.functionUnstIds, 'object');
@@ -100,3 +112,934 @@ describe('TALib Functions', () => {
     assert.ok(result.result.outReal.length > 0);
   });
 });
+
+describe('TALib Typed Array Inputs', () => {
+  const data = [44, 44.34, 44.09, 43.61, 44.33, 44.83, 45.10, 45.42, 45.84, 46.08, 45.89, 46.03, 45.61, 46.28, 46.28];
+
+  test('should accept Float64Array inputs', () => {
+    const params = { name: 'SMA', startIdx: 0, endIdx: data.length - 1, optInTimePeriod: 5 };
+    const expected = talib.execute({ ...params, inReal: data });
+    const result = talib.execute({ ...params, inReal: new Float64Array(data) });
+
+    assert.deepStrictEqual(result, expected);
+  });
+
+  test('should accept ArrayBuffer and offset Float64Array price inputs', () => {
+    const high = data.map((v) => v + 1);
+    const low = data.map((v) => v - 1);
+    const params = { name: 'ATR', startIdx: 0, endIdx: data.length - 1, optInTimePeriod: 5 };
+    const expected = talib.execute({ ...params, high, low, close: data });
+
+    const padded = new Float64Array(data.length + 2);
+    padded.set(data, 2);
+    const result = talib.execute({
+      ...params,
+      high: new Float64Array(high).buffer,
+      low: new Float64Array(low),
+      close: padded.subarray(2)
+    });
+
+    assert.deepStrictEqual(result, expected);
+  });
+
+  test('should reject ArrayBuffer inputs holding a partial double', () => {
+    const buffer = new ArrayBuffer(data.length * 8 + 4);
+    const params = { name: 'SMA', startIdx: 0, endIdx: data.length - 1, optInTimePeriod: 5 };
+    assert.throws(() => talib.execute({ ...params, inReal: buffer }), /'inReal' must be an Array, Float64Array or ArrayBuffer/);
+    assert.throws(() => talib.executePanel({ name: 'SMA', optInTimePeriod: 5, series: [buffer] }), /'inReal' must be an Array, Float64Array or ArrayBuffer/);
+  });
+
+  test('should accept Float64Array inputs asynchronously', (t, done) => {
+    const params = { name: 'EMA', startIdx: 0, endIdx: data.length - 1, optInTimePeriod: 5 };
+    const expected = talib.execute({ ...params, inReal: data });
+    talib.execute({ ...params, inReal: new Float64Array(data) }, (err, result) => {
+      assert.ifError(err);
+      assert.deepStrictEqual(result, expected);
+      done();
+    });
+  });
+
+  test('should run Float32Array inputs through the single precision functions', (t, done) => {
+    const close = new Float32Array(data);
+    const high = new Float32Array(data.map((v) => v + 1));
+    const low = new Float32Array(data.map((v) => v - 1));
+    const params = { name: 'ATR', startIdx: 0, endIdx: data.length - 1, optInTimePeriod: 5 };
+    const expected = talib.execute({ ...params, high: Array.from(high), low: Array.from(low), close: Array.from(close) });
+
+    assert.deepStrictEqual(talib.execute({ ...params, high, low, close }), expected);
+    assert.deepStrictEqual(
+      talib.execute({ name: 'ADD', startIdx: 0, endIdx: 1, inReal0: close, inReal1: [1, 2] }).result.outReal,
+      [close[0] + 1, close[1] + 2]
+    );
+    talib.execute({ ...params, high, low, close }, (err, result) => {
+      assert.ifError(err);
+      assert.deepStrictEqual(result, expected);
+      done();
+    });
+  });
+
+  test('should reject inputs shorter than endIdx', () => {
+    assert.throws(() => talib.execute({
+      name: 'SMA',
+      startIdx: 0,
+      endIdx: data.length,
+      inReal: new Float64Array(data),
+      optInTimePeriod: 5
+    }), /endIdx/);
+  });
+});
+
+describe('TALib Typed Results', () => {
+  const data = [44, 44.34, 44.09, 43.61, 44.33, 44.83, 45.10, 45.42, 45.84, 46.08, 45.89, 46.03, 45.61, 46.28, 46.28];
+
+  test('should return Float64Array outputs in typed mode', () => {
+    const params = { name: 'BBANDS', startIdx: 0, endIdx: data.length - 1, inReal: data, optInTimePeriod: 5, optInNbDevUp: 2, optInNbDevDn: 2, optInMAType: 0 };
+    const expected = talib.execute(params);
+    const result = talib.execute({ ...params, output: 'typed' });
+
+    assert.strictEqual(result.begIndex, expected.begIndex);
+    assert.strictEqual(result.nbElement, expected.nbElement);
+    for (const name of Object.keys(expected.result)) {
+      assert.ok(result.result[name] instanceof Float64Array);
+      assert.deepStrictEqual(Array.from(result.result[name]), expected.result[name]);
+    }
+  });
+
+  test('should return Int32Array outputs for integer results', (t, done) => {
+    const params = { name: 'MAXINDEX', startIdx: 0, endIdx: data.length - 1, inReal: data, optInTimePeriod: 5 };
+    const expected = talib.execute(params);
+    talib.execute({ ...params, output: 'typed' }, (err, result) => {
+      assert.ifError(err);
+      assert.ok(result.result.outInteger instanceof Int32Array);
+      assert.deepStrictEqual(Array.from(result.result.outInteger), expected.result.outInteger);
+      done();
+    });
+  });
+
+  test('should reject unknown output modes', () => {
+    assert.throws(() => talib.execute({ name: 'SMA', startIdx: 0, endIdx: data.length - 1, inReal: data, optInTimePeriod: 5, output: 'list' }), /output/);
+  });
+});
+
+describe('TALib Caller Provided Outputs', () => {
+  const data = new Float64Array([44, 44.34, 44.09, 43.61, 44.33, 44.83, 45.10, 45.42, 45.84, 46.08, 45.89, 46.03, 45.61, 46.28, 46.28]);
+
+  test('should write results into the provided arrays', () => {
+    const params = { name: 'MACD', startIdx: 0, endIdx: data.length - 1, inReal: data, optInFastPeriod: 3, optInSlowPeriod: 5, optInSignalPeriod: 2 };
+    const expected = talib.execute(params);
+    const outputs = {
+      outMACD: new Float64Array(data.length),
+      outMACDSignal: new Float64Array(data.length),
+      outMACDHist: new Float64Array(data.length)
+    };
+    const result = talib.execute({ ...params, outputs });
+
+    assert.deepStrictEqual(result, { begIndex: expected.begIndex, nbElement: expected.nbElement });
+    for (const name of Object.keys(outputs)) {
+      assert.deepStrictEqual(Array.from(outputs[name].subarray(0, result.nbElement)), expected.result[name]);
+    }
+  });
+
+  test('should write results into the provided arrays asynchronously', (t, done) => {
+    const outInteger = new Int32Array(data.length);
+    talib.execute({ name: 'MININDEX', startIdx: 0, endIdx: data.length - 1, inReal: data, optInTimePeriod: 4, outputs: { outInteger } }, (err, result) => {
+      assert.ifError(err);
+      assert.strictEqual(result.result, undefined);
+      assert.strictEqual(outInteger[0], 3);
+      done();
+    });
+  });
+
+  test('should only require room for the results after the lookback', () => {
+    const params = { name: 'SMA', startIdx: 0, endIdx: data.length - 1, inReal: data, optInTimePeriod: 5 };
+    const outReal = new Float64Array(data.length - 4);
+    const result = talib.execute({ ...params, outputs: { outReal } });
+
+    assert.strictEqual(result.nbElement, outReal.length);
+    assert.throws(() => talib.execute({ ...params, outputs: { outReal: outReal.subarray(1) } }), /at least 11 values/);
+  });
+
+  test('should reject mismatched output arrays', () => {
+    const params = { name: 'SMA', startIdx: 0, endIdx: data.length - 1, inReal: data, optInTimePeriod: 5 };
+    assert.throws(() => talib.execute({ ...params, outputs: {} }), /outReal/);
+    assert.throws(() => talib.execute({ ...params, outputs: { outReal: new Int32Array(data.length) } }), /Float64Array/);
+    assert.throws(() => talib.execute({ ...params, outputs: { outReal: new Float64Array(2) } }), /at least/);
+  });
+});
+
+describe('TALib Prepared Functions', () => {
+  const data = new Float64Array([44, 44.34, 44.09, 43.61, 44.33, 44.83, 45.10, 45.42, 45.84, 46.08, 45.89, 46.03, 45.61, 46.28, 46.28]);
+
+  test('should match execute results across calls', () => {
+    const sma = talib.prepare({ name: 'SMA', optInTimePeriod: 5 });
+    assert.strictEqual(sma.name, 'SMA');
+    assert.strictEqual(sma.lookback, 4);
+    for (const endIdx of [data.length - 1, 8, data.length - 1]) {
+      const expected = talib.execute({ name: 'SMA', startIdx: 0, endIdx, inReal: data, optInTimePeriod: 5 });
+      assert.deepStrictEqual(sma.execute({ startIdx: 0, endIdx, inReal: data }), expected);
+    }
+  });
+
+  test('should execute asynchronously', (t, done) => {
+    const params = { name: 'MACD', optInFastPeriod: 3, optInSlowPeriod: 5, optInSignalPeriod: 2 };
+    const macd = talib.prepare(params);
+    const expected = talib.execute({ ...params, startIdx: 0, endIdx: data.length - 1, inReal: data, output: 'typed' });
+    macd.execute({ startIdx: 0, endIdx: data.length - 1, inReal: data, output: 'typed' }, (err, result) => {
+      assert.ifError(err);
+      assert.deepStrictEqual(result, expected);
+      done();
+    });
+  });
+
+  test('should reject invalid functions and parameters', () => {
+    assert.throws(() => talib.prepare({ name: 'NOPE' }), /TA_/);
+    assert.throws(() => talib.prepare({ name: 'SMA' }), /optInTimePeriod/);
+    assert.throws(() => talib.prepare({ name: 'SMA', optInTimePeriod: 5 }).execute({ startIdx: 0, endIdx: 3 }), /inReal/);
+  });
+});
+
+describe('TALib Series', () => {
+  const high = [48.70, 48.72, 48.90, 48.87, 48.82, 49.05, 49.20, 49.35, 49.92, 50.19, 50.12, 49.66, 49.88, 50.19, 50.36];
+  const low = [47.79, 48.14, 48.39, 48.37, 48.24, 48.64, 48.94, 48.86, 49.50, 49.87, 49.20, 48.90, 49.43, 49.73, 49.26];
+  const close = [48.16, 48.61, 48.75, 48.63, 48.74, 49.03, 49.07, 49.32, 49.91, 50.13, 49.53, 49.50, 49.75, 50.03, 50.31];
+
+  test('should compute the appended bars like execute from the first new bar', () => {
+    const params = { name: 'WILLR', optInTimePeriod: 4 };
+    const series = talib.series(params);
+    assert.strictEqual(series.lookback, 3);
+    let length = 0;
+    for (const count of [2, 0, 5, 1, 7]) {
+      const slice = (values) => values.slice(length, length + count);
+      const delta = series.append({ high: slice(high), low: slice(low), close: slice(close) });
+      length += count;
+      assert.strictEqual(series.length, length);
+      if (length > series.lookback) {
+        const startIdx = Math.max(length - count, series.lookback);
+        assert.deepStrictEqual(delta, talib.execute({ ...params, startIdx, endIdx: length - 1, high, low, close }));
+      } else {
+        assert.strictEqual(delta.nbElement, 0);
+      }
+    }
+    assert.deepStrictEqual(series.result(), talib.execute({ ...params, startIdx: 0, endIdx: close.length - 1, high, low, close }));
+    assert.deepStrictEqual(series.result({ output: 'typed' }), talib.execute({ ...params, startIdx: 0, endIdx: close.length - 1, high, low, close, output: 'typed' }));
+  });
+
+  test('should recompute the functions carrying state like execute over the whole series', () => {
+    const volume = close.map((value, i) => 1000 + i * 10);
+    for (const params of [{ name: 'OBV' }, { name: 'EMA', optInTimePeriod: 3 }, { name: 'BBANDS', optInTimePeriod: 3, optInNbDevUp: 2, optInNbDevDn: 2, optInMAType: 1 }]) {
+      const series = talib.series(params);
+      assert.strictEqual(series.incremental, false);
+      series.append({ inReal: close.slice(0, 6), close: close.slice(0, 6), volume: volume.slice(0, 6) });
+      for (let i = 6; i < close.length; i++) {
+        const delta = series.append({ inReal: [close[i]], close: [close[i]], volume: [volume[i]] });
+        const full = talib.execute({ ...params, startIdx: 0, endIdx: i, inReal: close, close, volume });
+        assert.strictEqual(delta.begIndex, i);
+        for (const name in full.result) {
+          assert.deepStrictEqual(delta.result[name], full.result[name].slice(-1));
+        }
+      }
+      assert.deepStrictEqual(series.result(), talib.execute({ ...params, startIdx: 0, endIdx: close.length - 1, inReal: close, close, volume }));
+    }
+    assert.strictEqual(talib.series({ name: 'WILLR', optInTimePeriod: 4 }).incremental, true);
+  });
+
+  test('should reject bars with missing or uneven inputs', () => {
+    const series = talib.series({ name: 'ATR', optInTimePeriod: 3 });
+    assert.throws(() => series.append({ high, low }), /close/);
+    assert.throws(() => series.append({ high, low: low.slice(1), close }), /as many values/);
+    assert.strictEqual(series.length, 0);
+  });
+});
+
+describe('TALib Function IDs', () => {
+  const data = [1, 2, 3, 4, 5, 6, 7, 8, 9, 10];
+
+  test('should number every function once', () => {
+    const ids = talib.functions.map((func) => func.id).sort((a, b) => a - b);
+    assert.deepStrictEqual(ids, talib.functions.map((func, index) => index));
+    assert.strictEqual(talib.explain('SMA').id, talib.functions.find((func) => func.name === 'SMA').id);
+  });
+
+  test('should execute functions by id', () => {
+    const { id } = talib.explain('SMA');
+    const params = { name: 'SMA', startIdx: 0, endIdx: data.length - 1, inReal: data, optInTimePeriod: 3 };
+    assert.deepStrictEqual(talib.execute({ ...params, name: id }), talib.execute(params));
+    assert.strictEqual(talib.prepare({ name: id, optInTimePeriod: 3 }).name, 'SMA');
+  });
+
+  test('should reject unknown ids', () => {
+    assert.throws(() => talib.execute({ name: talib.functions.length, startIdx: 0, endIdx: data.length - 1, inReal: data }), /TA_FUNC_NOT_FOUND/);
+  });
+});
+
+describe('TALib Batch Execution', () => {
+  const high = [48.70, 48.72, 48.90, 48.87, 48.82, 49.05, 49.20, 49.35, 49.92, 50.19, 50.12, 49.66, 49.88, 50.19, 50.36];
+  const low = [47.79, 48.14, 48.39, 48.37, 48.24, 48.64, 48.94, 48.86, 49.50, 49.87, 49.20, 48.90, 49.43, 49.73, 49.26];
+  const close = [48.16, 48.61, 48.75, 48.63, 48.74, 49.03, 49.07, 49.32, 49.91, 50.13, 49.53, 49.50, 49.75, 50.03, 50.31];
+  const inputs = { startIdx: 0, endIdx: close.length - 1, high, low, close, inReal: close };
+  const specs = [
+    { name: 'SMA', optInTimePeriod: 5 },
+    { name: 'ATR', optInTimePeriod: 3 },
+    { name: 'MAXINDEX', optInTimePeriod: 4, startIdx: 6, output: 'typed' }
+  ];
+
+  test('should match individual execute calls', () => {
+    const results = talib.executeBatch(inputs, specs);
+    assert.strictEqual(results.length, specs.length);
+    specs.forEach((spec, i) => {
+      assert.deepStrictEqual(results[i], talib.execute({ ...inputs, ...spec }));
+    });
+  });
+
+  test('should execute a batch asynchronously', (t, done) => {
+    talib.executeBatch(inputs, specs, (err, results) => {
+      assert.ifError(err);
+      specs.forEach((spec, i) => {
+        assert.deepStrictEqual(results[i], talib.execute({ ...inputs, ...spec }));
+      });
+      done();
+    });
+  });
+
+  test('should report the failing specification', () => {
+    assert.throws(() => talib.executeBatch(inputs, [specs[0], { name: 'SMA' }]), /specification 1: .*optInTimePeriod/);
+    assert.throws(() => talib.executeBatch(inputs, specs[0]), /Array/);
+  });
+
+  test('should compute shared intermediates once like a batch', (t, done) => {
+    const graphSpecs = ['TRANGE', 'ATR', 'NATR', 'PLUS_DM', 'MINUS_DM', 'PLUS_DI', 'MINUS_DI', 'DX', 'ADX', 'ADXR', 'RSI']
+      .map(name => ({ name, optInTimePeriod: 3 }))
+      .concat([
+        { name: 'ATR', optInTimePeriod: 3, startIdx: 9, output: 'typed' },
+        { name: 'STOCHRSI', optInTimePeriod: 3, optInFastK_Period: 3, optInFastD_Period: 2, optInFastD_MAType: 0 },
+        specs[0]
+      ]);
+    const expected = talib.executeBatch(inputs, graphSpecs);
+    assert.deepStrictEqual(talib.executeGraph(inputs, graphSpecs), expected);
+    talib.executeGraph(inputs, graphSpecs, (err, results) => {
+      assert.ifError(err);
+      assert.deepStrictEqual(results, expected);
+      done();
+    });
+  });
+});
+
+describe('TALib Panel Execution', () => {
+  const symbols = 4;
+  const bars = 30;
+  const columns = new Float64Array(symbols * bars).map((v, i) => 100 + Math.sin(i / 3) * 5 + (i % bars) * 0.1);
+  const column = (k) => columns.subarray(k * bars, (k + 1) * bars);
+
+  test('should compute every column of a contiguous panel', () => {
+    const results = talib.executePanel({ name: 'RSI', optInTimePeriod: 14, symbols, inReal: columns, output: 'typed' });
+    assert.strictEqual(results.length, symbols);
+    for (let k = 0; k < symbols; k++) {
+      assert.deepStrictEqual(results[k], talib.execute({ name: 'RSI', startIdx: 0, endIdx: bars - 1, optInTimePeriod: 14, inReal: column(k), output: 'typed' }));
+    }
+  });
+
+  test('should compute a list of series asynchronously', (t, done) => {
+    const series = [Array.from(column(0)), { inReal: column(1), startIdx: 5, endIdx: 20 }];
+    talib.executePanel({ name: 'SMA', optInTimePeriod: 5, series }, (err, results) => {
+      assert.ifError(err);
+      assert.deepStrictEqual(results[0], talib.execute({ name: 'SMA', startIdx: 0, endIdx: bars - 1, optInTimePeriod: 5, inReal: column(0) }));
+      assert.deepStrictEqual(results[1], talib.execute({ name: 'SMA', startIdx: 5, endIdx: 20, optInTimePeriod: 5, inReal: column(1) }));
+      done();
+    });
+  });
+
+  test('should resize the pool and report symbol errors', () => {
+    assert.strictEqual(talib.setPanelThreads(3), 3);
+    assert.throws(() => talib.executePanel({ name: 'ATR', optInTimePeriod: 5, series: [column(0)] }), /Objects/);
+    assert.throws(() => talib.executePanel({ name: 'SMA', optInTimePeriod: 5, symbols: 7, inReal: columns }), /same number of values/);
+    assert.ok(talib.setPanelThreads(0) >= 1);
+  });
+});
+
+describe('TALib Execution Context', () => {
+  const close = Array.from({ length: 60 }, (v, i) => 100 + Math.sin(i / 4) * 5);
+  const ema = { name: 'EMA', startIdx: 0, endIdx: close.length - 1, inReal: close, optInTimePeriod: 10 };
+
+  test('should apply the context to a single call only', () => {
+    const result = talib.execute({ ...ema, context: { unstablePeriod: { EMA: 20 } } });
+    assert.strictEqual(result.begIndex, 29);
+    assert.strictEqual(talib.execute(ema).begIndex, 9);
+    const prepared = talib.prepare({ name: 'EMA', optInTimePeriod: 10, context: { unstablePeriod: { TA_FUNC_UNST_EMA: 5 } } });
+    assert.strictEqual(prepared.lookback, 14);
+    assert.deepStrictEqual(prepared.execute(ema), talib.execute({ ...ema, context: { unstablePeriod: { EMA: 5 } } }));
+  });
+
+  test('should keep the settings of an asynchronous call', (t, done) => {
+    talib.execute(ema, (err, result) => {
+      assert.ifError(err);
+      assert.strictEqual(result.begIndex, 9);
+      talib.setUnstablePeriod(talib.functionUnstIds.TA_FUNC_UNST_EMA, 0);
+      done();
+    });
+    talib.setUnstablePeriod(talib.functionUnstIds.TA_FUNC_UNST_EMA, 20);
+  });
+
+  test('should override candle settings and report bad settings', () => {
+    const bars = { name: 'CDLDOJI', startIdx: 0, endIdx: 19, open: close.slice(0, 20), high: close.slice(0, 20).map((v) => v + 2), low: close.slice(0, 20).map((v) => v - 2), close: close.slice(1, 21) };
+    const all = talib.execute({ ...bars, context: { candleSettings: { BodyDoji: { rangeType: 'HighLow', avgPeriod: 0, factor: 100 } } } });
+    assert.ok(all.result.outInteger.every((v) => v === 100));
+    assert.throws(() => talib.execute({ ...ema, context: { unstablePeriod: { SMA: 1 } } }), /no function SMA/);
+    assert.throws(() => talib.execute({ ...ema, context: { compatibility: 'excel' } }), /metastock/);
+  });
+});
+
+describe('TALib Rolling Extremes', () => {
+  const trend = Array.from({ length: 400 }, (v, i) => 1000 - i + (i % 7 === 0 ? 3 : 0));
+  const window = (values, end, period) => values.slice(end - period + 1, end + 1);
+  const firstIndex = (values, end, period, pick) => {
+    const slice = window(values, end, period);
+    return end - period + 1 + slice.indexOf(pick(...slice));
+  };
+
+  test('should match a full scan of the window on trending data', () => {
+    const period = 50;
+    const { begIndex, result } = talib.execute({ name: 'MINMAXINDEX', startIdx: 0, endIdx: trend.length - 1, inReal: trend, optInTimePeriod: period });
+    result.outMaxIdx.forEach((index, k) => assert.strictEqual(index, firstIndex(trend, begIndex + k, period, Math.max)));
+    result.outMinIdx.forEach((index, k) => assert.strictEqual(index, firstIndex(trend, begIndex + k, period, Math.min)));
+  });
+
+  test('should compute MIDPOINT and MIDPRICE from the window extremes', () => {
+    const period = 30;
+    const high = trend.map((v) => v + 2);
+    const midpoint = talib.execute({ name: 'MIDPOINT', startIdx: 0, endIdx: trend.length - 1, inReal: trend, optInTimePeriod: period });
+    const midprice = talib.execute({ name: 'MIDPRICE', startIdx: 0, endIdx: trend.length - 1, high, low: trend, optInTimePeriod: period });
+    midpoint.result.outReal.forEach((v, k) => {
+      const slice = window(trend, midpoint.begIndex + k, period);
+      assert.strictEqual(v, (Math.max(...slice) + Math.min(...slice)) / 2);
+    });
+    midprice.result.outReal.forEach((v, k) => {
+      const end = midprice.begIndex + k;
+      assert.strictEqual(v, (Math.max(...window(high, end, period)) + Math.min(...window(trend, end, period))) / 2);
+    });
+  });
+
+  test('should resolve ties like the original scan', () => {
+    const flat = [1, 3, 3, 2, 3, 1, 1, 0, 0, 2];
+    const params = { startIdx: 0, endIdx: flat.length - 1, inReal: flat, optInTimePeriod: 3 };
+    assert.deepStrictEqual(talib.execute({ name: 'MAXINDEX', ...params }).result.outInteger, [1, 1, 2, 4, 4, 5, 6, 9]);
+    assert.deepStrictEqual(talib.execute({ name: 'MININDEX', ...params }).result.outInteger, [0, 3, 3, 5, 6, 7, 8, 8]);
+  });
+});
+
+describe('TALib Linear Regression', () => {
+  const series = Array.from({ length: 600 }, (v, i) => 100 + Math.sin(i / 9) * 20 + (i % 5) * 0.5);
+  const close = (actual, expected) => assert.ok(Math.abs(actual - expected) <= 1e-9 * (1 + Math.abs(expected)), `${actual} != ${expected}`);
+  const regression = (values, end, period) => {
+    let sumX = 0, sumY = 0, sumXY = 0, sumXX = 0;
+    for (let x = 0; x < period; x++) {
+      const y = values[end - period + 1 + x];
+      sumX += x; sumY += y; sumXY += x * y; sumXX += x * x;
+    }
+    const slope = (period * sumXY - sumX * sumY) / (period * sumXX - sumX * sumX);
+    return { slope, intercept: (sumY - slope * sumX) / period };
+  };
+
+  test('should match a full regression over each window', () => {
+    const period = 40;
+    const { begIndex, result } = talib.execute({ name: 'LINEARREG_ALL', startIdx: 0, endIdx: series.length - 1, inReal: series, optInTimePeriod: period });
+    assert.strictEqual(begIndex, period - 1);
+    result.outSlope.forEach((v, k) => {
+      const { slope, intercept } = regression(series, begIndex + k, period);
+      close(v, slope);
+      close(result.outIntercept[k], intercept);
+      close(result.outAngle[k], Math.atan(slope) * 180 / Math.PI);
+      close(result.outLinearReg[k], intercept + slope * (period - 1));
+      close(result.outTSF[k], intercept + slope * period);
+    });
+  });
+
+  test('should match the individual functions', () => {
+    const params = { startIdx: 0, endIdx: series.length - 1, inReal: series, optInTimePeriod: 14 };
+    const all = talib.execute({ name: 'LINEARREG_ALL', ...params }).result;
+    assert.deepStrictEqual(talib.execute({ name: 'LINEARREG_SLOPE', ...params }).result.outReal, all.outSlope);
+    assert.deepStrictEqual(talib.execute({ name: 'LINEARREG_INTERCEPT', ...params }).result.outReal, all.outIntercept);
+    assert.deepStrictEqual(talib.execute({ name: 'LINEARREG_ANGLE', ...params }).result.outReal, all.outAngle);
+    assert.deepStrictEqual(talib.execute({ name: 'LINEARREG', ...params }).result.outReal, all.outLinearReg);
+    assert.deepStrictEqual(talib.execute({ name: 'TSF', ...params }).result.outReal, all.outTSF);
+  });
+
+  test('should recover once a NaN leaves the window', () => {
+    const period = 10;
+    const gap = series.slice(0, 100);
+    gap[30] = NaN;
+    const { begIndex, result } = talib.execute({ name: 'LINEARREG', startIdx: 0, endIdx: gap.length - 1, inReal: gap, optInTimePeriod: period });
+    result.outReal.forEach((v, k) => {
+      const end = begIndex + k;
+      if (end >= 30 && end < 30 + period) {
+        assert.ok(Number.isNaN(v));
+      } else {
+        const { slope, intercept } = regression(gap, end, period);
+        close(v, intercept + slope * (period - 1));
+      }
+    });
+  });
+});
+
+describe('TALib Mean Deviation', () => {
+  const close = Array.from({ length: 800 }, (v, i) => 50 + Math.sin(i / 17) * 8 + ((i * 7919) % 13) / 4);
+  const high = close.map((v, i) => v + 1 + (i % 3) / 2);
+  const low = close.map((v, i) => v - 1 - (i % 4) / 3);
+  const near = (actual, expected) => assert.ok(Math.abs(actual - expected) <= 1e-9 * (1 + Math.abs(expected)), `${actual} != ${expected}`);
+  const meanDev = (values, end, period) => {
+    const slice = values.slice(end - period + 1, end + 1);
+    const mean = slice.reduce((sum, v) => sum + v, 0) / period;
+    return { mean, dev: slice.reduce((sum, v) => sum + Math.abs(v - mean), 0) / period };
+  };
+
+  test('should match the direct AVGDEV summation for short and long periods', () => {
+    for (const period of [14, 200]) {
+      const { begIndex, result } = talib.execute({ name: 'AVGDEV', startIdx: 0, endIdx: close.length - 1, inReal: close, optInTimePeriod: period });
+      result.outReal.forEach((v, k) => near(v, meanDev(close, begIndex + k, period).dev));
+    }
+  });
+
+  test('should match the direct CCI summation for short and long periods', () => {
+    const typical = close.map((v, i) => (high[i] + low[i] + v) / 3);
+    for (const period of [20, 150]) {
+      const { begIndex, result } = talib.execute({ name: 'CCI', startIdx: 0, endIdx: close.length - 1, high, low, close, optInTimePeriod: period });
+      result.outReal.forEach((v, k) => {
+        const end = begIndex + k;
+        const { mean, dev } = meanDev(typical, end, period);
+        near(v, (typical[end] - mean) / (0.015 * dev));
+      });
+    }
+  });
+
+  test('should keep a long period accurate at high price levels', () => {
+    const period = 100;
+    // Summed from the first value of the window, the mean itself is exact to the last bits.
+    const shifted = (values, end) => {
+      const slice = values.slice(end - period + 1, end + 1);
+      const mean = slice[0] + slice.reduce((sum, v) => sum + (v - slice[0]), 0) / period;
+      return { mean, dev: slice.reduce((sum, v) => sum + Math.abs(v - mean), 0) / period };
+    };
+    for (const level of [1e6, 1e8]) {
+      const price = Array.from({ length: 1500 }, (v, i) => level + Math.sin(i / 23) * 2 + ((i * 7919) % 13) * 0.01);
+      const ulps = 4 * Number.EPSILON * level;
+      const avgdev = talib.execute({ name: 'AVGDEV', startIdx: 0, endIdx: price.length - 1, inReal: price, optInTimePeriod: period });
+      avgdev.result.outReal.forEach((v, k) => {
+        const { dev } = shifted(price, avgdev.begIndex + k);
+        assert.ok(Math.abs(v - dev) <= ulps, `${v} != ${dev}`);
+      });
+      const cci = talib.execute({ name: 'CCI', startIdx: 0, endIdx: price.length - 1, high: price, low: price, close: price, optInTimePeriod: period });
+      cci.result.outReal.forEach((v, k) => {
+        const end = cci.begIndex + k;
+        const { mean, dev } = shifted(price, end);
+        const expected = (price[end] - mean) / (0.015 * dev);
+        assert.ok(Math.abs(v - expected) <= ulps * (1 + Math.abs(expected)) / (0.015 * dev), `${v} != ${expected}`);
+      });
+    }
+  });
+
+  test('should handle flat windows and NaN with a long period', () => {
+    const period = 100;
+    const flat = new Array(300).fill(42);
+    flat[250] = NaN;
+    const { begIndex, result } = talib.execute({ name: 'AVGDEV', startIdx: 0, endIdx: flat.length - 1, inReal: flat, optInTimePeriod: period });
+    result.outReal.forEach((v, k) => {
+      const end = begIndex + k;
+      if (end >= 250) assert.ok(Number.isNaN(v));
+      else assert.strictEqual(v, 0);
+    });
+    const cci = talib.execute({ name: 'CCI', startIdx: 0, endIdx: 199, high: flat, low: flat, close: flat, optInTimePeriod: period });
+    assert.ok(cci.result.outReal.every((v) => v === 0));
+  });
+});
+
+describe('TALib Variable Period Moving Average', () => {
+  const inReal = Array.from({ length: 500 }, (v, i) => 100 + Math.sin(i / 7) * 5 + (i % 11) / 10);
+  const inPeriods = inReal.map((v, i) => 2 + ((i * 37) % 45) + 0.5);
+  const params = { name: 'MAVP', startIdx: 0, endIdx: inReal.length - 1, inReal, inPeriods, optInMinPeriod: 5, optInMaxPeriod: 40 };
+  const near = (actual, expected) => assert.ok(Math.abs(actual - expected) <= 1e-9 * (1 + Math.abs(expected)), `${actual} != ${expected}`);
+  const periodAt = (index) => Math.min(40, Math.max(5, Math.trunc(inPeriods[index])));
+
+  test('should average each element over its own period', () => {
+    const { begIndex, result } = talib.execute({ ...params, optInMAType: 0 });
+    assert.strictEqual(begIndex, 39);
+    result.outReal.forEach((v, k) => {
+      const end = begIndex + k;
+      const period = periodAt(end);
+      near(v, inReal.slice(end - period + 1, end + 1).reduce((sum, x) => sum + x, 0) / period);
+    });
+  });
+
+  test('should match the moving average of each period', () => {
+    for (const optInMAType of [1, 2, 3]) {
+      const { begIndex, result } = talib.execute({ ...params, optInMAType });
+      const byPeriod = {};
+      result.outReal.forEach((v, k) => {
+        const period = periodAt(begIndex + k);
+        byPeriod[period] = byPeriod[period] || talib.execute({ name: 'MA', startIdx: begIndex, endIdx: inReal.length - 1, inReal, optInTimePeriod: period, optInMAType });
+        near(v, byPeriod[period].result.outReal[begIndex + k - byPeriod[period].begIndex]);
+      });
+    }
+  });
+
+  test('should propagate NaN like the moving average', () => {
+    const gap = inReal.slice();
+    gap[200] = NaN;
+    const { begIndex, result } = talib.execute({ ...params, inReal: gap, optInMAType: 0 });
+    result.outReal.forEach((v, k) => assert.strictEqual(Number.isNaN(v), begIndex + k >= 200));
+  });
+});
+
+describe('TALib Parameter Sweep', () => {
+  const inReal = Array.from({ length: 300 }, (v, i) => 100 + Math.sin(i / 6) * 8 + (i % 9) / 4);
+  const periods = Array.from({ length: 49 }, (v, i) => i + 2);
+  const base = { startIdx: 10, endIdx: inReal.length - 1, inReal };
+  const near = (actual, expected) => assert.ok(Math.abs(actual - expected) <= 1e-8 * (1 + Math.abs(expected)), `${actual} != ${expected}`);
+  const compare = (sweep, params, key, values, same) => {
+    values.forEach((value, j) => {
+      const single = talib.execute({ ...params, [key]: value });
+      assert.strictEqual(sweep.begIndexes[j], single.begIndex);
+      assert.strictEqual(sweep.nbElements[j], single.nbElement);
+      for (const [name, column] of Object.entries(single.result)) {
+        for (let r = 0; r < sweep.nbElement; r++) {
+          const k = sweep.begIndex + r - single.begIndex;
+          const actual = sweep.result[name][j * sweep.nbElement + r];
+          if (k < 0) assert.ok(Number.isNaN(actual));
+          else same(actual, column[k]);
+        }
+      }
+    });
+  };
+
+  test('should match execute for the shared kernels', () => {
+    const sweep = talib.sweep({ ...base, name: 'SMA', optInTimePeriod: periods });
+    assert.strictEqual(sweep.begIndex, 10);
+    assert.strictEqual(sweep.nbElement, inReal.length - 10);
+    assert.deepStrictEqual(sweep.optInTimePeriod, periods);
+    compare(sweep, { ...base, name: 'SMA' }, 'optInTimePeriod', periods, near);
+    // A random walk around 1e6, where the variance cancels most of the digits of the sums
+    let price = 1e6;
+    const level = { ...base, inReal: inReal.map((v, i) => (price += Math.sin(i * 12.9898) * 0.05)) };
+    for (const input of [base, level]) {
+      for (const params of [
+        { name: 'VAR', optInNbDev: 1 },
+        { name: 'STDDEV', optInNbDev: 2 },
+        { name: 'BBANDS', optInNbDevUp: 2, optInNbDevDn: 1.5, optInMAType: 0 }
+      ]) {
+        compare(talib.sweep({ ...input, ...params, optInTimePeriod: periods }), { ...input, ...params }, 'optInTimePeriod', periods, assert.strictEqual);
+      }
+    }
+    const context = { compatibility: 'metastock', unstablePeriod: { RSI: 5 } };
+    for (const params of [{ name: 'RSI' }, { name: 'RSI', context }]) {
+      compare(talib.sweep({ ...base, ...params, optInTimePeriod: periods }), { ...base, ...params }, 'optInTimePeriod', periods, assert.strictEqual);
+    }
+  });
+
+  test('should sweep any optional input asynchronously', (t, done) => {
+    const params = { ...base, name: 'MACD', optInSlowPeriod: 26, optInSignalPeriod: 9 };
+    talib.sweep({ ...params, optInFastPeriod: [5, 8, 12] }, (err, sweep) => {
+      assert.ifError(err);
+      assert.strictEqual(sweep.columns, 3);
+      compare(sweep, params, 'optInFastPeriod', [5, 8, 12], assert.strictEqual);
+      const outputs = Object.fromEntries(Object.entries(sweep.result).map(([name, matrix]) => [name, new Float64Array(matrix.length)]));
+      const written = talib.sweep({ ...params, optInFastPeriod: [5, 8, 12], outputs });
+      assert.strictEqual(written.result, undefined);
+      assert.deepStrictEqual(outputs, sweep.result);
+      done();
+    });
+  });
+
+  test('should reject invalid sweeps', () => {
+    assert.throws(() => talib.sweep({ ...base, name: 'SMA', optInTimePeriod: 5 }), /Array/);
+    assert.throws(() => talib.sweep({ ...base, name: 'SMA', optInTimePeriod: [5, 1] }), /Swept value 1: TA_BAD_PARAM/);
+    assert.throws(() => talib.sweep({ ...base, name: 'BBANDS', optInTimePeriod: [5], optInNbDevUp: [1, 2], optInNbDevDn: 2, optInMAType: 0 }), /Only one/);
+  });
+});
+
+describe('TALib Streams', () => {
+  const inReal = Array.from({ length: 200 }, (v, i) => 100 + Math.sin(i / 5) * 6 + (i % 7) / 3);
+  const replay = (stream, params) => {
+    const { begIndex, result } = talib.execute({ ...params, startIdx: 0, endIdx: inReal.length - 1, inReal });
+    assert.strictEqual(stream.lookback, begIndex);
+    inReal.forEach((v, i) => {
+      const value = stream.update(v);
+      if (i < begIndex) assert.ok(Number.isNaN(value));
+      else assert.strictEqual(value, result.outReal[i - begIndex]);
+    });
+  };
+
+  test('should match execute for the EMA family', () => {
+    for (const name of ['EMA', 'DEMA', 'TEMA', 'TRIX']) {
+      replay(talib.stream(name, { optInTimePeriod: 9 }), { name, optInTimePeriod: 9 });
+    }
+    replay(talib.stream({ name: 'T3', optInTimePeriod: 5, optInVFactor: 0.7 }), { name: 'T3', optInTimePeriod: 5, optInVFactor: 0.7 });
+  });
+
+  test('should seed with the settings captured at creation', () => {
+    for (const context of [{ compatibility: 'metastock' }, { unstablePeriod: { EMA: 12, T3: 4 } }]) {
+      replay(talib.stream('DEMA', { optInTimePeriod: 6, context }), { name: 'DEMA', optInTimePeriod: 6, context });
+      replay(talib.stream('T3', { optInTimePeriod: 4, optInVFactor: 0.5, context }), { name: 'T3', optInTimePeriod: 4, optInVFactor: 0.5, context });
+    }
+  });
+
+  test('should reject unsupported functions and parameters', () => {
+    assert.throws(() => talib.stream('CCI', { optInTimePeriod: 5 }), /has no stream/);
+    assert.throws(() => talib.stream('EMA', { optInTimePeriod: 1 }), /optInTimePeriod.*TA_BAD_PARAM/);
+    assert.throws(() => talib.stream('EMA', { optInTimePeriod: 5 }).update(), /input values/);
+  });
+});
+
+describe('TALib Wilder Streams', () => {
+  const high = Array.from({ length: 200 }, (v, i) => 101 + Math.sin(i / 5) * 6 + (i % 7) / 3);
+  const low = high.map((v, i) => v - 1 - (i % 3) / 2);
+  const close = high.map((v, i) => v - 0.5 - (i % 5) / 5);
+  const execute = (name, context) => talib.execute({ name, startIdx: 0, endIdx: close.length - 1, high, low, close, inReal: close, optInTimePeriod: 7, context });
+  const bar = (stream, i) => stream.name === 'RSI' ? stream.update(close[i]) : stream.name.endsWith('_DM') ? stream.update(high[i], low[i]) : stream.update(high[i], low[i], close[i]);
+
+  test('should match execute for the Wilder smoothed functions', () => {
+    for (const context of [undefined, { unstablePeriod: { ALL: 5 } }, { compatibility: 'metastock' }]) {
+      for (const name of ['RSI', 'ATR', 'NATR', 'PLUS_DM', 'MINUS_DM', 'PLUS_DI', 'MINUS_DI', 'DX', 'ADX', 'ADXR']) {
+        const { begIndex, result } = execute(name, context);
+        const stream = talib.stream(name, { optInTimePeriod: 7, context });
+        assert.strictEqual(stream.lookback, begIndex);
+        close.forEach((v, i) => {
+          const value = bar(stream, i);
+          if (i < begIndex) assert.ok(Number.isNaN(value));
+          else assert.strictEqual(value, result.outReal[i - begIndex]);
+        });
+      }
+    }
+  });
+
+  test('should resume from a saved state', () => {
+    const { begIndex, result } = execute('ADXR');
+    let stream = talib.stream('ADXR', { optInTimePeriod: 7 });
+    close.forEach((v, i) => {
+      if (i % 50 === 0) stream = talib.stream(stream.save());
+      const value = bar(stream, i);
+      if (i >= begIndex) assert.strictEqual(value, result.outReal[i - begIndex]);
+    });
+  });
+
+  test('should rewind to a saved state', () => {
+    const stream = talib.stream('ATR', { optInTimePeriod: 7 });
+    for (let i = 0; i < 100; i++) bar(stream, i);
+    const saved = stream.save();
+    const value = bar(stream, 100);
+    stream.update(1000, 0, 500);
+    assert.strictEqual(stream.restore(saved), stream);
+    assert.strictEqual(bar(stream, 100), value);
+    assert.throws(() => talib.stream('RSI', { optInTimePeriod: 7 }).restore(saved), /Saved stream is one of ATR/);
+    assert.throws(() => talib.stream(saved.subarray(0, 10)), /truncated/);
+    assert.throws(() => talib.stream(saved.subarray(0, saved.length - 8)), /truncated/);
+  });
+
+  test('should only save the state of its kind', () => {
+    const atr = talib.stream('ATR', { optInTimePeriod: 7 }).save();
+    const candles = talib.candles().save();
+    assert.ok(atr.length < 512, `${atr.length} bytes`);
+    // Header size then state size, an ATR state does not pass for a candlestick engine
+    assert.strictEqual(candles.readUInt32LE(8) + candles.readUInt32LE(12) * 8 + 48, candles.length);
+    atr.write('CANDLES\0', 16);
+    assert.throws(() => talib.candles(atr), /not created by this version/);
+  });
+});
+
+describe('TALib Hilbert Engine', () => {
+  const inReal = Array.from({ length: 300 }, (v, i) => 100 + Math.sin(i / 9) * 8 + (i % 11) / 4);
+  const outputs = { HT_DCPERIOD: ['dcPeriod'], HT_DCPHASE: ['dcPhase'], HT_PHASOR: ['inPhase', 'quadrature'], HT_SINE: ['sine', 'leadSine'], HT_TRENDLINE: ['trendline'], HT_TRENDMODE: ['trendMode'], MAMA: ['mama', 'fama'] };
+  const execute = (name, context) => talib.execute({ name, startIdx: 0, endIdx: inReal.length - 1, inReal, optInFastLimit: 0.5, optInSlowLimit: 0.05, context });
+
+  test('should match execute for every HT function and MAMA', () => {
+    for (const context of [undefined, { unstablePeriod: { HT_DCPHASE: 4, MAMA: 9 } }]) {
+      const hilbert = talib.hilbert({ context });
+      const values = inReal.map(v => hilbert.update(v));
+      for (const name in outputs) {
+        const { begIndex, result } = execute(name, context);
+        assert.strictEqual(hilbert.lookbacks[name], begIndex);
+        outputs[name].forEach((key, j) => {
+          const expected = Object.values(result)[j];
+          values.forEach((value, i) => {
+            if (i < begIndex) assert.ok(Number.isNaN(value[key]));
+            else assert.strictEqual(value[key], expected[i - begIndex]);
+          });
+        });
+      }
+    }
+  });
+
+  test('should stream each HT function', () => {
+    for (const name of ['HT_SINE', 'HT_TRENDMODE', 'MAMA']) {
+      const { begIndex, result } = execute(name);
+      const stream = talib.stream(name, { optInFastLimit: 0.5, optInSlowLimit: 0.05 });
+      const output = new Float64Array(2);
+      inReal.forEach((v, i) => {
+        stream.update(v, output);
+        Object.values(result).forEach((expected, j) => {
+          if (i >= begIndex) assert.strictEqual(output[j], expected[i - begIndex]);
+        });
+      });
+    }
+  });
+
+  test('should resume a saved engine', () => {
+    const hilbert = talib.hilbert({ optInFastLimit: 0.4 });
+    inReal.slice(0, 150).forEach(v => hilbert.update(v));
+    const resumed = talib.hilbert(hilbert.save());
+    assert.strictEqual(resumed.name, 'HILBERT');
+    inReal.slice(150).forEach(v => assert.deepStrictEqual(resumed.update(v), hilbert.update(v)));
+    assert.throws(() => talib.hilbert(talib.stream('EMA', { optInTimePeriod: 5 }).save()), /Saved stream is one of EMA/);
+  });
+
+  test('should reject a corrupted engine', () => {
+    const hilbert = talib.hilbert();
+    inReal.slice(0, 80).forEach(v => hilbert.update(v));
+    // Delay line index of the early pipeline
+    const saved = hilbert.save();
+    saved.writeInt32LE(0x3fffffff, 544);
+    assert.throws(() => hilbert.restore(saved), /Saved stream is corrupted/);
+    assert.throws(() => talib.hilbert(saved), /Saved stream is corrupted/);
+    // Bar count of the state
+    const rsi = talib.stream('RSI', { optInTimePeriod: 7 }).save();
+    rsi.writeInt32LE(-5, 56);
+    assert.throws(() => talib.stream(rsi), /Saved stream is corrupted/);
+  });
+});
+
+describe('TALib Candle Engine', () => {
+  const open = Array.from({ length: 300 }, (v, i) => 100 + Math.sin(i / 6) * 5 + (i % 7) / 3);
+  const close = open.map((v, i) => v + Math.sin(i * 1.7) * 1.5 * (i % 5 === 0 ? 0.05 : 1));
+  const high = open.map((v, i) => Math.max(v, close[i]) + (i % 4) / 3);
+  const low = open.map((v, i) => Math.min(v, close[i]) - (i % 3) / 2);
+  const replay = (candles, params) => {
+    const values = open.map((v, i) => candles.update(open[i], high[i], low[i], close[i]));
+    for (const name of candles.patterns) {
+      const { begIndex, result } = talib.execute({ name, startIdx: 0, endIdx: open.length - 1, open, high, low, close, optInPenetration: 0.3, ...params });
+      assert.strictEqual(candles.lookbacks[name], begIndex);
+      values.forEach((value, i) => {
+        if (i < begIndex) assert.ok(Number.isNaN(value[name]));
+        else assert.strictEqual(value[name], result.outInteger[i - begIndex]);
+      });
+    }
+  };
+
+  test('should match execute for every pattern', () => {
+    const candles = talib.candles({ optInPenetration: 0.3 });
+    assert.strictEqual(candles.patterns.length, talib.functions.filter(func => func.group === 'Pattern Recognition').length);
+    replay(candles, {});
+    const context = { candleSettings: { BodyLong: { rangeType: 'HighLow', avgPeriod: 4, factor: 0.8 }, Near: { rangeType: 'Shadows', avgPeriod: 12, factor: 1.2 } } };
+    replay(talib.candles({ patterns: ['CDLHIKKAKEMOD', 'CDL3LINESTRIKE', 'CDLMATHOLD'], optInPenetration: 0.3, context }), { context });
+  });
+
+  test('should resume a saved engine', () => {
+    const candles = talib.candles({ patterns: ['CDLENGULFING', 'CDLHIKKAKE'] });
+    open.slice(0, 150).forEach((v, i) => candles.update(open[i], high[i], low[i], close[i]));
+    const resumed = talib.candles(candles.save());
+    assert.deepStrictEqual(resumed.patterns, ['CDLENGULFING', 'CDLHIKKAKE']);
+    const output = new Float64Array(2);
+    open.slice(150).forEach((v, i) => {
+      resumed.update(open[i + 150], high[i + 150], low[i + 150], close[i + 150], output);
+      assert.deepStrictEqual(Array.from(output), Object.values(candles.update(open[i + 150], high[i + 150], low[i + 150], close[i + 150])));
+    });
+    assert.throws(() => talib.candles({ patterns: ['SMA'] }), /SMA is not a candlestick pattern/);
+  });
+});
+
+describe('TALib SAR Streams', () => {
+  const high = Array.from({ length: 300 }, (v, i) => 101 + Math.sin(i / 8) * 7 + (i % 5) / 4);
+  const low = high.map((v, i) => v - 1 - (i % 3) / 2);
+  const sarExt = { optInStartValue: -105, optInOffsetOnReverse: 0.01, optInAccelerationInitLong: 0.03, optInAccelerationLong: 0.02, optInAccelerationMaxLong: 0.25, optInAccelerationInitShort: 0.02, optInAccelerationShort: 0.04, optInAccelerationMaxShort: 0.2 };
+  const replay = (name, params, tick) => {
+    const { begIndex, result } = talib.execute({ name, startIdx: 0, endIdx: high.length - 1, high, low, ...params });
+    const stream = talib.stream(name, params);
+    assert.strictEqual(stream.lookback, begIndex);
+    high.forEach((v, i) => {
+      if (tick) tick(stream, i);
+      const value = stream.update(high[i], low[i]);
+      if (i < begIndex) assert.ok(Number.isNaN(value));
+      else assert.strictEqual(value, result.outReal[i - begIndex]);
+    });
+  };
+
+  test('should match execute for SAR and SAREXT', () => {
+    replay('SAR', { optInAcceleration: 0.02, optInMaximum: 0.2 });
+    replay('SAR', { optInAcceleration: 0.3, optInMaximum: 0.2 });
+    replay('SAREXT', sarExt);
+  });
+
+  test('should update the open bar on every tick', () => {
+    replay('SAREXT', sarExt, (stream, i) => {
+      const barStart = stream.save();
+      for (let k = 0; k < 3; k++) {
+        stream.restore(barStart);
+        stream.update(high[i] - k / 10, low[i] + k / 10);
+      }
+      stream.restore(barStart);
+    });
+  });
+});
+
+describe('TALib SIMD Kernels', () => {
+  const a = Array.from({ length: 203 }, (v, i) => Math.sin(i * 1.7) * (i % 7 ? 1000 : 1e-9));
+  const b = Array.from({ length: 203 }, (v, i) => Math.cos(i * 0.3) * 50 + 0.5);
+  a.splice(0, 12, NaN, -0, Infinity, -Infinity, -2.5, 2.5, -0.3, 0.7, -0.7, 2 ** 52 + 1, -(2 ** 51) - 0.5, 1e300);
+  b[3] = 0;
+  const bits = new BigInt64Array(new Float64Array(2).buffer);
+  const ulps = (x, y) => {
+    if (Number.isNaN(x) || Number.isNaN(y)) return Number.isNaN(x) && Number.isNaN(y) ? 0 : Infinity;
+    new Float64Array(bits.buffer).set([x, y]);
+    return Math.abs(Number(bits[0] - bits[1]));
+  };
+  const ops = {
+    ADD: (x, y) => x + y, SUB: (x, y) => x - y, MULT: (x, y) => x * y, DIV: (x, y) => x / y,
+    SQRT: Math.sqrt, CEIL: Math.ceil, FLOOR: Math.floor
+  };
+
+  test('should round every level like the scalar operations', () => {
+    const initial = talib.getSimdLevel();
+    try {
+      for (const level of ['scalar', 'sse2', 'avx2', 'avx512']) {
+        talib.setSimdLevel(level);
+        for (const [name, op] of Object.entries(ops)) {
+          for (const startIdx of [0, 1, 3, 5]) {
+            const { result } = talib.execute({ name, startIdx, endIdx: a.length - 1, inReal: a, inReal0: a, inReal1: b });
+            result.outReal.forEach((v, i) => assert.strictEqual(ulps(v, op(a[startIdx + i], b[startIdx + i])), 0, `${level} ${name} ${startIdx + i}`));
+          }
+        }
+      }
+    } finally {
+      talib.setSimdLevel(initial);
+    }
+  });
+
+  test('should compute the price transforms like the scalar level', () => {
+    const initial = talib.getSimdLevel();
+    const high = a.map((v, i) => 100 + Math.abs(Math.sin(i)) * 5);
+    const low = high.map((v, i) => (i % 9 ? v - Math.abs(b[i]) / 10 : v));
+    const open = low.map((v, i) => v + (high[i] - v) * 0.25);
+    const close = low.map((v, i) => v + (high[i] - v) * 0.75);
+    high[20] = NaN; low[31] = NaN; close[42] = NaN; high[50] = -0; low[50] = 0;
+    const run = (name, startIdx) => talib.execute({ name, startIdx, endIdx: a.length - 1, high, low, open, close }).result.outReal;
+    try {
+      for (const name of ['AVGPRICE', 'MEDPRICE', 'TYPPRICE', 'WCLPRICE', 'TRANGE', 'BOP']) {
+        for (const startIdx of [0, 1, 3, 5]) {
+          talib.setSimdLevel('scalar');
+          const expected = run(name, startIdx);
+          for (const level of ['sse2', 'avx2', 'avx512']) {
+            talib.setSimdLevel(level);
+            run(name, startIdx).forEach((v, i) => assert.strictEqual(ulps(v, expected[i]), 0, `${level} ${name} ${startIdx + i}`));
+          }
+        }
+      }
+    } finally {
+      talib.setSimdLevel(initial);
+    }
+  });
+
+  test('should cap the level to the supported one', () => {
+    const initial = talib.getSimdLevel();
+    assert.strictEqual(talib.setSimdLevel('avx512'), initial);
+    assert.strictEqual(talib.setSimdLevel('scalar'), 'scalar');
+    assert.strictEqual(talib.getSimdLevel(), 'scalar');
+    talib.setSimdLevel(initial);
+    assert.throws(() => talib.setSimdLevel('neon'), /SIMD level/);
+  });
+});